@@ -0,0 +1,103 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "BenchmarkUtilities.h"
+
+#include "Coin.h"
+#include "HDWallet.h"
+#include "HexCoding.h"
+#include "PrivateKey.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace TW;
+using namespace TW::Benchmarks;
+
+namespace {
+
+const auto mnemonic = "shoot island position soft burden budget tooth cruel issue economy destroy above";
+const auto privateKeyHex = "afeefca74d9a325cf1d6b6911d61a65c32afa8e02bd5e78e2e4ac2910bab45f5";
+
+PrivateKey privateKey(TWCoinType coin) {
+    const auto data = parse_hex(privateKeyHex);
+    if (curve(coin) == TWCurveED25519Extended) {
+        return PrivateKey(data, data, data);
+    }
+    return PrivateKey(data);
+}
+
+void BM_ValidateAddress(benchmark::State& state, TWCoinType coin) {
+    const auto address = deriveAddress(coin, privateKey(coin));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(validateAddress(coin, address));
+    }
+}
+
+void BM_NormalizeAddress(benchmark::State& state, TWCoinType coin) {
+    const auto address = deriveAddress(coin, privateKey(coin));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(normalizeAddress(coin, address));
+    }
+}
+
+void BM_DeriveAddress(benchmark::State& state, TWCoinType coin) {
+    const auto publicKey = privateKey(coin).getPublicKey(publicKeyType(coin));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(deriveAddress(coin, publicKey));
+    }
+}
+
+void BM_ValidateAddresses(benchmark::State& state) {
+    const auto address = deriveAddress(TWCoinTypeEthereum, privateKey(TWCoinTypeEthereum));
+    const auto addresses = std::vector<std::string>(1000, address);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(validateAddresses(TWCoinTypeEthereum, addresses, true, state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * addresses.size());
+}
+
+void BM_HDWalletCreate(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(HDWallet(mnemonic, ""));
+    }
+}
+
+void BM_HDWalletGetKey(benchmark::State& state, TWCoinType coin) {
+    const auto wallet = HDWallet(mnemonic, "");
+    const auto& path = derivationPath(coin);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(wallet.getKey(coin, path));
+    }
+}
+
+void BM_HDWalletGetAddresses(benchmark::State& state) {
+    const auto wallet = HDWallet(mnemonic, "");
+    auto path = derivationPath(TWCoinTypeBitcoin);
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < state.range(0); ++i) {
+            path.setAddress(i);
+            benchmark::DoNotOptimize(deriveAddress(TWCoinTypeBitcoin, wallet.getKey(TWCoinTypeBitcoin, path)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+const auto registered = [] {
+    for (const auto coin : getCoinTypes()) {
+        const auto id = coinId(coin);
+        benchmark::RegisterBenchmark(("Address/validate/" + id).c_str(), BM_ValidateAddress, coin);
+        benchmark::RegisterBenchmark(("Address/normalize/" + id).c_str(), BM_NormalizeAddress, coin);
+        benchmark::RegisterBenchmark(("Address/derive/" + id).c_str(), BM_DeriveAddress, coin);
+        benchmark::RegisterBenchmark(("HDWallet/getKey/" + id).c_str(), BM_HDWalletGetKey, coin);
+    }
+    return true;
+}();
+
+} // namespace
+
+BENCHMARK(BM_ValidateAddresses)->Name("Address/validateBatch/ethereum")->Arg(1)->Arg(4);
+BENCHMARK(BM_HDWalletCreate)->Name("HDWallet/create");
+BENCHMARK(BM_HDWalletGetAddresses)->Name("HDWallet/getAddresses/bitcoin")->Arg(1)->Arg(20)->Arg(100);
@@ -0,0 +1,51 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+
+#include <TrustWalletCore/TWCoinType.h>
+#include <TrustWalletCore/TWCoinTypeConfiguration.h>
+#include <TrustWalletCore/TWString.h>
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+namespace TW::Benchmarks {
+
+/// Coin id, as used in benchmark names (e.g. "bitcoin").
+inline std::string coinId(TWCoinType coin) {
+    auto id = TWCoinTypeConfigurationGetID(coin);
+    auto result = std::string(TWStringUTF8Bytes(id));
+    TWStringDelete(id);
+    return result;
+}
+
+/// Registers the signing benchmark of every coin with a signer.
+/// Called from main, as the signing inputs can't be built during static initialization.
+void registerSigningBenchmarks();
+
+/// Heap allocations made so far by the calling thread.
+uint64_t allocationCount();
+
+/// Reports the heap allocations per iteration as the "allocations" counter of a benchmark.
+class AllocationCounter {
+public:
+    explicit AllocationCounter(benchmark::State& state) : state(state), start(allocationCount()) {}
+    ~AllocationCounter() {
+        const auto iterations = std::max<uint64_t>(state.iterations(), 1);
+        state.counters["allocations"] = static_cast<double>(allocationCount() - start) / iterations;
+    }
+
+private:
+    benchmark::State& state;
+    uint64_t start;
+};
+
+} // namespace TW::Benchmarks
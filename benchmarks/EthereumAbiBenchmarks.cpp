@@ -0,0 +1,65 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Ethereum/ABI.h"
+#include "HexCoding.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace TW;
+using namespace TW::Ethereum::ABI;
+
+namespace {
+
+/// sam(bytes,bool,uint256[]), with `count` array elements
+Function samFunction(size_t count) {
+    std::vector<std::shared_ptr<ParamBase>> values;
+    for (size_t i = 0; i < count; ++i) {
+        values.push_back(std::make_shared<ParamUInt256>(i + 1));
+    }
+    return Function("sam", std::vector<std::shared_ptr<ParamBase>>{
+        std::make_shared<ParamByteArray>(Data{0x64, 0x61, 0x76, 0x65}),
+        std::make_shared<ParamBool>(true),
+        std::make_shared<ParamArray>(values),
+    });
+}
+
+void BM_EncodeTransfer(benchmark::State& state) {
+    const auto function = Function("transfer", std::vector<std::shared_ptr<ParamBase>>{
+        std::make_shared<ParamAddress>(parse_hex("5322b34c88ed0691971bf52a7047448f0f4efc84")),
+        std::make_shared<ParamUInt256>(uint256_t(2000000000000000000)),
+    });
+    for (auto _ : state) {
+        Data encoded;
+        function.encode(encoded);
+        benchmark::DoNotOptimize(encoded.data());
+    }
+}
+
+void BM_EncodeDynamic(benchmark::State& state) {
+    const auto function = samFunction(state.range(0));
+    for (auto _ : state) {
+        Data encoded;
+        function.encode(encoded);
+        benchmark::DoNotOptimize(encoded.data());
+    }
+}
+
+void BM_DecodeDynamic(benchmark::State& state) {
+    Data encoded;
+    samFunction(state.range(0)).encode(encoded);
+    auto function = samFunction(state.range(0));
+    for (auto _ : state) {
+        size_t offset = 0;
+        benchmark::DoNotOptimize(function.decodeInput(encoded, offset));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_EncodeTransfer)->Name("EthereumAbi/encode/transfer");
+BENCHMARK(BM_EncodeDynamic)->Name("EthereumAbi/encode/dynamic")->Arg(3)->Arg(100);
+BENCHMARK(BM_DecodeDynamic)->Name("EthereumAbi/decode/dynamic")->Arg(3)->Arg(100);
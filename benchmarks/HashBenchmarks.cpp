@@ -0,0 +1,128 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Base58.h"
+#include "Bech32.h"
+#include "Hash.h"
+#include "HexCoding.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace TW;
+
+namespace {
+
+Data input(size_t size) {
+    Data data(size);
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<byte>(i * 31 + 7);
+    }
+    return data;
+}
+
+template <Data (*H)(const byte*, size_t)>
+void BM_Hash(benchmark::State& state) {
+    const auto data = input(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(H(data.data(), data.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+void BM_Blake2b(benchmark::State& state) {
+    const auto data = input(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Hash::blake2b(data.data(), data.size(), 32));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+void BM_Keccak256Batch(benchmark::State& state) {
+    const auto inputs = std::vector<Data>(state.range(0), input(64));
+    std::vector<Data> outputs;
+    for (auto _ : state) {
+        Hash::keccak256Batch(inputs, outputs);
+        benchmark::DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+void BM_Hash160Batch(benchmark::State& state) {
+    const auto inputs = std::vector<Data>(state.range(0), input(33));
+    std::vector<Data> outputs;
+    for (auto _ : state) {
+        Hash::hash160Batch(inputs, outputs);
+        benchmark::DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+void BM_Hex(benchmark::State& state) {
+    const auto data = input(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hex(data));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+void BM_ParseHex(benchmark::State& state) {
+    const auto string = hex(input(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_hex(string));
+    }
+    state.SetBytesProcessed(state.iterations() * string.size() / 2);
+}
+
+void BM_Base58EncodeCheck(benchmark::State& state) {
+    const auto data = input(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Base58::bitcoin.encodeCheck(data));
+    }
+}
+
+void BM_Base58DecodeCheck(benchmark::State& state) {
+    const auto string = Base58::bitcoin.encodeCheck(input(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Base58::bitcoin.decodeCheck(string));
+    }
+}
+
+void BM_Bech32Encode(benchmark::State& state) {
+    // 5-bit values of a 20-byte witness program
+    Data values(32);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<byte>(i % 32);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Bech32::encode("bc", values, Bech32::ChecksumVariant::Bech32));
+    }
+}
+
+void BM_Bech32Decode(benchmark::State& state) {
+    const auto string = std::string("bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Bech32::decode(string));
+    }
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_Hash, Hash::sha256)->Name("Hash/sha256")->RangeMultiplier(8)->Range(32, 16 << 10);
+BENCHMARK_TEMPLATE(BM_Hash, Hash::sha512)->Name("Hash/sha512")->RangeMultiplier(8)->Range(32, 16 << 10);
+BENCHMARK_TEMPLATE(BM_Hash, Hash::keccak256)->Name("Hash/keccak256")->RangeMultiplier(8)->Range(32, 16 << 10);
+BENCHMARK_TEMPLATE(BM_Hash, Hash::ripemd)->Name("Hash/ripemd")->RangeMultiplier(8)->Range(32, 16 << 10);
+BENCHMARK_TEMPLATE(BM_Hash, Hash::blake256)->Name("Hash/blake256")->RangeMultiplier(8)->Range(32, 16 << 10);
+BENCHMARK_TEMPLATE(BM_Hash, Hash::sha256d)->Name("Hash/sha256d")->RangeMultiplier(8)->Range(32, 16 << 10);
+BENCHMARK_TEMPLATE(BM_Hash, Hash::sha256ripemd)->Name("Hash/sha256ripemd")->Arg(33)->Arg(65);
+BENCHMARK(BM_Blake2b)->Name("Hash/blake2b")->RangeMultiplier(8)->Range(32, 16 << 10);
+BENCHMARK(BM_Keccak256Batch)->Name("Hash/keccak256Batch")->Arg(1)->Arg(4)->Arg(64);
+BENCHMARK(BM_Hash160Batch)->Name("Hash/hash160Batch")->Arg(1)->Arg(4)->Arg(64);
+BENCHMARK(BM_Hex)->Name("Encoding/hex")->Arg(32)->Arg(1024);
+BENCHMARK(BM_ParseHex)->Name("Encoding/parse_hex")->Arg(32)->Arg(1024);
+BENCHMARK(BM_Base58EncodeCheck)->Name("Encoding/base58EncodeCheck")->Arg(21)->Arg(82);
+BENCHMARK(BM_Base58DecodeCheck)->Name("Encoding/base58DecodeCheck")->Arg(21)->Arg(82);
+BENCHMARK(BM_Bech32Encode)->Name("Encoding/bech32Encode");
+BENCHMARK(BM_Bech32Decode)->Name("Encoding/bech32Decode");
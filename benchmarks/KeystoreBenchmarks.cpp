@@ -0,0 +1,36 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Keystore/StoredKey.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace TW;
+using namespace TW::Keystore;
+
+namespace {
+
+const auto mnemonic = "team engine square letter hero song dizzy scrub tornado fabric divert saddle";
+const auto password = Data{'p', 'a', 's', 's', 'w', 'o', 'r', 'd'};
+
+void BM_StoredKeyLoad(benchmark::State& state) {
+    const auto json = StoredKey::createWithMnemonic("name", password, mnemonic).json();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(StoredKey::createWithJson(json));
+    }
+}
+
+void BM_StoredKeyDecrypt(benchmark::State& state) {
+    const auto key = StoredKey::createWithJson(StoredKey::createWithMnemonic("name", password, mnemonic).json());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(key.wallet(password));
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_StoredKeyLoad)->Name("Keystore/load");
+BENCHMARK(BM_StoredKeyDecrypt)->Name("Keystore/decrypt")->Unit(benchmark::kMillisecond);
@@ -0,0 +1,77 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "BenchmarkUtilities.h"
+
+#include "Coin.h"
+#include "SigningInputs.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace TW;
+using namespace TW::Benchmarks;
+
+namespace {
+
+void BM_AnyCoinSign(benchmark::State& state, TWCoinType coin, const Data& input) {
+    AllocationCounter allocations(state);
+    for (auto _ : state) {
+        Data output;
+        anyCoinSign(coin, input, output);
+        benchmark::DoNotOptimize(output.data());
+    }
+}
+
+void BM_AnyCoinSignBatch(benchmark::State& state) {
+    const auto inputs = std::vector<Data>(100, SigningInputs::forCoin(TWCoinTypeEthereum));
+    for (auto _ : state) {
+        std::vector<Data> outputs;
+        anyCoinSignBatch(TWCoinTypeEthereum, inputs, outputs, state.range(0));
+        benchmark::DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * inputs.size());
+}
+
+void BM_BitcoinPlan(benchmark::State& state) {
+    const auto input = SigningInputs::serialize(SigningInputs::bitcoin(state.range(0)));
+    AllocationCounter allocations(state);
+    for (auto _ : state) {
+        Data output;
+        anyCoinPlan(TWCoinTypeBitcoin, input, output);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_BitcoinSign(benchmark::State& state) {
+    const auto input = SigningInputs::serialize(SigningInputs::bitcoin(state.range(0)));
+    AllocationCounter allocations(state);
+    for (auto _ : state) {
+        Data output;
+        anyCoinSign(TWCoinTypeBitcoin, input, output);
+        benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+void TW::Benchmarks::registerSigningBenchmarks() {
+    // the coins without a signer have no input to sign
+    for (const auto coin : getCoinTypes()) {
+        const auto input = SigningInputs::forCoin(coin);
+        if (input.empty()) {
+            continue;
+        }
+        benchmark::RegisterBenchmark(("AnySigner/sign/" + coinId(coin)).c_str(), BM_AnyCoinSign, coin, input);
+    }
+}
+
+BENCHMARK(BM_AnyCoinSignBatch)->Name("AnySigner/signBatch/ethereum")->Arg(1)->Arg(4);
+BENCHMARK(BM_BitcoinPlan)->Name("Bitcoin/plan")->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Arg(5000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BitcoinSign)->Name("Bitcoin/sign")->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Arg(5000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,51 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "BenchmarkUtilities.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+thread_local uint64_t allocations = 0;
+
+} // namespace
+
+// Counts the heap allocations of the benchmarks executable, see AllocationCounter.
+// The array and nothrow forms call these by default.
+void* operator new(size_t size) {
+    ++allocations;
+    if (auto pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+uint64_t TW::Benchmarks::allocationCount() {
+    return allocations;
+}
+
+// Run with --benchmark_out=<file> --benchmark_out_format=json for machine readable results, see tools/benchmarks
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    TW::Benchmarks::registerSigningBenchmarks();
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
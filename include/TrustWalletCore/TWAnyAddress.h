@@ -27,6 +27,16 @@ bool TWAnyAddressEqual(struct TWAnyAddress* _Nonnull lhs, struct TWAnyAddress* _
 TW_EXPORT_STATIC_METHOD
 bool TWAnyAddressIsValid(TWString* _Nonnull string, enum TWCoinType coin);
 
+/// Validates a batch of addresses of one coin, and normalizes the valid ones if requested.
+///
+/// Input is the address strings, each preceded by its length as a 32-bit little-endian integer.
+/// Output is one validity bit per address (bit i % 8 of byte i / 8), followed, when normalizing,
+/// by the normalized addresses in the input format (empty for invalid addresses).
+/// Work is split over `threads` threads, at most the hardware concurrency; 0 or 1 runs on the calling thread.
+/// Returns null if the input is malformed.
+TW_EXPORT_STATIC_METHOD
+TWData* _Nullable TWAnyAddressValidateBatch(TWData* _Nonnull addresses, enum TWCoinType coin, bool normalize, uint32_t threads);
+
 /// Creates an address from a string representaion.
 TW_EXPORT_STATIC_METHOD
 struct TWAnyAddress* _Nullable TWAnyAddressCreateWithString(TWString* _Nonnull string, enum TWCoinType coin);
@@ -13,11 +13,20 @@
 TW_EXTERN_C_BEGIN
 
 /// Helper class to sign any transactions.
+/// All its functions can be called concurrently from several threads.
 struct TWAnySigner;
 
 /// Signs a transaction.
 extern TWData *_Nonnull TWAnySignerSign(TWData *_Nonnull input, enum TWCoinType coin);
 
+/// Signs a batch of transactions of one coin.
+///
+/// Input is the serialized signing inputs, each preceded by its length as a 32-bit little-endian integer;
+/// output is the serialized signing outputs in the same format and order.
+/// Work is split over `threads` threads, at most the hardware concurrency; 0 or 1 runs on the calling thread.
+/// Returns null if the input is malformed.
+extern TWData *_Nullable TWAnySignerSignBatch(TWData *_Nonnull inputs, enum TWCoinType coin, uint32_t threads);
+
 /// Signs a json transaction with private key.
 extern TWString *_Nonnull TWAnySignerSignJSON(TWString *_Nonnull json, TWData *_Nonnull key, enum TWCoinType coin);
 
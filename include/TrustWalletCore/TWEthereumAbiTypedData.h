@@ -0,0 +1,39 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "TWBase.h"
+#include "TWString.h"
+#include "TWData.h"
+
+TW_EXTERN_C_BEGIN
+
+/// EIP712 types and domain, compiled once for hashing several typed data messages.
+TW_EXPORT_CLASS
+struct TWEthereumAbiTypedData;
+
+/// Compiles the types (the 'types' field of a typed data message, see TWEthereumAbiEncodeTyped) and the domain.
+/// Returns null on error.  It must be deleted at the end.
+TW_EXPORT_STATIC_METHOD
+struct TWEthereumAbiTypedData* _Nullable TWEthereumAbiTypedDataCreate(TWString* _Nonnull typesJson, TWString* _Nonnull domainJson);
+
+/// Deletes an object created with 'TWEthereumAbiTypedDataCreate'.
+TW_EXPORT_METHOD
+void TWEthereumAbiTypedDataDelete(struct TWEthereumAbiTypedData* _Nonnull typedData);
+
+/// Hash of the domain.
+TW_EXPORT_PROPERTY
+TWData* _Nonnull TWEthereumAbiTypedDataDomainSeparator(struct TWEthereumAbiTypedData* _Nonnull typedData);
+
+/// Computes the hash to sign of a message (the 'message' field of a typed data message) of the given primary type.
+/// Same result as TWEthereumAbiEncodeTyped on the full message.
+/// On error, empty Data is returned.
+/// Returned data must be deleted (hint: use WRAPD() macro).
+TW_EXPORT_METHOD
+TWData* _Nonnull TWEthereumAbiTypedDataHashMessage(struct TWEthereumAbiTypedData* _Nonnull typedData, TWString* _Nonnull primaryType, TWString* _Nonnull messageJson);
+
+TW_EXTERN_C_END
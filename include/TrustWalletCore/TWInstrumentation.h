@@ -0,0 +1,35 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "TWBase.h"
+#include "TWString.h"
+
+TW_EXTERN_C_BEGIN
+
+/// Timing and counters of the signing pipeline stages (parsing, UTXO selection, fee estimation, sighash,
+/// EC signing, serialization, key derivation, keystore decryption).
+/// Only collected when the library is built with TW_INSTRUMENTATION; otherwise all stats stay zero.
+struct TWInstrumentation;
+
+/// Receives the stage name and its duration in nanoseconds, on the thread that ran the stage.
+typedef void (*TWInstrumentationSink)(void *_Nullable context, const char *_Nonnull stage, uint64_t nanoseconds);
+
+/// Whether the library was built with instrumentation.
+extern bool TWInstrumentationEnabled(void);
+
+/// Sets the callback called at the end of each timed stage; null removes it.
+/// Set it before signing starts, it is not synchronized with running operations.
+extern void TWInstrumentationSetSink(TWInstrumentationSink _Nullable sink, void *_Nullable context);
+
+/// Aggregated stats as JSON: calls, total and max time per stage, and counter values.
+extern TWString *_Nonnull TWInstrumentationStats(void);
+
+/// Clears the aggregated stats.
+extern void TWInstrumentationReset(void);
+
+TW_EXTERN_C_END
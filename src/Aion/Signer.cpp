@@ -16,7 +16,7 @@ using namespace TW::Aion;
 Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
     using boost::multiprecision::uint128_t;
 
-    auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto key = PrivateKey(input.private_key());
     auto transaction = Transaction(
         /* nonce: */ static_cast<uint128_t>(load(input.nonce())),
         /* gasPrice: */ static_cast<uint128_t>(load(input.gas_price())),
@@ -66,12 +66,16 @@ Data Base58::decodeCheck(const char* begin, const char* end, Hash::Hasher hasher
     }
 
     // re-calculate the checksum, ensure it matches the included 4-byte checksum
-    auto hash = hasher(result.data(), result.size() - 4);
-    if (!std::equal(hash.begin(), hash.begin() + 4, result.end() - 4)) {
+    const auto hash = hasher(result.data(), result.size() - 4);
+    return removeChecksum(result, hash.data());
+}
+
+Data Base58::removeChecksum(const Data& decoded, const byte* hash) {
+    if (!std::equal(hash, hash + 4, decoded.end() - 4)) {
         return {};
     }
 
-    return Data(result.begin(), result.end() - 4);
+    return Data(decoded.begin(), decoded.end() - 4);
 }
 
 Data Base58::decode(const char* begin, const char* end) const {
@@ -88,9 +92,10 @@ Data Base58::decode(const char* begin, const char* end) const {
         it += 1;
     }
 
-    // Allocate enough space in big-endian base256 representation.
+    // Allocate enough space in big-endian base256 representation, after the zero bytes of the
+    // leading zeros, so that the result is decoded in place.
     std::size_t base258Size = (end - it) * 733 / 1000 + 1; // log(58) / log(256), rounded up.
-    Data b256(base258Size);
+    Data b256(zeroes + base258Size);
 
     // Process the characters.
     while (it != end && !std::isspace(*it)) {
@@ -126,25 +131,27 @@ Data Base58::decode(const char* begin, const char* end) const {
     }
 
     // Skip leading zeroes in b256.
-    auto b256it = b256.begin() + (base258Size - length);
+    auto b256it = b256.begin() + (zeroes + base258Size - length);
     while (b256it != b256.end() && *b256it == 0) {
         b256it++;
     }
 
-    // Copy result into output vector.
-    Data result;
-    result.reserve(zeroes + (b256.end() - b256it));
-    result.assign(zeroes, 0x00);
-    std::copy(b256it, b256.end(), std::back_inserter(result));
-
-    return result;
+    // Keep the zero bytes of the leading zeros, followed by the significant bytes.
+    b256.erase(b256.begin() + zeroes, b256it);
+    return b256;
 }
 
 std::string Base58::encodeCheck(const byte* begin, const byte* end, Hash::Hasher hasher) const {
+    const auto hash = hasher(begin, end - begin);
+    return encodeWithChecksum(begin, end, hash.data());
+}
+
+std::string Base58::encodeWithChecksum(const byte* begin, const byte* end, const byte* hash) const {
     // add 4-byte hash check to the end
-    Data dataWithCheck(begin, end);
-    auto hash = hasher(begin, end - begin);
-    dataWithCheck.insert(dataWithCheck.end(), hash.begin(), hash.begin() + 4);
+    Data dataWithCheck;
+    dataWithCheck.reserve(end - begin + 4);
+    dataWithCheck.insert(dataWithCheck.end(), begin, end);
+    dataWithCheck.insert(dataWithCheck.end(), hash, hash + 4);
     return encode(dataWithCheck);
 }
 
@@ -34,12 +34,30 @@ class Base58 {
         : digits(digits), characterMap(characterMap) {}
 
     /// Decodes a base 58 string verifying the checksum, returns empty on failure.
-    Data decodeCheck(const std::string& string, Hash::Hasher hasher = Hash::sha256d) const {
-        return decodeCheck(string.data(), string.data() + string.size(), hasher);
+    /// The checksum hash is selected at compile time, double SHA256 by default.
+    template <Hash::Algorithm A = Hash::Algorithm::sha256d>
+    Data decodeCheck(const std::string& string) const {
+        return decodeCheck<A>(string.data(), string.data() + string.size());
     }
 
     /// Decodes a base 58 string verifying the checksum, returns empty on failure.
-    Data decodeCheck(const char* begin, const char* end, Hash::Hasher hasher = Hash::sha256d) const;
+    template <Hash::Algorithm A = Hash::Algorithm::sha256d>
+    Data decodeCheck(const char* begin, const char* end) const {
+        auto result = decode(begin, end);
+        if (result.size() < 4) {
+            return {};
+        }
+        const auto hash = Hash::digest<A>(result.data(), result.size() - 4);
+        return removeChecksum(result, hash.data());
+    }
+
+    /// Decodes a base 58 string verifying the checksum with a hasher chosen at runtime, returns empty on failure.
+    Data decodeCheck(const std::string& string, Hash::Hasher hasher) const {
+        return decodeCheck(string.data(), string.data() + string.size(), hasher);
+    }
+
+    /// Decodes a base 58 string verifying the checksum with a hasher chosen at runtime, returns empty on failure.
+    Data decodeCheck(const char* begin, const char* end, Hash::Hasher hasher) const;
 
     /// Decodes a base 58 string into `result`, returns `false` on failure.
     Data decode(const std::string& string) const {
@@ -50,13 +68,27 @@ class Base58 {
     Data decode(const char* begin, const char* end) const;
 
     /// Encodes data as a base 58 string with a checksum.
+    /// The checksum hash is selected at compile time, double SHA256 by default.
+    template <Hash::Algorithm A = Hash::Algorithm::sha256d, typename T>
+    std::string encodeCheck(const T& data) const {
+        return encodeCheck<A>(data.data(), data.data() + data.size());
+    }
+
+    /// Encodes data as a base 58 string with a checksum.
+    template <Hash::Algorithm A = Hash::Algorithm::sha256d>
+    std::string encodeCheck(const byte* pbegin, const byte* pend) const {
+        const auto hash = Hash::digest<A>(pbegin, pend - pbegin);
+        return encodeWithChecksum(pbegin, pend, hash.data());
+    }
+
+    /// Encodes data as a base 58 string with a checksum from a hasher chosen at runtime.
     template <typename T>
-    std::string encodeCheck(const T& data, Hash::Hasher hasher = Hash::sha256d) const {
+    std::string encodeCheck(const T& data, Hash::Hasher hasher) const {
         return encodeCheck(data.data(), data.data() + data.size(), hasher);
     }
 
-    /// Encodes data as a base 58 string with a checksum.
-    std::string encodeCheck(const byte* pbegin, const byte* pend, Hash::Hasher hasher = Hash::sha256d) const;
+    /// Encodes data as a base 58 string with a checksum from a hasher chosen at runtime.
+    std::string encodeCheck(const byte* pbegin, const byte* pend, Hash::Hasher hasher) const;
 
     /// Encodes data as a base 58 string.
     template <typename T>
@@ -66,6 +98,13 @@ class Base58 {
 
     /// Encodes data as a base 58 string.
     std::string encode(const byte* pbegin, const byte* pend) const;
+
+  private:
+    /// Strips the 4-byte checksum from decoded data if it matches the start of `hash`, returns empty otherwise.
+    static Data removeChecksum(const Data& decoded, const byte* hash);
+
+    /// Encodes data followed by the first 4 bytes of `hash`.
+    std::string encodeWithChecksum(const byte* pbegin, const byte* pend, const byte* hash) const;
 };
 
 } // namespace TW
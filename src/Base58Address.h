@@ -80,8 +80,9 @@ class Base58Address {
         if (publicKey.type != TWPublicKeyTypeSECP256k1) {
             throw std::invalid_argument("Bitcoin::Address needs a compressed SECP256k1 public key.");
         }
-        const auto data = publicKey.hash(prefix, Hash::sha256ripemd);
-        std::copy(data.begin(), data.end(), bytes.begin());
+        const auto hash = publicKey.hash<Hash::Algorithm::sha256ripemd>();
+        std::copy(prefix.begin(), prefix.end(), bytes.begin());
+        std::copy(hash.begin(), hash.end(), bytes.begin() + prefix.size());
     }
 
     /// Returns a string representation of the address.
@@ -11,6 +11,9 @@
 #include <boost/archive/iterators/binary_from_base64.hpp>
 #include <boost/archive/iterators/transform_width.hpp>
 
+#include <algorithm>
+#include <iterator>
+
 namespace TW::Base64 {
 
 using namespace TW;
@@ -26,7 +29,9 @@ Data decode(const string& val) {
 string encode(const Data& val) {
     using namespace boost::archive::iterators;
     using It = base64_from_binary<transform_width<Data::const_iterator, 6, 8>>;
-    auto encoded = string(It(begin(val)), It(end(val)));
+    string encoded;
+    encoded.reserve((val.size() + 2) / 3 * 4);
+    std::copy(It(begin(val)), It(end(val)), std::back_inserter(encoded));
     return encoded.append((3 - val.size() % 3) % 3, '=');
 }
 
@@ -35,14 +35,30 @@ const uint32_t BECH32_XOR_CONST = 0x01;
 const uint32_t BECH32M_XOR_CONST = 0x2bc830a3;
 
 
-/** Find the polynomial with value coefficients mod the generator as 30-bit. */
-uint32_t polymod(const Data& values) {
+/** One step of the polynomial computation: appends a value. */
+inline uint32_t polymodStep(uint32_t chk, uint8_t value) {
+    uint8_t top = chk >> 25;
+    return (chk & 0x1ffffff) << 5 ^ value ^ (-((top >> 0) & 1) & 0x3b6a57b2UL) ^
+           (-((top >> 1) & 1) & 0x26508e6dUL) ^ (-((top >> 2) & 1) & 0x1ea119faUL) ^
+           (-((top >> 3) & 1) & 0x3d4233ddUL) ^ (-((top >> 4) & 1) & 0x2a1462b3UL);
+}
+
+/** Find the polynomial with value coefficients mod the generator as 30-bit, over the expanded HRP,
+ * the values and `zeroes` trailing zero values, without building their concatenation. */
+uint32_t polymod(const std::string& hrp, const byte* values, size_t size, size_t zeroes = 0) {
     uint32_t chk = 1;
-    for (const auto& value : values) {
-        uint8_t top = chk >> 25;
-        chk = (chk & 0x1ffffff) << 5 ^ value ^ (-((top >> 0) & 1) & 0x3b6a57b2UL) ^
-              (-((top >> 1) & 1) & 0x26508e6dUL) ^ (-((top >> 2) & 1) & 0x1ea119faUL) ^
-              (-((top >> 3) & 1) & 0x3d4233ddUL) ^ (-((top >> 4) & 1) & 0x2a1462b3UL);
+    for (const unsigned char c : hrp) {
+        chk = polymodStep(chk, c >> 5);
+    }
+    chk = polymodStep(chk, 0);
+    for (const unsigned char c : hrp) {
+        chk = polymodStep(chk, c & 0x1f);
+    }
+    for (size_t i = 0; i < size; ++i) {
+        chk = polymodStep(chk, values[i]);
+    }
+    for (size_t i = 0; i < zeroes; ++i) {
+        chk = polymodStep(chk, 0);
     }
     return chk;
 }
@@ -52,19 +68,6 @@ unsigned char lc(unsigned char c) {
     return (c >= 'A' && c <= 'Z') ? (c - 'A') + 'a' : c;
 }
 
-/** Expand a HRP for use in checksum computation. */
-Data expand_hrp(const std::string& hrp) {
-    Data ret;
-    ret.resize(hrp.size() * 2 + 1);
-    for (size_t i = 0; i < hrp.size(); ++i) {
-        unsigned char c = hrp[i];
-        ret[i] = c >> 5;
-        ret[i + hrp.size() + 1] = c & 0x1f;
-    }
-    ret[hrp.size()] = 0;
-    return ret;
-}
-
 inline uint32_t xorConstant(ChecksumVariant variant) {
     if (variant == ChecksumVariant::Bech32) {
         return BECH32_XOR_CONST;
@@ -75,9 +78,7 @@ inline uint32_t xorConstant(ChecksumVariant variant) {
 
 /** Verify a checksum. */
 ChecksumVariant verify_checksum(const std::string& hrp, const Data& values) {
-    Data enc = expand_hrp(hrp);
-    append(enc, values);
-    auto poly = polymod(enc);
+    auto poly = polymod(hrp, values.data(), values.size());
     if (poly == BECH32_XOR_CONST) {
         return ChecksumVariant::Bech32;
     }
@@ -88,14 +89,10 @@ ChecksumVariant verify_checksum(const std::string& hrp, const Data& values) {
 }
 
 /** Create a checksum. */
-Data create_checksum(const std::string& hrp, const Data& values, ChecksumVariant variant) {
-    Data enc = expand_hrp(hrp);
-    append(enc, values);
-    enc.resize(enc.size() + 6);
+std::array<byte, 6> create_checksum(const std::string& hrp, const Data& values, ChecksumVariant variant) {
     auto xorConst = xorConstant(variant);
-    uint32_t mod = polymod(enc) ^ xorConst;
-    Data ret;
-    ret.resize(6);
+    uint32_t mod = polymod(hrp, values.data(), values.size(), 6) ^ xorConst;
+    std::array<byte, 6> ret;
     for (size_t i = 0; i < 6; ++i) {
         ret[i] = (mod >> (5 * (5 - i))) & 31;
     }
@@ -106,12 +103,15 @@ Data create_checksum(const std::string& hrp, const Data& values, ChecksumVariant
 
 /** Encode a Bech32 string. */
 std::string Bech32::encode(const std::string& hrp, const Data& values, ChecksumVariant variant) {
-    Data checksum = create_checksum(hrp, values, variant);
-    Data combined = values;
-    append(combined, checksum);
-    std::string ret = hrp + '1';
-    ret.reserve(ret.size() + combined.size());
-    for (const auto& value : combined) {
+    const auto checksum = create_checksum(hrp, values, variant);
+    std::string ret;
+    ret.reserve(hrp.size() + 1 + values.size() + checksum.size());
+    ret += hrp;
+    ret += '1';
+    for (const auto& value : values) {
+        ret += charset[value];
+    }
+    for (const auto& value : checksum) {
         ret += charset[value];
     }
     return ret;
@@ -153,12 +153,15 @@ std::tuple<std::string, Data, ChecksumVariant> Bech32::decode(const std::string&
         }
         if (ok) {
             std::string hrp;
+            hrp.reserve(pos);
             for (size_t i = 0; i < pos; ++i) {
                 hrp += lc(str[i]);
             }
             auto variant = verify_checksum(hrp, values);
             if (variant != None) {
-                return std::make_tuple(hrp, Data(values.begin(), values.end() - 6), variant);
+                // drop the checksum
+                values.resize(values.size() - 6);
+                return std::make_tuple(std::move(hrp), std::move(values), variant);
             }
         }
     }
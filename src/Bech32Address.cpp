@@ -68,7 +68,7 @@ Bech32Address::Bech32Address(const std::string& hrp, HasherType hasher, const Pu
         
         case HASHER_SHA2:
             {
-                const auto hash = Hash::sha256(publicKey.bytes);
+                const auto hash = Hash::digest<Hash::Algorithm::sha256>(publicKey.bytes);
                 auto key = Data(20);
                 std::copy(hash.end() - 20, hash.end(), key.begin());
                 setKey(key);
@@ -77,7 +77,7 @@ Bech32Address::Bech32Address(const std::string& hrp, HasherType hasher, const Pu
 
         case HASHER_SHA3K:
             {
-                const auto hash = publicKey.hash({}, static_cast<Hash::HasherSimpleType>(Hash::keccak256), true);
+                const auto hash = publicKey.hash<Hash::Algorithm::keccak256>(true);
                 auto key = Data(20);
                 std::copy(hash.end() - 20, hash.end(), key.begin());
                 setKey(key);
@@ -15,8 +15,6 @@ using namespace TW;
 using namespace TW::Binance;
 using namespace google::protobuf;
 
-using json = nlohmann::json;
-
 static inline std::string addressString(const std::string& bytes) {
     auto data = Data(bytes.begin(), bytes.end());
     return Address(data).string();
@@ -27,157 +25,214 @@ static inline std::string validatorAddress(const std::string& bytes) {
     return Bech32Address(Address::hrpValidator, data).string();
 }
 
-json Binance::signatureJSON(const Proto::SigningInput& input) {
-    json j;
-    j["account_number"] = std::to_string(input.account_number());
-    j["chain_id"] = input.chain_id();
-    j["data"] = nullptr;
-    j["memo"] = input.memo();
-    j["msgs"] = json::array({orderJSON(input)});
-    j["sequence"] = std::to_string(input.sequence());
-    j["source"] = std::to_string(input.source());
-    return j;
+void Binance::signatureJSON(const Proto::SigningInput& input, ByteSink& sink) {
+    CanonicalJSONWriter w(sink);
+    w.beginObject()
+        .key("account_number").value(std::to_string(input.account_number()))
+        .key("chain_id").value(input.chain_id())
+        .key("data").null()
+        .key("memo").value(input.memo())
+        .key("msgs").beginArray();
+    orderJSON(w, input);
+    w.endArray()
+        .key("sequence").value(std::to_string(input.sequence()))
+        .key("source").value(std::to_string(input.source()))
+        .endObject();
 }
 
-json Binance::orderJSON(const Proto::SigningInput& input) {
-    json j;
+void Binance::orderJSON(CanonicalJSONWriter& w, const Proto::SigningInput& input) {
     if (input.has_trade_order()) {
-        j["id"] = input.trade_order().id();
-        j["ordertype"] = 2;
-        j["price"] = input.trade_order().price();
-        j["quantity"] = input.trade_order().quantity();
-        j["sender"] = addressString(input.trade_order().sender());
-        j["side"] = input.trade_order().side();
-        j["symbol"] = input.trade_order().symbol();
-        j["timeinforce"] = input.trade_order().timeinforce();
+        const auto& order = input.trade_order();
+        w.beginObject()
+            .key("id").value(order.id())
+            .key("ordertype").value(2)
+            .key("price").value(order.price())
+            .key("quantity").value(order.quantity())
+            .key("sender").value(addressString(order.sender()))
+            .key("side").value(order.side())
+            .key("symbol").value(order.symbol())
+            .key("timeinforce").value(order.timeinforce())
+            .endObject();
     } else if (input.has_cancel_trade_order()) {
-        j["refid"] = input.cancel_trade_order().refid();
-        j["sender"] = addressString(input.cancel_trade_order().sender());
-        j["symbol"] = input.cancel_trade_order().symbol();
+        const auto& order = input.cancel_trade_order();
+        w.beginObject()
+            .key("refid").value(order.refid())
+            .key("sender").value(addressString(order.sender()))
+            .key("symbol").value(order.symbol())
+            .endObject();
     } else if (input.has_send_order()) {
-        j["inputs"] = inputsJSON(input.send_order());
-        j["outputs"] = outputsJSON(input.send_order());
+        w.beginObject().key("inputs");
+        inputsJSON(w, input.send_order());
+        w.key("outputs");
+        outputsJSON(w, input.send_order());
+        w.endObject();
     } else if (input.has_freeze_order()) {
-        j["from"] = addressString(input.freeze_order().from());
-        j["symbol"] = input.freeze_order().symbol();
-        j["amount"] = input.freeze_order().amount();
+        const auto& order = input.freeze_order();
+        w.beginObject()
+            .key("amount").value(order.amount())
+            .key("from").value(addressString(order.from()))
+            .key("symbol").value(order.symbol())
+            .endObject();
     } else if (input.has_unfreeze_order()) {
-        j["from"] = addressString(input.unfreeze_order().from());
-        j["symbol"] = input.unfreeze_order().symbol();
-        j["amount"] = input.unfreeze_order().amount();
+        const auto& order = input.unfreeze_order();
+        w.beginObject()
+            .key("amount").value(order.amount())
+            .key("from").value(addressString(order.from()))
+            .key("symbol").value(order.symbol())
+            .endObject();
     } else if (input.has_htlt_order()) {
-        j["from"] = addressString(input.htlt_order().from());
-        j["to"] = addressString(input.htlt_order().to());
-        j["recipient_other_chain"] = input.htlt_order().recipient_other_chain();
-        j["sender_other_chain"] = input.htlt_order().sender_other_chain();
-        j["random_number_hash"] = hex(input.htlt_order().random_number_hash());
-        j["timestamp"] = input.htlt_order().timestamp();
-        j["amount"] = tokensJSON(input.htlt_order().amount());
-        j["expected_income"] = input.htlt_order().expected_income();
-        j["height_span"] = input.htlt_order().height_span();
-        j["cross_chain"] = input.htlt_order().cross_chain();
+        const auto& order = input.htlt_order();
+        w.beginObject().key("amount");
+        tokensJSON(w, order.amount());
+        w.key("cross_chain").value(order.cross_chain())
+            .key("expected_income").value(order.expected_income())
+            .key("from").value(addressString(order.from()))
+            .key("height_span").value(order.height_span())
+            .key("random_number_hash").value(hex(order.random_number_hash()))
+            .key("recipient_other_chain").value(order.recipient_other_chain())
+            .key("sender_other_chain").value(order.sender_other_chain())
+            .key("timestamp").value(order.timestamp())
+            .key("to").value(addressString(order.to()))
+            .endObject();
     } else if (input.has_deposithtlt_order()) {
-        j["from"] = addressString(input.deposithtlt_order().from());
-        j["swap_id"] = hex(input.deposithtlt_order().swap_id());
-        j["amount"] = tokensJSON(input.deposithtlt_order().amount());
+        const auto& order = input.deposithtlt_order();
+        w.beginObject().key("amount");
+        tokensJSON(w, order.amount());
+        w.key("from").value(addressString(order.from()))
+            .key("swap_id").value(hex(order.swap_id()))
+            .endObject();
     } else if (input.has_claimhtlt_order()) {
-        j["from"] = addressString(input.claimhtlt_order().from());
-        j["swap_id"] = hex(input.claimhtlt_order().swap_id());
-        j["random_number"] = hex(input.claimhtlt_order().random_number());
+        const auto& order = input.claimhtlt_order();
+        w.beginObject()
+            .key("from").value(addressString(order.from()))
+            .key("random_number").value(hex(order.random_number()))
+            .key("swap_id").value(hex(order.swap_id()))
+            .endObject();
     } else if (input.has_refundhtlt_order()) {
-        j["from"] = addressString(input.refundhtlt_order().from());
-        j["swap_id"] = hex(input.refundhtlt_order().swap_id());
+        const auto& order = input.refundhtlt_order();
+        w.beginObject()
+            .key("from").value(addressString(order.from()))
+            .key("swap_id").value(hex(order.swap_id()))
+            .endObject();
     } else if (input.has_transfer_out_order()) {
-        auto to = input.transfer_out_order().to();
+        const auto& order = input.transfer_out_order();
+        auto to = order.to();
         auto addr = Ethereum::Address(Data(to.begin(), to.end()));
-        j["from"] = addressString(input.transfer_out_order().from());
-        j["to"] = addr.string();
-        j["amount"] = tokenJSON(input.transfer_out_order().amount());
-        j["expire_time"] = input.transfer_out_order().expire_time();
+        w.beginObject().key("amount");
+        tokenJSON(w, order.amount());
+        w.key("expire_time").value(order.expire_time())
+            .key("from").value(addressString(order.from()))
+            .key("to").value(addr.string())
+            .endObject();
     } else if (input.has_side_delegate_order()) {
-        j["type"] = "cosmos-sdk/MsgSideChainDelegate";
-        j["value"] = {
-            {"delegator_addr", addressString(input.side_delegate_order().delegator_addr())},
-            {"validator_addr",validatorAddress(input.side_delegate_order().validator_addr())},
-            {"delegation", tokenJSON(input.side_delegate_order().delegation(), true)},
-            {"side_chain_id", input.side_delegate_order().chain_id()},
-        };
+        const auto& order = input.side_delegate_order();
+        w.beginObject()
+            .key("type").value("cosmos-sdk/MsgSideChainDelegate")
+            .key("value").beginObject()
+                .key("delegation");
+        tokenJSON(w, order.delegation(), true);
+        w.key("delegator_addr").value(addressString(order.delegator_addr()))
+                .key("side_chain_id").value(order.chain_id())
+                .key("validator_addr").value(validatorAddress(order.validator_addr()))
+            .endObject()
+            .endObject();
     } else if (input.has_side_redelegate_order()) {
-        j["type"] = "cosmos-sdk/MsgSideChainRedelegate";
-        j["value"] = {
-            {"delegator_addr", addressString(input.side_redelegate_order().delegator_addr())},
-            {"validator_src_addr", validatorAddress(input.side_redelegate_order().validator_src_addr())},
-            {"validator_dst_addr", validatorAddress(input.side_redelegate_order().validator_dst_addr())},
-            {"amount", tokenJSON(input.side_redelegate_order().amount(), true)},
-            {"side_chain_id", input.side_redelegate_order().chain_id()},
-        };
+        const auto& order = input.side_redelegate_order();
+        w.beginObject()
+            .key("type").value("cosmos-sdk/MsgSideChainRedelegate")
+            .key("value").beginObject()
+                .key("amount");
+        tokenJSON(w, order.amount(), true);
+        w.key("delegator_addr").value(addressString(order.delegator_addr()))
+                .key("side_chain_id").value(order.chain_id())
+                .key("validator_dst_addr").value(validatorAddress(order.validator_dst_addr()))
+                .key("validator_src_addr").value(validatorAddress(order.validator_src_addr()))
+            .endObject()
+            .endObject();
     } else if (input.has_side_undelegate_order()) {
-        j["type"] = "cosmos-sdk/MsgSideChainUndelegate";
-        j["value"] = {
-            {"delegator_addr", addressString(input.side_undelegate_order().delegator_addr())},
-            {"validator_addr", validatorAddress(input.side_undelegate_order().validator_addr())},
-            {"amount", tokenJSON(input.side_undelegate_order().amount(), true)},
-            {"side_chain_id", input.side_undelegate_order().chain_id()},
-        };
+        const auto& order = input.side_undelegate_order();
+        w.beginObject()
+            .key("type").value("cosmos-sdk/MsgSideChainUndelegate")
+            .key("value").beginObject()
+                .key("amount");
+        tokenJSON(w, order.amount(), true);
+        w.key("delegator_addr").value(addressString(order.delegator_addr()))
+                .key("side_chain_id").value(order.chain_id())
+                .key("validator_addr").value(validatorAddress(order.validator_addr()))
+            .endObject()
+            .endObject();
     } else if (input.has_time_lock_order()) {
-        j["from"] = addressString(input.time_lock_order().from_address());
-        j["description"] = input.time_lock_order().description();
-        j["amount"] = tokensJSON(input.time_lock_order().amount());
-        j["lock_time"] = input.time_lock_order().lock_time();
+        const auto& order = input.time_lock_order();
+        w.beginObject().key("amount");
+        tokensJSON(w, order.amount());
+        w.key("description").value(order.description())
+            .key("from").value(addressString(order.from_address()))
+            .key("lock_time").value(order.lock_time())
+            .endObject();
     } else if (input.has_time_relock_order()) {
-        const auto amount = input.time_relock_order().amount();
-        j["from"] = addressString(input.time_relock_order().from_address());
-        j["time_lock_id"] = input.time_relock_order().id();
-        j["description"] = input.time_relock_order().description();
+        const auto& order = input.time_relock_order();
+        w.beginObject().key("amount");
         // if amount is empty or omitted, set null to avoid signature verification error
-        j["amount"] = nullptr;
-        if (amount.size() > 0) {
-            j["amount"] = tokensJSON(amount);
+        if (order.amount().size() > 0) {
+            tokensJSON(w, order.amount());
+        } else {
+            w.null();
         }
-        j["lock_time"] = input.time_relock_order().lock_time();
+        w.key("description").value(order.description())
+            .key("from").value(addressString(order.from_address()))
+            .key("lock_time").value(order.lock_time())
+            .key("time_lock_id").value(order.id())
+            .endObject();
     } else if (input.has_time_unlock_order()) {
-        j["from"] = addressString(input.time_unlock_order().from_address());
-        j["time_lock_id"] = input.time_unlock_order().id();
+        const auto& order = input.time_unlock_order();
+        w.beginObject()
+            .key("from").value(addressString(order.from_address()))
+            .key("time_lock_id").value(order.id())
+            .endObject();
+    } else {
+        w.null();
     }
-    return j;
 }
 
-json Binance::inputsJSON(const Proto::SendOrder& order) {
-    json j = json::array();
+void Binance::inputsJSON(CanonicalJSONWriter& w, const Proto::SendOrder& order) {
+    w.beginArray();
     for (auto& input : order.inputs()) {
-        j.push_back({
-            {"address", addressString(input.address())},
-            {"coins", tokensJSON(input.coins())}
-        });
+        w.beginObject()
+            .key("address").value(addressString(input.address()))
+            .key("coins");
+        tokensJSON(w, input.coins());
+        w.endObject();
     }
-    return j;
+    w.endArray();
 }
 
-json Binance::outputsJSON(const Proto::SendOrder& order) {
-    json j = json::array();
+void Binance::outputsJSON(CanonicalJSONWriter& w, const Proto::SendOrder& order) {
+    w.beginArray();
     for (auto& output : order.outputs()) {
-        j.push_back({
-            {"address", addressString(output.address())},
-            {"coins", tokensJSON(output.coins())}
-        });
+        w.beginObject()
+            .key("address").value(addressString(output.address()))
+            .key("coins");
+        tokensJSON(w, output.coins());
+        w.endObject();
     }
-    return j;
+    w.endArray();
 }
 
-json Binance::tokenJSON(const Proto::SendOrder_Token& token, bool stringAmount) {
-    json j = { {"denom", token.denom()} };
+void Binance::tokenJSON(CanonicalJSONWriter& w, const Proto::SendOrder_Token& token, bool stringAmount) {
+    w.beginObject().key("amount");
     if (stringAmount) {
-        j["amount"] = std::to_string(token.amount());
+        w.value(std::to_string(token.amount()));
     } else {
-        j["amount"] = token.amount();
+        w.value(token.amount());
     }
-    return j;
+    w.key("denom").value(token.denom())
+        .endObject();
 }
 
-json Binance::tokensJSON(const RepeatedPtrField<Proto::SendOrder_Token>& tokens) {
-    json j = json::array();
+void Binance::tokensJSON(CanonicalJSONWriter& w, const RepeatedPtrField<Proto::SendOrder_Token>& tokens) {
+    w.beginArray();
     for (auto& token : tokens) {
-        j.push_back(tokenJSON(token));
+        tokenJSON(w, token);
     }
-    return j;
+    w.endArray();
 }
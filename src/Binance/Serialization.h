@@ -7,15 +7,17 @@
 #pragma once
 
 #include "../proto/Binance.pb.h"
-#include <nlohmann/json.hpp>
+#include "../ByteSink.h"
+#include "../CanonicalJSON.h"
 
 namespace TW::Binance {
 
-nlohmann::json signatureJSON(const Proto::SigningInput& input);
-nlohmann::json orderJSON(const Proto::SigningInput& input);
-nlohmann::json inputsJSON(const Proto::SendOrder& order);
-nlohmann::json outputsJSON(const Proto::SendOrder& order);
-nlohmann::json tokenJSON(const Proto::SendOrder_Token& token, bool stringAmount = false);
-nlohmann::json tokensJSON(const ::google::protobuf::RepeatedPtrField<Proto::SendOrder_Token>& tokens);
+/// Writes the sign document, canonical JSON, into the sink.
+void signatureJSON(const Proto::SigningInput& input, ByteSink& sink);
+void orderJSON(CanonicalJSONWriter& writer, const Proto::SigningInput& input);
+void inputsJSON(CanonicalJSONWriter& writer, const Proto::SendOrder& order);
+void outputsJSON(CanonicalJSONWriter& writer, const Proto::SendOrder& order);
+void tokenJSON(CanonicalJSONWriter& writer, const Proto::SendOrder_Token& token, bool stringAmount = false);
+void tokensJSON(CanonicalJSONWriter& writer, const ::google::protobuf::RepeatedPtrField<Proto::SendOrder_Token>& tokens);
 
 } // namespace TW::Binance
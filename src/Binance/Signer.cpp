@@ -6,8 +6,9 @@
 
 #include "Signer.h"
 #include "Serialization.h"
-#include "../Hash.h"
+#include "../ByteSink.h"
 #include "../HexCoding.h"
+#include "../IncrementalHash.h"
 #include "../PrivateKey.h"
 
 #include <google/protobuf/io/coded_stream.h>
@@ -66,14 +67,19 @@ Data Signer::build() const {
 
 Data Signer::sign() const {
     auto key = PrivateKey(input.private_key());
-    auto hash = Hash::sha256(signaturePreimage());
-    auto signature = key.sign(hash, TWCurveSECP256k1);
+    auto hasher = Hash::Sha256();
+    auto sink = HashSink<Hash::Sha256>(hasher);
+    signatureJSON(input, sink);
+    const auto hash = hasher.final();
+    auto signature = key.sign(Data(hash.begin(), hash.end()), TWCurveSECP256k1);
     return Data(signature.begin(), signature.end() - 1);
 }
 
 std::string Signer::signaturePreimage() const {
-    auto json = signatureJSON(input);
-    return json.dump();
+    auto preimage = Data();
+    auto sink = DataSink(preimage);
+    signatureJSON(input, sink);
+    return std::string(preimage.begin(), preimage.end());
 }
 
 Data Signer::encodeTransaction(const Data& signature) const {
@@ -23,6 +23,14 @@ void encode64LE(uint64_t val, vector<uint8_t>& data) {
     data.push_back(static_cast<uint8_t>((val >> 56)));
 }
 
+void encode64LE(uint64_t val, ByteSink& sink) {
+    byte bytes[8];
+    for (auto i = 0; i < 8; ++i) {
+        bytes[i] = static_cast<byte>(val >> (8 * i));
+    }
+    sink.write(bytes, sizeof(bytes));
+}
+
 uint64_t decode64LE(const uint8_t* _Nonnull src) {
     // clang-format off
     return static_cast<uint64_t>(src[0])
@@ -79,6 +87,28 @@ uint8_t encodeVarInt(uint64_t size, vector<uint8_t>& data) {
     return 9;
 }
 
+uint8_t encodeVarInt(uint64_t size, ByteSink& sink) {
+    byte bytes[9];
+    uint8_t length = 9;
+    if (size < 0xfd) {
+        sink.write(static_cast<byte>(size));
+        return 1;
+    } else if (size <= UINT16_MAX) {
+        bytes[0] = 0xfd;
+        length = 3;
+    } else if (size <= UINT32_MAX) {
+        bytes[0] = 0xfe;
+        length = 5;
+    } else {
+        bytes[0] = 0xff;
+    }
+    for (auto i = 1; i < length; ++i) {
+        bytes[i] = static_cast<byte>(size >> (8 * (i - 1)));
+    }
+    sink.write(bytes, length);
+    return length;
+}
+
 tuple<bool, uint64_t> decodeVarInt(const Data& in, size_t& indexInOut) {
     if (in.size() < indexInOut + 1) {
         // too short
@@ -154,4 +184,18 @@ tuple<bool, string>  decodeString(const Data& in, size_t& indexInOut) {
     return make_tuple(true, result);
 }
 
+tuple<bool, vector<pair<size_t, size_t>>> decodeLengthPrefixedRanges(const Data& in) {
+    vector<pair<size_t, size_t>> ranges;
+    size_t index = 0;
+    while (index < in.size()) {
+        if (in.size() - index < 4) { return make_tuple(false, vector<pair<size_t, size_t>>()); }
+        const size_t len = decode32LE(in.data() + index);
+        index += 4;
+        if (in.size() - index < len) { return make_tuple(false, vector<pair<size_t, size_t>>()); }
+        ranges.emplace_back(index, len);
+        index += len;
+    }
+    return make_tuple(true, move(ranges));
+}
+
 } // namespace TW
@@ -6,12 +6,15 @@
 
 #pragma once
 
+#include "ByteSink.h"
 #include "Data.h"
 
 #include <cstddef>
 #include <cstdint>
 #include <vector>
 #include <string>
+#include <tuple>
+#include <utility>
 
 namespace TW {
 
@@ -21,6 +24,12 @@ inline void encode16LE(uint16_t val, std::vector<uint8_t>& data) {
     data.push_back(static_cast<uint8_t>(val >> 8));
 }
 
+/// Encodes a 16-bit little-endian value into the provided sink.
+inline void encode16LE(uint16_t val, ByteSink& sink) {
+    const byte bytes[] = {static_cast<byte>(val), static_cast<byte>(val >> 8)};
+    sink.write(bytes, sizeof(bytes));
+}
+
 /// Decodes a 16-bit little-endian value from the provided buffer.
 inline uint16_t decode16LE(const uint8_t* _Nonnull src) {
     return static_cast<uint16_t>((src[0]) | ((uint16_t)(src[1]) << 8));
@@ -34,6 +43,13 @@ inline void encode32LE(uint32_t val, std::vector<uint8_t>& data) {
     data.push_back(static_cast<uint8_t>((val >> 24)));
 }
 
+/// Encodes a 32-bit little-endian value into the provided sink.
+inline void encode32LE(uint32_t val, ByteSink& sink) {
+    const byte bytes[] = {static_cast<byte>(val), static_cast<byte>(val >> 8), static_cast<byte>(val >> 16),
+                          static_cast<byte>(val >> 24)};
+    sink.write(bytes, sizeof(bytes));
+}
+
 /// Decodes a 32-bit little-endian value from the provided buffer.
 inline uint32_t decode32LE(const uint8_t* _Nonnull src) {
     // clang-format off
@@ -47,6 +63,9 @@ inline uint32_t decode32LE(const uint8_t* _Nonnull src) {
 /// Encodes a 64-bit little-endian value into the provided buffer.
 void encode64LE(uint64_t val, std::vector<uint8_t>& data);
 
+/// Encodes a 64-bit little-endian value into the provided sink.
+void encode64LE(uint64_t val, ByteSink& sink);
+
 /// Decodes a 64-bit little-endian value from the provided buffer.
 uint64_t decode64LE(const uint8_t* _Nonnull src);
 
@@ -64,6 +83,9 @@ uint8_t varIntSize(uint64_t value);
 /// @returns the number of bytes written.
 uint8_t encodeVarInt(uint64_t size, std::vector<uint8_t>& data);
 
+/// Encodes a value as a variable-length integer into the provided sink. See encodeVarInt().
+uint8_t encodeVarInt(uint64_t size, ByteSink& sink);
+
 /// Decodes an integer as a variable-length integer. See encodeVarInt().
 ///
 /// @returns a tuple with a success indicator and the decoded integer.
@@ -111,4 +133,30 @@ void encodeString(const std::string& str, std::vector<uint8_t>& data);
 /// @returns a tuple with a success indicator and the decoded string.
 std::tuple<bool, std::string> decodeString(const Data& in, size_t& indexInOut);
 
+/// Encodes a byte sequence (Data or string) prefixed by its length (32-bit little-endian).
+template <typename T>
+inline void encodeLengthPrefixed(const T& item, std::vector<uint8_t>& data) {
+    encode32LE(static_cast<uint32_t>(item.size()), data);
+    data.insert(data.end(), std::begin(item), std::end(item));
+}
+
+/// Locates the items of a sequence of items, each prefixed by its length (32-bit little-endian), until the end of
+/// the buffer, without copying them.
+/// @returns a tuple with a success indicator and the offset and length of each item in the buffer.
+std::tuple<bool, std::vector<std::pair<size_t, size_t>>> decodeLengthPrefixedRanges(const Data& in);
+
+/// Decodes a sequence of items (Data or std::string), each prefixed by its length (32-bit little-endian), until the end of the buffer.
+/// @returns a tuple with a success indicator and the decoded items.
+template <typename T = Data>
+std::tuple<bool, std::vector<T>> decodeLengthPrefixed(const Data& in) {
+    const auto ranges = decodeLengthPrefixedRanges(in);
+    if (!std::get<0>(ranges)) { return std::make_tuple(false, std::vector<T>()); }
+    std::vector<T> items;
+    items.reserve(std::get<1>(ranges).size());
+    for (const auto& range : std::get<1>(ranges)) {
+        items.emplace_back(in.begin() + range.first, in.begin() + range.first + range.second);
+    }
+    return std::make_tuple(true, std::move(items));
+}
+
 } // namespace TW
@@ -78,6 +78,51 @@ string Entry::deriveAddress(TWCoinType coin, const PublicKey& publicKey, TW::byt
     }
 }
 
+vector<string> Entry::deriveAddresses(TWCoinType coin, const vector<PublicKey>& publicKeys, TW::byte p2pkh, const char* hrp) const {
+    bool segwit = false;
+    switch (coin) {
+        case TWCoinTypeBitcoin:
+        case TWCoinTypeDigiByte:
+        case TWCoinTypeLitecoin:
+        case TWCoinTypeViacoin:
+        case TWCoinTypeBitcoinGold:
+            segwit = true;
+            break;
+
+        case TWCoinTypeBitcoinCash:
+            return CoinEntry::deriveAddresses(coin, publicKeys, p2pkh, hrp);
+
+        default:
+            break;
+    }
+
+    // hash all keys in one batch, then encode
+    vector<Data> keys;
+    keys.reserve(publicKeys.size());
+    for (const auto& publicKey : publicKeys) {
+        if (publicKey.type != TWPublicKeyTypeSECP256k1) {
+            throw std::invalid_argument(segwit ? "SegwitAddress needs a compressed SECP256k1 public key."
+                                               : "Bitcoin::Address needs a compressed SECP256k1 public key.");
+        }
+        keys.push_back(publicKey.bytes);
+    }
+    vector<Data> hashes;
+    Hash::hash160Batch(keys, hashes);
+
+    vector<string> addresses;
+    addresses.reserve(hashes.size());
+    for (auto& hash : hashes) {
+        if (segwit) {
+            addresses.push_back(SegwitAddress(hrp, 0, hash).string());
+        } else {
+            Data payload = {p2pkh};
+            append(payload, hash);
+            addresses.push_back(Address(payload).string());
+        }
+    }
+    return addresses;
+}
+
 void Entry::sign(TWCoinType coin, const TW::Data& dataIn, TW::Data& dataOut) const {
     signTemplate<Signer, Proto::SigningInput>(dataIn, dataOut);
 }
@@ -42,11 +42,12 @@ public:
     }
 };
 
-DefaultFeeCalculator defaultFeeCalculator;
-DecredFeeCalculator decredFeeCalculator;
-SegwitFeeCalculator segwitFeeCalculator;
+// Stateless and immutable, so the shared instances are safe to use from several threads
+const DefaultFeeCalculator defaultFeeCalculator{};
+const DecredFeeCalculator decredFeeCalculator{};
+const SegwitFeeCalculator segwitFeeCalculator{};
 
-FeeCalculator& getFeeCalculator(TWCoinType coinType) {
+const FeeCalculator& getFeeCalculator(TWCoinType coinType) {
     switch (coinType) {
     case TWCoinTypeDecred:
         return decredFeeCalculator;
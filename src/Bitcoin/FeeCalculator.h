@@ -32,6 +32,6 @@ public:
 };
 
 /// Return the fee calculator for the given coin.
-FeeCalculator& getFeeCalculator(TWCoinType coinType);
+const FeeCalculator& getFeeCalculator(TWCoinType coinType);
 
 } // namespace TW::Bitcoin
@@ -14,3 +14,8 @@ void OutPoint::encode(std::vector<uint8_t>& data) const {
     std::copy(std::begin(hash), std::end(hash), std::back_inserter(data));
     encode32LE(index, data);
 }
+
+void OutPoint::encode(ByteSink& sink) const {
+    sink.write(hash);
+    encode32LE(index, sink);
+}
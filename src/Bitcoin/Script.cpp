@@ -31,7 +31,7 @@ using namespace TW;
 using namespace TW::Bitcoin;
 
 Data Script::hash() const {
-    return Hash::ripemd(Hash::sha256(bytes));
+    return Hash::sha256ripemd(bytes.data(), bytes.size());
 }
 
 bool Script::isPayToScriptHash() const {
@@ -63,16 +63,12 @@ bool Script::isWitnessProgram() const {
 bool Script::matchPayToPublicKey(Data& result) const {
     if (bytes.size() == PublicKey::secp256k1ExtendedSize + 2 &&
         bytes[0] == PublicKey::secp256k1ExtendedSize && bytes.back() == OP_CHECKSIG) {
-        result.clear();
-        std::copy(std::begin(bytes) + 1, std::begin(bytes) + 1 + PublicKey::secp256k1Size,
-                  std::back_inserter(result));
+        result.assign(std::begin(bytes) + 1, std::begin(bytes) + 1 + PublicKey::secp256k1Size);
         return true;
     }
     if (bytes.size() == PublicKey::secp256k1Size + 2 && bytes[0] == PublicKey::secp256k1Size &&
         bytes.back() == OP_CHECKSIG) {
-        result.clear();
-        std::copy(std::begin(bytes) + 1, std::begin(bytes) + 1 + PublicKey::secp256k1Size,
-                  std::back_inserter(result));
+        result.assign(std::begin(bytes) + 1, std::begin(bytes) + 1 + PublicKey::secp256k1Size);
         return true;
     }
     return false;
@@ -81,8 +77,7 @@ bool Script::matchPayToPublicKey(Data& result) const {
 bool Script::matchPayToPublicKeyHash(Data& result) const {
     if (bytes.size() == 25 && bytes[0] == OP_DUP && bytes[1] == OP_HASH160 && bytes[2] == 20 &&
         bytes[23] == OP_EQUALVERIFY && bytes[24] == OP_CHECKSIG) {
-        result.clear();
-        std::copy(std::begin(bytes) + 3, std::begin(bytes) + 3 + 20, std::back_inserter(result));
+        result.assign(std::begin(bytes) + 3, std::begin(bytes) + 3 + 20);
         return true;
     }
     return false;
@@ -92,8 +87,7 @@ bool Script::matchPayToScriptHash(Data& result) const {
     if (!isPayToScriptHash()) {
         return false;
     }
-    result.clear();
-    std::copy(std::begin(bytes) + 2, std::begin(bytes) + 22, std::back_inserter(result));
+    result.assign(std::begin(bytes) + 2, std::begin(bytes) + 22);
     return true;
 }
 
@@ -101,8 +95,7 @@ bool Script::matchPayToWitnessPublicKeyHash(Data& result) const {
     if (!isPayToWitnessPublicKeyHash()) {
         return false;
     }
-    result.clear();
-    std::copy(std::begin(bytes) + 2, std::end(bytes), std::back_inserter(result));
+    result.assign(std::begin(bytes) + 2, std::end(bytes));
     return true;
 }
 
@@ -110,8 +103,7 @@ bool Script::matchPayToWitnessScriptHash(Data& result) const {
     if (!isPayToWitnessScriptHash()) {
         return false;
     }
-    result.clear();
-    std::copy(std::begin(bytes) + 2, std::end(bytes), std::back_inserter(result));
+    result.assign(std::begin(bytes) + 2, std::end(bytes));
     return true;
 }
 
@@ -208,6 +200,7 @@ bool Script::getScriptOp(size_t& index, uint8_t& opcode, Data& operand) const {
 Script Script::buildPayToPublicKeyHash(const Data& hash) {
     assert(hash.size() == 20);
     Script script;
+    script.bytes.reserve(25);
     script.bytes.push_back(OP_DUP);
     script.bytes.push_back(OP_HASH160);
     script.bytes.push_back(20);
@@ -220,6 +213,7 @@ Script Script::buildPayToPublicKeyHash(const Data& hash) {
 Script Script::buildPayToScriptHash(const Data& scriptHash) {
     assert(scriptHash.size() == 20);
     Script script;
+    script.bytes.reserve(23);
     script.bytes.push_back(OP_HASH160);
     script.bytes.push_back(20);
     script.bytes.insert(script.bytes.end(), scriptHash.begin(), scriptHash.end());
@@ -230,6 +224,7 @@ Script Script::buildPayToScriptHash(const Data& scriptHash) {
 Script Script::buildPayToWitnessProgram(const Data& program) {
     assert(program.size() == 20 || program.size() == 32);
     Script script;
+    script.bytes.reserve(2 + program.size());
     script.bytes.push_back(OP_0);
     script.bytes.push_back(static_cast<byte>(program.size()));
     script.bytes.insert(script.bytes.end(), program.begin(), program.end());
@@ -249,7 +244,12 @@ Script Script::buildPayToWitnessScriptHash(const Data& scriptHash) {
 
 void Script::encode(Data& data) const {
     encodeVarInt(bytes.size(), data);
-    std::copy(std::begin(bytes), std::end(bytes), std::back_inserter(data));
+    data.insert(data.end(), bytes.begin(), bytes.end());
+}
+
+void Script::encode(ByteSink& sink) const {
+    encodeVarInt(bytes.size(), sink);
+    sink.write(bytes);
 }
 
 Script Script::lockScriptForAddress(const std::string& string, enum TWCoinType coin) {
@@ -280,7 +280,7 @@ Script Script::lockScriptForAddress(const std::string& string, enum TWCoinType c
         auto bitcoinAddress = address.legacyAddress();
         return lockScriptForAddress(bitcoinAddress.string(), TWCoinTypeBitcoinCash);
     } else if (Decred::Address::isValid(string)) {
-        auto bytes = Base58::bitcoin.decodeCheck(string, Hash::blake256d);
+        auto bytes = Base58::bitcoin.decodeCheck<Hash::Algorithm::blake256d>(string);
         if (bytes[1] == TW::p2pkhPrefix(TWCoinTypeDecred)) {
             return buildPayToPublicKeyHash(Data(bytes.begin() + 2, bytes.end()));
         }
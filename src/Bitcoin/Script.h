@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "../ByteSink.h"
 #include "../Data.h"
 
 #include "OpCodes.h"
@@ -91,6 +92,9 @@ class Script {
     /// Encodes the script.
     void encode(Data& data) const;
 
+    /// Encodes the script into the provided sink.
+    void encode(ByteSink& sink) const;
+
     /// Encodes a small integer
     static inline uint8_t encodeNumber(int n) {
         assert(n >= 0 && n <= 16);
@@ -15,13 +15,13 @@ using namespace TW;
 using namespace TW::Bitcoin;
 
 Proto::TransactionPlan Signer::plan(const Proto::SigningInput& input) noexcept {
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     return signer.plan.proto();
 }
 
 Proto::SigningOutput Signer::sign(const Proto::SigningInput &input) noexcept {
     Proto::SigningOutput output;
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
     if (!result) {
         output.set_error(result.error());
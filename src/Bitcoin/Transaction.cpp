@@ -9,98 +9,126 @@
 #include "SigHashType.h"
 #include "../BinaryCoding.h"
 #include "../Hash.h"
+#include "../IncrementalHash.h"
 #include "../Data.h"
 
 #include "SignatureVersion.h"
 
+#include <array>
 #include <cassert>
+#include <stdexcept>
 
 using namespace TW;
 using namespace TW::Bitcoin;
 
+namespace {
+
+/// Placeholder for hashes left out of the pre-image.
+const std::array<byte, 32> zeroHash = {};
+
+/// Streams what `encode` writes into a hasher of type `H`.
+template <typename H, typename F>
+Data hashStream(F encode) {
+    H hasher;
+    HashSink<H> sink(hasher);
+    encode(sink);
+    const auto hash = hasher.final();
+    return Data(hash.begin(), hash.end());
+}
+
+/// Hashes what `encode` writes with the transaction hash function.
+template <typename F>
+Data hashEncoded(Hash::Algorithm hasher, F encode) {
+    switch (hasher) {
+    case Hash::Algorithm::sha256d:
+        return hashStream<Hash::Sha256d>(encode);
+    case Hash::Algorithm::sha256:
+        return hashStream<Hash::Sha256>(encode);
+    default:
+        throw std::invalid_argument("Unsupported transaction hash function");
+    }
+}
+
+} // namespace
+
 Data Transaction::getPreImage(const Script& scriptCode, size_t index,
                               enum TWBitcoinSigHashType hashType, uint64_t amount) const {
-    assert(index < inputs.size());
-
     Data data;
+    DataSink sink(data);
+    encodePreImage(scriptCode, index, hashType, amount, sink);
+    return data;
+}
+
+void Transaction::encodePreImage(const Script& scriptCode, size_t index,
+                                 enum TWBitcoinSigHashType hashType, uint64_t amount, ByteSink& sink) const {
+    assert(index < inputs.size());
 
     // Version
-    encode32LE(version, data);
+    encode32LE(version, sink);
 
     // Input prevouts (none/all, depending on flags)
     if ((hashType & TWBitcoinSigHashTypeAnyoneCanPay) == 0) {
-        auto hashPrevouts = getPrevoutHash();
-        std::copy(std::begin(hashPrevouts), std::end(hashPrevouts), std::back_inserter(data));
+        sink.write(getPrevoutHash());
     } else {
-        std::fill_n(back_inserter(data), 32, 0);
+        sink.write(zeroHash);
     }
 
     // Input nSequence (none/all, depending on flags)
     if ((hashType & TWBitcoinSigHashTypeAnyoneCanPay) == 0 &&
         !hashTypeIsSingle(hashType) && !hashTypeIsNone(hashType)) {
-        auto hashSequence = getSequenceHash();
-        std::copy(std::begin(hashSequence), std::end(hashSequence), std::back_inserter(data));
+        sink.write(getSequenceHash());
     } else {
-        std::fill_n(back_inserter(data), 32, 0);
+        sink.write(zeroHash);
     }
 
     // The input being signed (replacing the scriptSig with scriptCode + amount)
     // The prevout may already be contained in hashPrevout, and the nSequence
     // may already be contain in hashSequence.
-    reinterpret_cast<const OutPoint&>(inputs[index].previousOutput).encode(data);
-    scriptCode.encode(data);
+    reinterpret_cast<const OutPoint&>(inputs[index].previousOutput).encode(sink);
+    scriptCode.encode(sink);
 
-    encode64LE(amount, data);
-    encode32LE(inputs[index].sequence, data);
+    encode64LE(amount, sink);
+    encode32LE(inputs[index].sequence, sink);
 
     // Outputs (none/one/all, depending on flags)
     if (!hashTypeIsSingle(hashType) && !hashTypeIsNone(hashType)) {
-        auto hashOutputs = getOutputsHash();
-        copy(begin(hashOutputs), end(hashOutputs), back_inserter(data));
+        sink.write(getOutputsHash());
     } else if (hashTypeIsSingle(hashType) && index < outputs.size()) {
-        Data outputData;
-        outputs[index].encode(outputData);
-        auto hashOutputs = Hash::hash(hasher, outputData);
-        copy(begin(hashOutputs), end(hashOutputs), back_inserter(data));
+        sink.write(hashEncoded(hasher, [&](ByteSink& output) { outputs[index].encode(output); }));
     } else {
-        fill_n(back_inserter(data), 32, 0);
+        sink.write(zeroHash);
     }
 
     // Locktime
-    encode32LE(lockTime, data);
+    encode32LE(lockTime, sink);
 
     // Sighash type
-    encode32LE(hashType, data);
-
-    return data;
+    encode32LE(hashType, sink);
 }
 
 Data Transaction::getPrevoutHash() const {
-    Data data;
-    for (auto& input : inputs) {
-        auto& outpoint = reinterpret_cast<const OutPoint&>(input.previousOutput);
-        outpoint.encode(data);
-    }
-    auto hash = Hash::hash(hasher, data);
-    return hash;
+    return hashEncoded(hasher, [&](ByteSink& sink) {
+        for (auto& input : inputs) {
+            auto& outpoint = reinterpret_cast<const OutPoint&>(input.previousOutput);
+            outpoint.encode(sink);
+        }
+    });
 }
 
 Data Transaction::getSequenceHash() const {
-    Data data;
-    for (auto& input : inputs) {
-        encode32LE(input.sequence, data);
-    }
-    auto hash = Hash::hash(hasher, data);
-    return hash;
+    return hashEncoded(hasher, [&](ByteSink& sink) {
+        for (auto& input : inputs) {
+            encode32LE(input.sequence, sink);
+        }
+    });
 }
 
 Data Transaction::getOutputsHash() const {
-    Data data;
-    for (auto& output : outputs) {
-        output.encode(data);
-    }
-    auto hash = Hash::hash(hasher, data);
-    return hash;
+    return hashEncoded(hasher, [&](ByteSink& sink) {
+        for (auto& output : outputs) {
+            output.encode(sink);
+        }
+    });
 }
 
 void Transaction::encode(Data& data, enum SegwitFormatMode segwitFormat) const {
@@ -163,74 +191,82 @@ Data Transaction::getSignatureHash(const Script& scriptCode, size_t index,
 Data Transaction::getSignatureHashWitnessV0(const Script& scriptCode, size_t index,
                                             enum TWBitcoinSigHashType hashType,
                                             uint64_t amount) const {
-    auto preimage = getPreImage(scriptCode, index, hashType, amount);
-    auto hash = Hash::hash(hasher, preimage);
-    return hash;
+    return hashEncoded(hasher, [&](ByteSink& sink) {
+        encodePreImage(scriptCode, index, hashType, amount, sink);
+    });
 }
 
 /// Generates the signature hash for for scripts other than witness scripts.
 Data Transaction::getSignatureHashBase(const Script& scriptCode, size_t index,
                                        enum TWBitcoinSigHashType hashType) const {
-    assert(index < inputs.size());
+    return hashEncoded(hasher, [&](ByteSink& sink) {
+        encodeSignatureBase(scriptCode, index, hashType, sink);
+    });
+}
 
-    Data data;
+void Transaction::encodeSignatureBase(const Script& scriptCode, size_t index,
+                                      enum TWBitcoinSigHashType hashType, ByteSink& sink) const {
+    assert(index < inputs.size());
 
-    encode32LE(version, data);
+    encode32LE(version, sink);
 
     auto serializedInputCount =
         (hashType & TWBitcoinSigHashTypeAnyoneCanPay) != 0 ? 1 : inputs.size();
-    encodeVarInt(serializedInputCount, data);
+    encodeVarInt(serializedInputCount, sink);
     for (auto subindex = 0; subindex < serializedInputCount; subindex += 1) {
-        serializeInput(subindex, scriptCode, index, hashType, data);
+        serializeInput(subindex, scriptCode, index, hashType, sink);
     }
 
     auto hashNone = hashTypeIsNone(hashType);
     auto hashSingle = hashTypeIsSingle(hashType);
     auto serializedOutputCount = hashNone ? 0 : (hashSingle ? index + 1 : outputs.size());
-    encodeVarInt(serializedOutputCount, data);
+    encodeVarInt(serializedOutputCount, sink);
     for (auto subindex = 0; subindex < serializedOutputCount; subindex += 1) {
         if (hashSingle && subindex != index) {
             auto output = TransactionOutput(-1, {});
-            output.encode(data);
+            output.encode(sink);
         } else {
-            outputs[subindex].encode(data);
+            outputs[subindex].encode(sink);
         }
     }
 
     // Locktime
-    encode32LE(lockTime, data);
+    encode32LE(lockTime, sink);
 
     // Sighash type
-    encode32LE(hashType, data);
-
-    auto hash = Hash::hash(hasher, data);
-    return hash;
+    encode32LE(hashType, sink);
 }
 
 void Transaction::serializeInput(size_t subindex, const Script& scriptCode, size_t index,
                                  enum TWBitcoinSigHashType hashType, Data& data) const {
+    DataSink sink(data);
+    serializeInput(subindex, scriptCode, index, hashType, sink);
+}
+
+void Transaction::serializeInput(size_t subindex, const Script& scriptCode, size_t index,
+                                 enum TWBitcoinSigHashType hashType, ByteSink& sink) const {
     // In case of SIGHASH_ANYONECANPAY, only the input being signed is
     // serialized
     if ((hashType & TWBitcoinSigHashTypeAnyoneCanPay) != 0) {
         subindex = index;
     }
 
-    reinterpret_cast<const OutPoint&>(inputs[subindex].previousOutput).encode(data);
+    reinterpret_cast<const OutPoint&>(inputs[subindex].previousOutput).encode(sink);
 
     // Serialize the script
     if (subindex != index) {
-        encodeVarInt(0, data);
+        encodeVarInt(0, sink);
     } else {
-        scriptCode.encode(data);
+        scriptCode.encode(sink);
     }
 
     // Serialize the nSequence
     auto hashNone = hashTypeIsNone(hashType);
     auto hashSingle = hashTypeIsSingle(hashType);
     if (subindex != index && (hashSingle || hashNone)) {
-        encode32LE(0, data);
+        encode32LE(0, sink);
     } else {
-        encode32LE(inputs[subindex].sequence, data);
+        encode32LE(inputs[subindex].sequence, sink);
     }
 }
 
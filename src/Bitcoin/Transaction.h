@@ -10,6 +10,7 @@
 #include "Script.h"
 #include "TransactionInput.h"
 #include "TransactionOutput.h"
+#include "../ByteSink.h"
 #include "../Hash.h"
 #include "../Data.h"
 
@@ -41,7 +42,8 @@ public:
     /// A list of 1 or more transaction outputs or destinations for coins
     std::vector<TransactionOutput> outputs;
 
-    TW::Hash::Hasher hasher = TW::Hash::sha256d;
+    /// Hash function for signature hashes: double SHA256, or single SHA256 for Groestlcoin.
+    TW::Hash::Algorithm hasher = TW::Hash::Algorithm::sha256d;
 
     /// Used for diagnostics; store previously estimated virtual size (if any; size in bytes)
     int previousEstimatedVirtualSize = 0;
@@ -49,7 +51,7 @@ public:
 public:
     Transaction() = default;
 
-    Transaction(int32_t version, uint32_t lockTime, TW::Hash::Hasher hasher = TW::Hash::sha256d)
+    Transaction(int32_t version, uint32_t lockTime, TW::Hash::Algorithm hasher = TW::Hash::Algorithm::sha256d)
         : version(version), lockTime(lockTime), inputs(), outputs(), hasher(hasher) {}
 
     /// Whether the transaction is empty.
@@ -57,6 +59,9 @@ public:
 
     /// Generates the signature pre-image.
     Data getPreImage(const Script& scriptCode, size_t index, enum TWBitcoinSigHashType hashType, uint64_t amount) const;
+
+    /// Encodes the signature pre-image into the provided sink.
+    void encodePreImage(const Script& scriptCode, size_t index, enum TWBitcoinSigHashType hashType, uint64_t amount, ByteSink& sink) const;
     Data getPrevoutHash() const;
     Data getSequenceHash() const;
     Data getOutputsHash() const;
@@ -83,6 +88,7 @@ public:
                           uint64_t amount, enum SignatureVersion version) const;
 
     void serializeInput(size_t subindex, const Script&, size_t index, enum TWBitcoinSigHashType hashType, Data& data) const;
+    void serializeInput(size_t subindex, const Script&, size_t index, enum TWBitcoinSigHashType hashType, ByteSink& sink) const;
 
     /// Converts to Protobuf model
     Proto::Transaction proto() const;
@@ -95,6 +101,10 @@ private:
     /// Generates the signature hash for for scripts other than witness scripts.
     Data getSignatureHashBase(const Script& scriptCode, size_t index,
                               enum TWBitcoinSigHashType hashType) const;
+
+    /// Encodes the legacy signature pre-image into the provided sink.
+    void encodeSignatureBase(const Script& scriptCode, size_t index,
+                             enum TWBitcoinSigHashType hashType, ByteSink& sink) const;
 };
 
 } // namespace TW::Bitcoin
@@ -8,6 +8,7 @@
 #include "TransactionSigner.h"
 
 #include "../Coin.h"
+#include "../Instrumentation.h"
 #include "../proto/Bitcoin.pb.h"
 
 #include <algorithm>
@@ -22,17 +23,15 @@ int64_t estimateSimpleFee(const FeeCalculator& feeCalculator, const TransactionP
 
 /// Estimate encoded size by invoking sign(sizeOnly), get actual size
 int64_t estimateSegwitFee(const FeeCalculator& feeCalculator, const TransactionPlan& plan, int outputSize, const Bitcoin::Proto::SigningInput& input) {
+    TW_INSTRUMENT_STAGE(feeEstimation);
     TWPurpose coinPurpose = TW::purpose(static_cast<TWCoinType>(input.coin_type()));
     if (coinPurpose != TWPurposeBIP84) {
         // not segwit, return default simple estimate
         return estimateSimpleFee(feeCalculator, plan, outputSize, input.byte_fee());
     }
 
-    // duplicate input, with the current plan
-    auto inputWithPlan = std::move(input);
-    *inputWithPlan.mutable_plan() = plan.proto();
-
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(inputWithPlan), true);
+    // sign with the current plan
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input, plan, true);
     auto result = signer.sign();
     if (!result) {
         // signing failed; return default simple estimate
@@ -40,7 +39,7 @@ int64_t estimateSegwitFee(const FeeCalculator& feeCalculator, const TransactionP
     }
 
     // Obtain the encoded size
-    auto transaction = result.payload();
+    const auto transaction = std::move(result).payload();
     Data dataNonSegwit;
     transaction.encode(dataNonSegwit, Transaction::SegwitFormatMode::NonSegwit);
     int64_t sizeNonSegwit = dataNonSegwit.size();
@@ -63,6 +62,7 @@ int64_t estimateSegwitFee(const FeeCalculator& feeCalculator, const TransactionP
 }
 
 TransactionPlan TransactionBuilder::plan(const Bitcoin::Proto::SigningInput& input) {
+    TW_INSTRUMENT_STAGE(bitcoinPlan);
     auto plan = TransactionPlan();
 
     const auto& feeCalculator = getFeeCalculator(static_cast<TWCoinType>(input.coin_type()));
@@ -84,12 +84,15 @@ TransactionPlan TransactionBuilder::plan(const Bitcoin::Proto::SigningInput& inp
         }
 
         auto output_size = 2;
-        if (!maxAmount) {
-            output_size = 2; // output + change
-            plan.utxos = unspentSelector.select(input.utxo(), plan.amount, input.byte_fee(), output_size);
-        } else {
-            output_size = 1; // no change
-            plan.utxos = unspentSelector.selectMaxAmount(input.utxo(), input.byte_fee());
+        {
+            TW_INSTRUMENT_STAGE(utxoSelection);
+            if (!maxAmount) {
+                output_size = 2; // output + change
+                plan.utxos = unspentSelector.select(input.utxo(), plan.amount, input.byte_fee(), output_size);
+            } else {
+                output_size = 1; // no change
+                plan.utxos = unspentSelector.selectMaxAmount(input.utxo(), input.byte_fee());
+            }
         }
 
         if (plan.utxos.size() == 0) {
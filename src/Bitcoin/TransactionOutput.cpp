@@ -14,3 +14,8 @@ void TransactionOutput::encode(std::vector<uint8_t>& data) const {
     encode64LE(value, data);
     script.encode(data);
 }
+
+void TransactionOutput::encode(ByteSink& sink) const {
+    encode64LE(value, sink);
+    script.encode(sink);
+}
@@ -30,6 +30,9 @@ struct TransactionOutput {
 
     /// Encodes the output into the provided buffer.
     void encode(std::vector<uint8_t>& data) const;
+
+    /// Encodes the output into the provided sink.
+    void encode(ByteSink& sink) const;
 };
 
 } // namespace TW::Bitcoin
@@ -15,6 +15,7 @@
 #include "../BinaryCoding.h"
 #include "../Hash.h"
 #include "../HexCoding.h"
+#include "../Instrumentation.h"
 #include "../Zcash/Transaction.h"
 #include "../Groestlcoin/Transaction.h"
 #include <tuple>
@@ -22,8 +23,22 @@
 using namespace TW;
 using namespace TW::Bitcoin;
 
+namespace {
+
+/// Moves the given items into a new list; an initializer list would copy them.
+template <typename... Items>
+std::vector<Data> makeResults(Items&&... items) {
+    std::vector<Data> results;
+    results.reserve(sizeof...(items));
+    (results.emplace_back(std::forward<Items>(items)), ...);
+    return results;
+}
+
+} // namespace
+
 template <typename Transaction, typename TransactionBuilder>
 Result<Transaction, Common::Proto::SigningError> TransactionSigner<Transaction, TransactionBuilder>::sign() {
+    TW_INSTRUMENT_STAGE(bitcoinSign);
     if (plan.error != Common::Proto::OK) {
         // plan with error, fail
         return Result<Transaction, Common::Proto::SigningError>::failure(plan.error);
@@ -32,9 +47,7 @@ Result<Transaction, Common::Proto::SigningError> TransactionSigner<Transaction,
         return Result<Transaction, Common::Proto::SigningError>::failure(Common::Proto::Error_missing_input_utxos);
     }
 
-    signedInputs.clear();
-    std::copy(std::begin(transaction.inputs), std::end(transaction.inputs),
-              std::back_inserter(signedInputs));
+    signedInputs = transaction.inputs;
 
     const auto hashSingle = hashTypeIsSingle(static_cast<enum TWBitcoinSigHashType>(input.hash_type()));
     for (auto i = 0; i < plan.utxos.size(); i++) {
@@ -45,16 +58,18 @@ Result<Transaction, Common::Proto::SigningError> TransactionSigner<Transaction,
         auto& utxo = plan.utxos[i];
         auto script = Script(utxo.script().begin(), utxo.script().end());
         if (i < transaction.inputs.size()) {
-            auto result = sign(script, i, utxo);
+            auto result = sign(std::move(script), i, utxo);
             if (!result) {
                 return Result<Transaction, Common::Proto::SigningError>::failure(result.error());
             }
         }
     }
 
+    // copy the transaction without its unsigned inputs, which are replaced by the signed ones
+    auto unsignedInputs = std::move(transaction.inputs);
     Transaction tx(transaction);
-    tx.inputs = move(signedInputs);
-    tx.outputs = transaction.outputs;
+    transaction.inputs = std::move(unsignedInputs);
+    tx.inputs = std::move(signedInputs);
     // save estimated size
     if ((input.byte_fee()) > 0 && (plan.fee > 0)) {
         tx.previousEstimatedVirtualSize = static_cast<int>(plan.fee / input.byte_fee());
@@ -82,9 +97,9 @@ Result<void, Common::Proto::SigningError> TransactionSigner<Transaction, Transac
     if (!result) {
         return Result<void, Common::Proto::SigningError>::failure(result.error());
     }
-    results = result.payload();
+    results = std::move(result).payload();
     assert(results.size() >= 1);
-    auto txin = transaction.inputs[index];
+    const auto& txin = transaction.inputs[index];
 
     if (script.isPayToScriptHash()) {
         script = Script(results[0]);
@@ -92,28 +107,27 @@ Result<void, Common::Proto::SigningError> TransactionSigner<Transaction, Transac
         if (!result) {
             return Result<void, Common::Proto::SigningError>::failure(result.error());
         }
-        results = result.payload();
+        results = std::move(result).payload();
         results.push_back(script.bytes);
         redeemScript = script;
     }
 
     std::vector<Data> witnessStack;
-    Data data;
-    if (script.matchPayToWitnessPublicKeyHash(data)) {
+    if (script.isPayToWitnessPublicKeyHash()) {
         auto witnessScript = Script::buildPayToPublicKeyHash(results[0]);
         auto result = signStep(witnessScript, index, utxo, WITNESS_V0);
         if (!result) {
             return Result<void, Common::Proto::SigningError>::failure(result.error());
         }
-        witnessStack = result.payload();
+        witnessStack = std::move(result).payload();
         results.clear();
-    } else if (script.matchPayToWitnessScriptHash(data)) {
+    } else if (script.isPayToWitnessScriptHash()) {
         auto witnessScript = Script(results[0]);
         auto result = signStep(witnessScript, index, utxo, WITNESS_V0);
         if (!result) {
             return Result<void, Common::Proto::SigningError>::failure(result.error());
         }
-        witnessStack = result.payload();
+        witnessStack = std::move(result).payload();
         witnessStack.push_back(move(witnessScript.bytes));
         results.clear();
     } else if (script.isWitnessProgram()) {
@@ -127,17 +141,15 @@ Result<void, Common::Proto::SigningError> TransactionSigner<Transaction, Transac
 
     signedInputs[index] =
         TransactionInput(txin.previousOutput, Script(pushAll(results)), txin.sequence);
-    signedInputs[index].scriptWitness = witnessStack;
+    signedInputs[index].scriptWitness = std::move(witnessStack);
     return Result<void, Common::Proto::SigningError>::success();
 }
 
 template <typename Transaction, typename TransactionBuilder>
 Result<std::vector<Data>, Common::Proto::SigningError> TransactionSigner<Transaction, TransactionBuilder>::signStep(
-    Script script, size_t index, const Proto::UnspentTransaction& utxo, uint32_t version) const {
-    Transaction transactionToSign(transaction);
-    transactionToSign.inputs = signedInputs;
-    transactionToSign.outputs = transaction.outputs;
-
+    const Script& script, size_t index, const Proto::UnspentTransaction& utxo, uint32_t version) const {
+    // Signature hashes never cover the scripts of other inputs, so the unsigned transaction
+    // is hashed as is instead of a copy carrying the inputs signed so far.
     Data data;
     std::vector<Data> keys;
     int required;
@@ -148,7 +160,7 @@ Result<std::vector<Data>, Common::Proto::SigningError> TransactionSigner<Transac
             // Error: Missing redeem script
             return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_script_redeem);
         }
-        return Result<std::vector<Data>, Common::Proto::SigningError>::success({redeemScript});
+        return Result<std::vector<Data>, Common::Proto::SigningError>::success(makeResults(std::move(redeemScript)));
     }
     if (script.matchPayToWitnessScriptHash(data)) {
         auto scripthash = Hash::ripemd(data);
@@ -157,10 +169,10 @@ Result<std::vector<Data>, Common::Proto::SigningError> TransactionSigner<Transac
             // Error: Missing redeem script
             return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_script_redeem);
         }
-        return Result<std::vector<Data>, Common::Proto::SigningError>::success({redeemScript});
+        return Result<std::vector<Data>, Common::Proto::SigningError>::success(makeResults(std::move(redeemScript)));
     }
     if (script.matchPayToWitnessPublicKeyHash(data)) {
-        return Result<std::vector<Data>, Common::Proto::SigningError>::success({data});
+        return Result<std::vector<Data>, Common::Proto::SigningError>::success(makeResults(std::move(data)));
     }
     if (script.isWitnessProgram()) {
         // Error: Invalid sutput script
@@ -172,13 +184,13 @@ Result<std::vector<Data>, Common::Proto::SigningError> TransactionSigner<Transac
             if (results.size() >= required + 1) {
                 break;
             }
-            auto keyHash = Hash::ripemd(Hash::sha256(pubKey));
+            auto keyHash = Hash::sha256ripemd(pubKey.data(), pubKey.size());
             auto pair = keyPairForPubKeyHash(keyHash);
             if (!pair.has_value() && !estimationMode) {
                 // Error: missing key
                 return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_missing_private_key);
             }
-            auto signature = createSignature(transactionToSign, script, pair, index, utxo.amount(), version);
+            auto signature = createSignature(transaction, script, pair, index, utxo.amount(), version);
             if (signature.empty()) {
                 // Error: Failed to sign
                 return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_signing);
@@ -189,18 +201,18 @@ Result<std::vector<Data>, Common::Proto::SigningError> TransactionSigner<Transac
         return Result<std::vector<Data>, Common::Proto::SigningError>::success(std::move(results));
     }
     if (script.matchPayToPublicKey(data)) {
-        auto keyHash = Hash::ripemd(Hash::sha256(data));
+        auto keyHash = Hash::sha256ripemd(data.data(), data.size());
         auto pair = keyPairForPubKeyHash(keyHash);
         if (!pair.has_value() && !estimationMode) {
             // Error: Missing key
             return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_missing_private_key);
         }
-        auto signature = createSignature(transactionToSign, script, pair, index, utxo.amount(), version);
+        auto signature = createSignature(transaction, script, pair, index, utxo.amount(), version);
         if (signature.empty()) {
             // Error: Failed to sign
             return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_signing);
         }
-        return Result<std::vector<Data>, Common::Proto::SigningError>::success({signature});
+        return Result<std::vector<Data>, Common::Proto::SigningError>::success(makeResults(std::move(signature)));
     }
     if (script.matchPayToPublicKeyHash(data)) {
         auto pair = keyPairForPubKeyHash(data);
@@ -208,17 +220,17 @@ Result<std::vector<Data>, Common::Proto::SigningError> TransactionSigner<Transac
             // Error: Missing keys
             return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_missing_private_key);
         }
-        auto signature = createSignature(transactionToSign, script, pair, index, utxo.amount(), version);
+        auto signature = createSignature(transaction, script, pair, index, utxo.amount(), version);
         if (signature.empty()) {
             // Error: Failed to sign
             return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_signing);
         }
         if (!pair.has_value() && estimationMode) {
             // estimation mode, key is missing: use placeholder for public key
-            return Result<std::vector<Data>, Common::Proto::SigningError>::success({signature, Data(PublicKey::secp256k1Size)});
+            return Result<std::vector<Data>, Common::Proto::SigningError>::success(makeResults(std::move(signature), Data(PublicKey::secp256k1Size)));
         }
         auto pubkey = std::get<1>(pair.value());
-        return Result<std::vector<Data>, Common::Proto::SigningError>::success({signature, pubkey.bytes});
+        return Result<std::vector<Data>, Common::Proto::SigningError>::success(makeResults(std::move(signature), pubkey.bytes));
     }
     // Error: Invalid output script
     return Result<std::vector<Data>, Common::Proto::SigningError>::failure(Common::Proto::Error_script_output);
@@ -238,8 +250,13 @@ Data TransactionSigner<Transaction, TransactionBuilder>::createSignature(
         return Data(72);
     }
     auto key = std::get<0>(pair.value());
-    Data sighash = transaction.getSignatureHash(script, index, static_cast<TWBitcoinSigHashType>(input.hash_type()), amount,
-                                                static_cast<SignatureVersion>(version));
+    Data sighash;
+    {
+        TW_INSTRUMENT_STAGE(sighash);
+        sighash = transaction.getSignatureHash(script, index, static_cast<TWBitcoinSigHashType>(input.hash_type()), amount,
+                                               static_cast<SignatureVersion>(version));
+    }
+    TW_INSTRUMENT_STAGE(ecSign);
     auto pk = PrivateKey(key);
     auto sig = pk.signAsDER(sighash, TWCurveSECP256k1);
     if (!sig.empty()) {
@@ -275,14 +292,23 @@ Data TransactionSigner<Transaction, TransactionBuilder>::pushAll(const std::vect
 
 template <typename Transaction, typename TransactionBuilder>
 std::optional<KeyPair> TransactionSigner<Transaction, TransactionBuilder>::keyPairForPubKeyHash(const Data& hash) const {
-    for (auto& key : input.private_key()) {
-        auto privKey = PrivateKey(key);
-        auto pubKeyExtended = privKey.getPublicKey(TWPublicKeyTypeSECP256k1Extended);
-        auto pubKey = pubKeyExtended.compressed();
-        if (Hash::sha256ripemd(pubKey.bytes.data(), pubKey.bytes.size()) == hash) {
-            return std::make_tuple(privKey, pubKey);
-        } else if (Hash::sha256ripemd(pubKeyExtended.bytes.data(), pubKeyExtended.bytes.size()) == hash) {
-            return std::make_tuple(privKey, pubKeyExtended);
+    if (keyPairs.empty()) {
+        // Hash all candidate public keys in one batch; compressed form is checked first
+        std::vector<Data> pubKeys;
+        for (auto& key : input.private_key()) {
+            auto privKey = PrivateKey(key);
+            auto pubKeyExtended = privKey.getPublicKey(TWPublicKeyTypeSECP256k1Extended);
+            auto pubKey = pubKeyExtended.compressed();
+            pubKeys.push_back(pubKey.bytes);
+            pubKeys.push_back(pubKeyExtended.bytes);
+            keyPairs.emplace_back(privKey, pubKey);
+            keyPairs.emplace_back(privKey, pubKeyExtended);
+        }
+        Hash::hash160Batch(pubKeys, keyPairHashes);
+    }
+    for (size_t i = 0; i < keyPairs.size(); ++i) {
+        if (keyPairHashes[i] == hash) {
+            return keyPairs[i];
         }
     }
     return {};
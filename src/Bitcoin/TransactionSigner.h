@@ -31,8 +31,8 @@ namespace TW::Bitcoin {
 template <typename Transaction, typename TransactionBuilder>
 class TransactionSigner {
   private:
-    /// Private key and redeem script provider for signing.
-    Proto::SigningInput input;
+    /// Private key and redeem script provider for signing; it must outlive the signer.
+    const Proto::SigningInput& input;
 
   public:
     /// Transaction plan.
@@ -47,21 +47,30 @@ class TransactionSigner {
 
     bool estimationMode = false;
 
+    /// Signing key pairs (compressed and extended public key of each private key), built on first lookup.
+    mutable std::vector<KeyPair> keyPairs;
+
+    /// Public key hashes of `keyPairs`, in the same order.
+    mutable std::vector<Data> keyPairHashes;
+
   public:
-    /// Initializes a transaction signer with signing input.
+    /// Initializes a transaction signer with signing input, which is referenced, not copied.
     /// estimationMode: is set, no real signing is performed, only as much as needed to get the almost-exact signed size 
     TransactionSigner(const Bitcoin::Proto::SigningInput& input, bool estimationMode = false) :
-    input(input), estimationMode(estimationMode) {
-      if (input.has_plan()) {
-        plan = TransactionPlan(input.plan());
-      } else {
-        plan = TransactionBuilder::plan(input);
-      }
+    TransactionSigner(input, input.has_plan() ? TransactionPlan(input.plan()) : TransactionBuilder::plan(input), estimationMode) {}
+
+    /// Initializes a transaction signer with signing input and the plan to sign, ignoring the plan of the input.
+    TransactionSigner(const Bitcoin::Proto::SigningInput& input, TransactionPlan plan, bool estimationMode = false) :
+    input(input), plan(std::move(plan)), estimationMode(estimationMode) {
       transaction = TransactionBuilder::template build<Transaction>(
-        plan, input.to_address(), input.change_address(), TWCoinType(input.coin_type())
+        this->plan, input.to_address(), input.change_address(), TWCoinType(input.coin_type())
       );
     }
 
+    /// A temporary input would not outlive the signer.
+    TransactionSigner(Bitcoin::Proto::SigningInput&& input, bool estimationMode = false) = delete;
+    TransactionSigner(Bitcoin::Proto::SigningInput&& input, TransactionPlan plan, bool estimationMode = false) = delete;
+
     /// Signs the transaction.
     ///
     /// \returns the signed transaction or an error.
@@ -75,7 +84,7 @@ class TransactionSigner {
 
   private:
     Result<void, Common::Proto::SigningError> sign(Script script, size_t index, const Proto::UnspentTransaction& utxo);
-    Result<std::vector<Data>, Common::Proto::SigningError> signStep(Script script, size_t index,
+    Result<std::vector<Data>, Common::Proto::SigningError> signStep(const Script& script, size_t index,
                                        const Proto::UnspentTransaction& utxo, uint32_t version) const;
     Data createSignature(const Transaction& transaction, const Script& script, const std::optional<KeyPair>&,
                          size_t index, Amount amount, uint32_t version) const;
@@ -24,7 +24,8 @@ std::vector<Proto::UnspentTransaction>
 UnspentSelector::filterDustInput(const T& selectedUtxos, int64_t byteFee) {
     auto inputFeeLimit = feeCalculator.calculateSingleInput(byteFee);
     std::vector<Proto::UnspentTransaction> filteredUtxos;
-    for (auto utxo: selectedUtxos) {
+    filteredUtxos.reserve(selectedUtxos.size());
+    for (const auto& utxo: selectedUtxos) {
         if (utxo.amount() > inputFeeLimit) {
             filteredUtxos.push_back(utxo);
         }
@@ -0,0 +1,179 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Blake2b.h"
+#include "Hash.h"
+
+#include <cstring>
+#include <stdexcept>
+
+using namespace TW;
+using namespace TW::SIMD;
+using TW::Blake2b::iv;
+using TW::Blake2b::mix;
+using TW::Blake2b::sigma;
+
+namespace {
+
+inline uint64_t load64LE(const byte* p) {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; --i) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+/// Portable compression function, one word at a time.
+void compressScalar(uint64_t h[8], const uint64_t m[16], uint64_t t, uint64_t f) {
+    uint64_t v[16];
+    for (int i = 0; i < 8; ++i) {
+        v[i] = h[i];
+        v[i + 8] = iv[i];
+    }
+    v[12] ^= t;
+    v[14] ^= f;
+
+    for (const auto& s : sigma) {
+        mix(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+        mix(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+        mix(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+        mix(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+        mix(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+        mix(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+        mix(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+        mix(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        h[i] ^= v[i] ^ v[i + 8];
+    }
+}
+
+#if defined(TW_SIMD_X86)
+/// AVX2 compression function: the 4x4 work matrix is held as four rows of 4 words,
+/// so each half-round mixes all four columns (then all four diagonals) in one go.
+/// Rows are rotated into diagonal position and back with lane shuffles.
+TW_SIMD_TARGET_AVX2 void compressAVX2(uint64_t h[8], const uint64_t m[16], uint64_t t, uint64_t f) {
+    const u64x4 h0 = {h[0], h[1], h[2], h[3]};
+    const u64x4 h1 = {h[4], h[5], h[6], h[7]};
+    u64x4 a = h0;
+    u64x4 b = h1;
+    u64x4 c = {iv[0], iv[1], iv[2], iv[3]};
+    u64x4 d = {iv[4] ^ t, iv[5], iv[6] ^ f, iv[7]};
+
+    for (const auto& s : sigma) {
+        mix(a, b, c, d, u64x4{m[s[0]], m[s[2]], m[s[4]], m[s[6]]}, u64x4{m[s[1]], m[s[3]], m[s[5]], m[s[7]]});
+        b = __builtin_shufflevector(b, b, 1, 2, 3, 0);
+        c = __builtin_shufflevector(c, c, 2, 3, 0, 1);
+        d = __builtin_shufflevector(d, d, 3, 0, 1, 2);
+        mix(a, b, c, d, u64x4{m[s[8]], m[s[10]], m[s[12]], m[s[14]]}, u64x4{m[s[9]], m[s[11]], m[s[13]], m[s[15]]});
+        b = __builtin_shufflevector(b, b, 3, 0, 1, 2);
+        c = __builtin_shufflevector(c, c, 2, 3, 0, 1);
+        d = __builtin_shufflevector(d, d, 1, 2, 3, 0);
+    }
+
+    const u64x4 r0 = h0 ^ a ^ c;
+    const u64x4 r1 = h1 ^ b ^ d;
+    for (int i = 0; i < 4; ++i) {
+        h[i] = r0[i];
+        h[i + 4] = r1[i];
+    }
+}
+#endif
+
+using CompressFunction = void (*)(uint64_t h[8], const uint64_t m[16], uint64_t t, uint64_t f);
+
+CompressFunction selectCompress() {
+#if defined(TW_SIMD_X86)
+    if (hasAVX2()) {
+        return compressAVX2;
+    }
+#endif
+    return compressScalar;
+}
+
+// selected on first use, so that hashing during static initialization of other units is safe
+CompressFunction compressFunction() {
+    static const CompressFunction selected = selectCompress();
+    return selected;
+}
+
+} // namespace
+
+Hash::Blake2b::Blake2b(size_t hashSize) : Blake2b(hashSize, nullptr, 0) {}
+
+Hash::Blake2b::Blake2b(size_t hashSize, const Data& personal) : Blake2b(hashSize, personal.data(), personal.size()) {}
+
+Hash::Blake2b::Blake2b(size_t hashSize, const byte* personal, size_t personalSize) : hashSize(hashSize) {
+    if (hashSize == 0 || hashSize > blake2bMaxSize) {
+        throw std::invalid_argument("Invalid blake2b hash size");
+    }
+    if (personal != nullptr && personalSize != blake2bPersonalSize) {
+        throw std::invalid_argument("Invalid blake2b personalization size");
+    }
+    for (int i = 0; i < 8; ++i) {
+        state[i] = iv[i];
+    }
+    // parameter block: digest length, no key, fanout 1, depth 1
+    state[0] ^= 0x01010000 ^ static_cast<uint64_t>(hashSize);
+    if (personal != nullptr) {
+        state[6] ^= load64LE(personal);
+        state[7] ^= load64LE(personal + 8);
+    }
+}
+
+void Hash::Blake2b::compressBlock(const byte* block, bool last) {
+    uint64_t m[16];
+    for (int i = 0; i < 16; ++i) {
+        m[i] = load64LE(block + 8 * i);
+    }
+    compressFunction()(state, m, counter, last ? ~uint64_t(0) : 0);
+}
+
+Hash::Blake2b& Hash::Blake2b::update(const byte* data, size_t size) {
+    // the last block has to be compressed with the final flag, so a full buffer
+    // is only flushed once more input arrives
+    if (bufferSize + size > blockSize) {
+        const size_t fill = blockSize - bufferSize;
+        std::memcpy(buffer + bufferSize, data, fill);
+        counter += blockSize;
+        compressBlock(buffer, false);
+        bufferSize = 0;
+        data += fill;
+        size -= fill;
+        while (size > blockSize) {
+            counter += blockSize;
+            compressBlock(data, false);
+            data += blockSize;
+            size -= blockSize;
+        }
+    }
+    if (size > 0) {
+        std::memcpy(buffer + bufferSize, data, size);
+        bufferSize += size;
+    }
+    return *this;
+}
+
+Data Hash::Blake2b::final() {
+    counter += bufferSize;
+    std::memset(buffer + bufferSize, 0, blockSize - bufferSize);
+    compressBlock(buffer, true);
+
+    Data result(hashSize);
+    for (size_t i = 0; i < hashSize; ++i) {
+        result[i] = static_cast<byte>(state[i / 8] >> (8 * (i % 8)));
+    }
+    return result;
+}
+
+Data Hash::blake2b(const byte* data, size_t dataSize, size_t hashSize) {
+    return Blake2b(hashSize).update(data, dataSize).final();
+}
+
+Data Hash::blake2b(const byte* data, size_t dataSize, size_t hashSize, const Data& personal) {
+    return Blake2b(hashSize, personal).update(data, dataSize).final();
+}
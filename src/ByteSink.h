@@ -0,0 +1,72 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+
+#include <cstddef>
+#include <string>
+
+namespace TW {
+
+/// Destination of an encoder's output.  Lets the same encoding code either build a
+/// buffer, or feed an incremental hasher directly when only the hash is needed.
+class ByteSink {
+public:
+    virtual ~ByteSink() = default;
+
+    /// Appends bytes to the output.
+    virtual void write(const byte* data, size_t size) = 0;
+
+    /// Appends a single byte to the output.
+    void write(byte value) { write(&value, 1); }
+
+    /// Appends any contiguous byte container (Data, std::array, std::string).
+    template <typename T>
+    void write(const T& data) {
+        write(reinterpret_cast<const byte*>(data.data()), data.size());
+    }
+};
+
+/// Sink appending to a Data buffer.
+class DataSink : public ByteSink {
+public:
+    explicit DataSink(Data& data) : data(data) {}
+
+    using ByteSink::write;
+    void write(const byte* bytes, size_t size) override { data.insert(data.end(), bytes, bytes + size); }
+
+private:
+    Data& data;
+};
+
+/// Sink appending to a string, for text encodings such as JSON.
+class StringSink : public ByteSink {
+public:
+    explicit StringSink(std::string& string) : string(string) {}
+
+    using ByteSink::write;
+    void write(const byte* bytes, size_t size) override { string.append(reinterpret_cast<const char*>(bytes), size); }
+
+private:
+    std::string& string;
+};
+
+/// Sink feeding an incremental hasher, see IncrementalHash.h.
+template <typename Hasher>
+class HashSink : public ByteSink {
+public:
+    explicit HashSink(Hasher& hasher) : hasher(hasher) {}
+
+    using ByteSink::write;
+    void write(const byte* bytes, size_t size) override { hasher.update(bytes, size); }
+
+private:
+    Hasher& hasher;
+};
+
+} // namespace TW
@@ -0,0 +1,124 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "CanonicalJSON.h"
+
+#include <cassert>
+
+using namespace TW;
+
+CanonicalJSONWriter& CanonicalJSONWriter::beginObject() {
+    separate();
+    sink.write(byte('{'));
+    levels.push_back(Level{true});
+    return *this;
+}
+
+CanonicalJSONWriter& CanonicalJSONWriter::endObject() {
+    assert(!levels.empty() && levels.back().isObject && !afterKey);
+    levels.pop_back();
+    sink.write(byte('}'));
+    return *this;
+}
+
+CanonicalJSONWriter& CanonicalJSONWriter::beginArray() {
+    separate();
+    sink.write(byte('['));
+    levels.push_back(Level{false});
+    return *this;
+}
+
+CanonicalJSONWriter& CanonicalJSONWriter::endArray() {
+    assert(!levels.empty() && !levels.back().isObject);
+    levels.pop_back();
+    sink.write(byte(']'));
+    return *this;
+}
+
+CanonicalJSONWriter& CanonicalJSONWriter::key(const std::string& name) {
+    assert(!levels.empty() && levels.back().isObject && !afterKey);
+    auto& level = levels.back();
+    assert(level.empty || level.lastKey < name);
+    if (!level.empty) {
+        sink.write(byte(','));
+    }
+    level.empty = false;
+#ifndef NDEBUG
+    level.lastKey = name;
+#endif
+    writeString(name);
+    sink.write(byte(':'));
+    afterKey = true;
+    return *this;
+}
+
+CanonicalJSONWriter& CanonicalJSONWriter::value(const std::string& string) {
+    separate();
+    writeString(string);
+    return *this;
+}
+
+CanonicalJSONWriter& CanonicalJSONWriter::value(bool boolean) {
+    return boolean ? rawValue("true", 4) : rawValue("false", 5);
+}
+
+void CanonicalJSONWriter::separate() {
+    if (afterKey) {
+        afterKey = false;
+        return;
+    }
+    if (levels.empty()) {
+        return;
+    }
+    auto& level = levels.back();
+    // object members start with their key
+    assert(!level.isObject);
+    if (!level.empty) {
+        sink.write(byte(','));
+    }
+    level.empty = false;
+}
+
+CanonicalJSONWriter& CanonicalJSONWriter::rawValue(const char* data, size_t size) {
+    separate();
+    sink.write(reinterpret_cast<const byte*>(data), size);
+    return *this;
+}
+
+void CanonicalJSONWriter::writeString(const std::string& string) {
+    static const char* digits = "0123456789abcdef";
+    sink.write(byte('"'));
+    // unescaped runs are written at once
+    const auto* data = reinterpret_cast<const byte*>(string.data());
+    size_t start = 0;
+    for (size_t i = 0; i < string.size(); ++i) {
+        const auto c = data[i];
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        sink.write(data + start, i - start);
+        start = i + 1;
+        const char* escape = nullptr;
+        switch (c) {
+        case '"': escape = "\\\""; break;
+        case '\\': escape = "\\\\"; break;
+        case '\b': escape = "\\b"; break;
+        case '\f': escape = "\\f"; break;
+        case '\n': escape = "\\n"; break;
+        case '\r': escape = "\\r"; break;
+        case '\t': escape = "\\t"; break;
+        default: break;
+        }
+        if (escape != nullptr) {
+            sink.write(reinterpret_cast<const byte*>(escape), 2);
+        } else {
+            const char escaped[] = {'\\', 'u', '0', '0', digits[c >> 4], digits[c & 0xf]};
+            sink.write(reinterpret_cast<const byte*>(escaped), sizeof(escaped));
+        }
+    }
+    sink.write(data + start, string.size() - start);
+    sink.write(byte('"'));
+}
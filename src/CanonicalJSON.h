@@ -0,0 +1,76 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "ByteSink.h"
+
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace TW {
+
+/// Streaming writer of canonical JSON: no whitespace, object keys in sorted order, strings
+/// escaped the same way as nlohmann::json::dump().  Writes straight into a sink, so a sign
+/// document can be hashed without building a tree or a string first.
+///
+/// Callers must write the keys of each object in sorted (byte-wise) order, as the writer does not
+/// reorder members; debug builds check this with assertions.
+class CanonicalJSONWriter {
+  public:
+    explicit CanonicalJSONWriter(ByteSink& sink) : sink(sink) { levels.reserve(typicalDepth); }
+
+    CanonicalJSONWriter& beginObject();
+    CanonicalJSONWriter& endObject();
+    CanonicalJSONWriter& beginArray();
+    CanonicalJSONWriter& endArray();
+
+    /// Writes the key of the next member of the current object.
+    CanonicalJSONWriter& key(const std::string& name);
+
+    CanonicalJSONWriter& value(const std::string& string);
+    CanonicalJSONWriter& value(const char* string) { return value(std::string(string)); }
+    CanonicalJSONWriter& value(bool boolean);
+
+    template <typename T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
+    CanonicalJSONWriter& value(T number) {
+        char buffer[24];
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+        return rawValue(buffer, result.ptr - buffer);
+    }
+
+    CanonicalJSONWriter& null() { return rawValue("null", 4); }
+
+    /// Writes an already serialized JSON value as is.
+    CanonicalJSONWriter& raw(const std::string& json) { return rawValue(json.data(), json.size()); }
+
+  private:
+    struct Level {
+        bool isObject;
+        bool empty = true;
+#ifndef NDEBUG
+        /// Last key written, for the sorted order assertion.
+        std::string lastKey;
+#endif
+    };
+
+    /// Writes the separator needed before a new value.
+    void separate();
+    CanonicalJSONWriter& rawValue(const char* data, size_t size);
+    void writeString(const std::string& string);
+
+    /// Nesting depth the level stack is sized for up front; deeper documents grow it.
+    static constexpr size_t typicalDepth = 8;
+
+    ByteSink& sink;
+    std::vector<Level> levels;
+    bool afterKey = false;
+};
+
+} // namespace TW
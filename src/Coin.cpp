@@ -7,10 +7,13 @@
 #include "Coin.h"
 
 #include "CoinEntry.h"
+#include "Instrumentation.h"
+#include "Parallel.h"
 #include <TrustWalletCore/TWCoinTypeConfiguration.h>
 #include <TrustWalletCore/TWHRP.h>
 
 #include <map>
+#include <unordered_map>
 
 // #coin-list# Includes for entry points for coin implementations
 #include "Aeternity/Entry.h"
@@ -178,27 +181,82 @@ CoinEntry* coinDispatcher(TWCoinType coinType) {
     return entry;
 }
 
-bool TW::validateAddress(TWCoinType coin, const std::string& string) {
-    auto p2pkh = TW::p2pkhPrefix(coin);
-    auto p2sh = TW::p2shPrefix(coin);
-    auto hrp = stringForHRP(TW::hrp(coin));
+extern const CoinInfo& getCoinInfo(TWCoinType coin); // in generated CoinInfoData.cpp file
 
-    // dispatch
+namespace {
+
+/// Coin parameters needed for address validation, looked up once and reused for every address of the coin.
+struct AddressContext {
+    TWCoinType coin;
+    CoinEntry* dispatcher;
+    TW::byte p2pkh;
+    TW::byte p2sh;
+    const char* hrp;
+};
+
+AddressContext addressContext(TWCoinType coin) {
+    const auto& info = getCoinInfo(coin);
     auto dispatcher = coinDispatcher(coin);
     assert(dispatcher != nullptr);
-    return dispatcher->validateAddress(coin, string, p2pkh, p2sh, hrp);
+    return AddressContext{coin, dispatcher, info.p2pkhPrefix, info.p2shPrefix, stringForHRP(info.hrp)};
+}
+
+AddressCheck checkAddress(const AddressContext& context, const std::string& address, bool normalize) {
+    AddressCheck result;
+    result.valid = context.dispatcher->validateAddress(context.coin, address, context.p2pkh, context.p2sh, context.hrp);
+    if (result.valid && normalize) {
+        result.normalized = context.dispatcher->normalizeAddress(context.coin, address);
+    }
+    return result;
+}
+
+} // namespace
+
+bool TW::validateAddress(TWCoinType coin, const std::string& string) {
+    return checkAddress(addressContext(coin), string, false).valid;
 }
 
 std::string TW::normalizeAddress(TWCoinType coin, const std::string& address) {
-    if (!TW::validateAddress(coin, address)) {
-        // invalid address, not normalizing
-        return "";
+    // invalid addresses are not normalized, and come back empty
+    return checkAddress(addressContext(coin), address, true).normalized;
+}
+
+std::vector<AddressCheck> TW::validateAddresses(TWCoinType coin, const std::vector<std::string>& addresses, bool normalize, size_t threads) {
+    const auto context = addressContext(coin);
+    std::vector<AddressCheck> results(addresses.size());
+    parallelFor(addresses.size(), threads, [&](size_t i) {
+        results[i] = checkAddress(context, addresses[i], normalize);
+    });
+    return results;
+}
+
+std::vector<AddressCheck> TW::validateAddresses(TWCoinType coin, const Data& buffer, const std::vector<std::pair<size_t, size_t>>& ranges, bool normalize, size_t threads) {
+    const auto context = addressContext(coin);
+    std::vector<AddressCheck> results(ranges.size());
+    parallelFor(ranges.size(), threads, [&](size_t i) {
+        // per-thread scratch string, its capacity is kept from one address to the next
+        thread_local std::string address;
+        const auto* begin = reinterpret_cast<const char*>(buffer.data()) + ranges[i].first;
+        address.assign(begin, ranges[i].second);
+        results[i] = checkAddress(context, address, normalize);
+    });
+    return results;
+}
+
+std::vector<AddressCheck> TW::validateAddresses(const std::vector<std::pair<TWCoinType, std::string>>& addresses, bool normalize, size_t threads) {
+    // resolve each distinct coin once, before any worker starts
+    std::unordered_map<TWCoinType, AddressContext> contexts;
+    for (const auto& address : addresses) {
+        if (contexts.find(address.first) == contexts.end()) {
+            contexts.emplace(address.first, addressContext(address.first));
+        }
     }
 
-    // dispatch
-    auto dispatcher = coinDispatcher(coin);
-    assert(dispatcher != nullptr);
-    return dispatcher->normalizeAddress(coin, address);
+    std::vector<AddressCheck> results(addresses.size());
+    parallelFor(addresses.size(), threads, [&](size_t i) {
+        results[i] = checkAddress(contexts.at(addresses[i].first), addresses[i].second, normalize);
+    });
+    return results;
 }
 
 std::string TW::deriveAddress(TWCoinType coin, const PrivateKey& privateKey) {
@@ -207,8 +265,9 @@ std::string TW::deriveAddress(TWCoinType coin, const PrivateKey& privateKey) {
 }
 
 std::string TW::deriveAddress(TWCoinType coin, const PublicKey& publicKey) {
-    auto p2pkh = TW::p2pkhPrefix(coin);
-    auto hrp = stringForHRP(TW::hrp(coin));
+    const auto& info = getCoinInfo(coin);
+    auto p2pkh = info.p2pkhPrefix;
+    auto hrp = stringForHRP(info.hrp);
 
     // dispatch
     auto dispatcher = coinDispatcher(coin);
@@ -216,12 +275,34 @@ std::string TW::deriveAddress(TWCoinType coin, const PublicKey& publicKey) {
     return dispatcher->deriveAddress(coin, publicKey, p2pkh, hrp);
 }
 
+std::vector<std::string> TW::deriveAddresses(TWCoinType coin, const std::vector<PublicKey>& publicKeys) {
+    const auto& info = getCoinInfo(coin);
+    auto p2pkh = info.p2pkhPrefix;
+    auto hrp = stringForHRP(info.hrp);
+
+    // dispatch
+    auto dispatcher = coinDispatcher(coin);
+    assert(dispatcher != nullptr);
+    return dispatcher->deriveAddresses(coin, publicKeys, p2pkh, hrp);
+}
+
 void TW::anyCoinSign(TWCoinType coinType, const Data& dataIn, Data& dataOut) {
+    TW_INSTRUMENT_STAGE(anySign);
     auto dispatcher = coinDispatcher(coinType);
     assert(dispatcher != nullptr);
     dispatcher->sign(coinType, dataIn, dataOut);
 }
 
+void TW::anyCoinSignBatch(TWCoinType coinType, const std::vector<Data>& dataIn, std::vector<Data>& dataOut, size_t threads) {
+    auto dispatcher = coinDispatcher(coinType);
+    assert(dispatcher != nullptr);
+    dataOut.assign(dataIn.size(), Data());
+    // inputs are parsed into the arena of the thread signing them, see signTemplate
+    parallelFor(dataIn.size(), threads, [&](size_t i) {
+        dispatcher->sign(coinType, dataIn[i], dataOut[i]);
+    });
+}
+
 std::string TW::anySignJSON(TWCoinType coinType, const std::string& json, const Data& key) {
     auto dispatcher = coinDispatcher(coinType);
     assert(dispatcher != nullptr);
@@ -235,6 +316,7 @@ bool TW::supportsJSONSigning(TWCoinType coinType) {
 }
 
 void TW::anyCoinPlan(TWCoinType coinType, const Data& dataIn, Data& dataOut) {
+    TW_INSTRUMENT_STAGE(anyPlan);
     auto dispatcher = coinDispatcher(coinType);
     assert(dispatcher != nullptr);
     dispatcher->plan(coinType, dataIn, dataOut);
@@ -242,8 +324,6 @@ void TW::anyCoinPlan(TWCoinType coinType, const Data& dataIn, Data& dataOut) {
 
 // Coin info accessors
 
-extern const CoinInfo getCoinInfo(TWCoinType coin); // in generated CoinInfoData.cpp file
-
 TWBlockchain TW::blockchain(TWCoinType coin) {
     return getCoinInfo(coin).blockchain;
 }
@@ -264,8 +344,25 @@ TWHDVersion TW::xprvVersion(TWCoinType coin) {
     return getCoinInfo(coin).xprvVersion;
 }
 
-DerivationPath TW::derivationPath(TWCoinType coin) {
-    return DerivationPath(getCoinInfo(coin).derivationPath);
+const DerivationPath& TW::derivationPath(TWCoinType coin) {
+    // DerivationPath holds a vector so it can't be in the constexpr table,
+    // the paths are built once from the pre-parsed components instead
+    static const auto paths = [] {
+        std::unordered_map<TWCoinType, DerivationPath> result;
+        for (const auto type : getCoinTypes()) {
+            const auto& info = getCoinInfo(type);
+            const auto indices = std::vector<DerivationPathIndex>(info.derivationPath, info.derivationPath + info.derivationPathSize);
+            result.emplace(type, DerivationPath(indices));
+        }
+        return result;
+    }();
+    static const DerivationPath missing;
+
+    const auto it = paths.find(coin);
+    if (it == paths.end()) {
+        return missing;
+    }
+    return it->second;
 }
 
 enum TWPublicKeyType TW::publicKeyType(TWCoinType coin) {
@@ -288,11 +385,11 @@ enum TWHRP TW::hrp(TWCoinType coin) {
     return getCoinInfo(coin).hrp;
 }
 
-Hash::Hasher TW::publicKeyHasher(TWCoinType coin) {
+Hash::Algorithm TW::publicKeyHasher(TWCoinType coin) {
     return getCoinInfo(coin).publicKeyHasher;
 }
 
-Hash::Hasher TW::base58Hasher(TWCoinType coin) {
+Hash::Algorithm TW::base58Hasher(TWCoinType coin) {
     return getCoinInfo(coin).base58Hasher;
 }
 
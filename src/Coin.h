@@ -19,6 +19,7 @@
 #include <TrustWalletCore/TWPurpose.h>
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace TW {
@@ -32,6 +33,24 @@ bool validateAddress(TWCoinType coin, const std::string& address);
 /// Validates and normalizes an address for a particular coin.
 std::string normalizeAddress(TWCoinType coin, const std::string& address);
 
+/// Result of validating one address of a batch.
+struct AddressCheck {
+    bool valid = false;
+    /// Normalized form of the address; empty if invalid or not requested.
+    std::string normalized;
+};
+
+/// Validates, and optionally normalizes, a list of addresses of one coin, in the same order.
+/// Work is split over up to `threads` threads.
+std::vector<AddressCheck> validateAddresses(TWCoinType coin, const std::vector<std::string>& addresses, bool normalize, size_t threads = 1);
+
+/// Validates, and optionally normalizes, addresses of one coin held in a buffer, at the given offsets and lengths.
+/// Each thread reads the addresses into one reused string, rather than one string per address.
+std::vector<AddressCheck> validateAddresses(TWCoinType coin, const Data& buffer, const std::vector<std::pair<size_t, size_t>>& ranges, bool normalize, size_t threads = 1);
+
+/// Validates, and optionally normalizes, a list of addresses of mixed coins, in the same order.
+std::vector<AddressCheck> validateAddresses(const std::vector<std::pair<TWCoinType, std::string>>& addresses, bool normalize, size_t threads = 1);
+
 /// Returns the blockchain for a coin type.
 TWBlockchain blockchain(TWCoinType coin);
 
@@ -48,7 +67,7 @@ TWHDVersion xpubVersion(TWCoinType coin);
 TWHDVersion xprvVersion(TWCoinType coin);
 
 /// Returns the default derivation path for a particular coin.
-DerivationPath derivationPath(TWCoinType coin);
+const DerivationPath& derivationPath(TWCoinType coin);
 
 /// Returns the public key type for a particular coin.
 enum TWPublicKeyType publicKeyType(TWCoinType coin);
@@ -59,11 +78,14 @@ std::string deriveAddress(TWCoinType coin, const PrivateKey& privateKey);
 /// Derives the address for a particular coin from the public key.
 std::string deriveAddress(TWCoinType coin, const PublicKey& publicKey);
 
+/// Derives the addresses for a particular coin from a list of public keys, in the same order.
+std::vector<std::string> deriveAddresses(TWCoinType coin, const std::vector<PublicKey>& publicKeys);
+
 /// Hasher for deriving the public key hash.
-Hash::Hasher publicKeyHasher(TWCoinType coin);
+Hash::Algorithm publicKeyHasher(TWCoinType coin);
 
 /// Hasher to use for base 58 checksums.
-Hash::Hasher base58Hasher(TWCoinType coin);
+Hash::Algorithm base58Hasher(TWCoinType coin);
 
 /// Returns static prefix for a coin type.
 byte staticPrefix(TWCoinType coin);
@@ -80,6 +102,10 @@ enum TWHRP hrp(TWCoinType coin);
 // Note: use output parameter to avoid unneeded copies
 void anyCoinSign(TWCoinType coinType, const Data& dataIn, Data& dataOut);
 
+/// Signs a list of serialized signing inputs of one coin, with the outputs in the same order.
+/// Work is split over up to `threads` threads, capped at the hardware concurrency, each parsing its inputs into a reused protobuf arena.
+void anyCoinSignBatch(TWCoinType coinType, const std::vector<Data>& dataIn, std::vector<Data>& dataOut, size_t threads = 1);
+
 uint32_t slip44Id(TWCoinType coin);
 
 std::string anySignJSON(TWCoinType coinType, const std::string& json, const Data& key);
@@ -91,7 +117,10 @@ void anyCoinPlan(TWCoinType coinType, const Data& dataIn, Data& dataOut);
 // Return coins handled by the same dispatcher as the given coin (mostly for testing)
 const std::vector<TWCoinType> getSimilarCoinTypes(TWCoinType coinType);
 
-// Contains only simple types.
+/// Largest number of components in a default derivation path.
+static const size_t coinDerivationPathMaxSize = 5;
+
+// Contains only simple types, so that the generated table can be constexpr.
 struct CoinInfo {
     const char* id;
     const char* name;
@@ -100,14 +129,15 @@ struct CoinInfo {
     TWCurve curve;
     TWHDVersion xpubVersion;
     TWHDVersion xprvVersion;
-    const char* derivationPath;
+    DerivationPathIndex derivationPath[coinDerivationPathMaxSize];
+    size_t derivationPathSize;
     TWPublicKeyType publicKeyType;
     byte staticPrefix;
     byte p2pkhPrefix;
     byte p2shPrefix;
     TWHRP hrp;
-    Hash::Hasher publicKeyHasher;
-    Hash::Hasher base58Hasher;
+    Hash::Algorithm publicKeyHasher;
+    Hash::Algorithm base58Hasher;
     const char* symbol;
     int decimals;
     const char* explorerTransactionUrl;
@@ -9,8 +9,10 @@
 #include <TrustWalletCore/TWCoinType.h>
 
 #include "Data.h"
+#include "Instrumentation.h"
 #include "PublicKey.h"
 #include "PrivateKey.h"
+#include "SigningArena.h"
 
 #include <string>
 #include <vector>
@@ -19,6 +21,7 @@ namespace TW {
 
 /// Interface for coin-specific entry, used to dispatch calls to coins
 /// Implement this for all coins.
+/// A single instance per coin is shared by all threads, so implementations must not keep mutable state.
 class CoinEntry {
 public:
     // Report the coin types this implementation is responsible of
@@ -27,6 +30,15 @@ public:
     // normalizeAddress is optional, it may leave this default, no-change implementation
     virtual std::string normalizeAddress(TWCoinType coin, const std::string& address) const { return address; }
     virtual std::string deriveAddress(TWCoinType coin, const PublicKey& publicKey, TW::byte p2pkh, const char* hrp) const = 0;
+    // deriveAddresses is optional, coins with a batched hashing path may override it; default derives one by one
+    virtual std::vector<std::string> deriveAddresses(TWCoinType coin, const std::vector<PublicKey>& publicKeys, TW::byte p2pkh, const char* hrp) const {
+        std::vector<std::string> addresses;
+        addresses.reserve(publicKeys.size());
+        for (const auto& publicKey : publicKeys) {
+            addresses.push_back(deriveAddress(coin, publicKey, p2pkh, hrp));
+        }
+        return addresses;
+    }
     // Signing
     virtual void sign(TWCoinType coin, const Data& dataIn, Data& dataOut) const = 0;
     virtual bool supportsJSONSigning() const { return false; }
@@ -37,24 +49,42 @@ public:
     virtual void plan(TWCoinType coin, const Data& dataIn, Data& dataOut) const { return; }
 };
 
+// Serializes a message at the end of dataOut, sized up front so the bytes are written in place.
+template <typename Message>
+void serializeTo(const Message& message, Data& dataOut) {
+    const auto offset = dataOut.size();
+    dataOut.resize(offset + message.ByteSizeLong());
+    message.SerializeWithCachedSizesToArray(dataOut.data() + offset);
+}
+
 // In each coin's Entry.cpp the specific types of the coin are used, this template enforces the Signer implement:
 // static Proto::SigningOutput sign(const Proto::SigningInput& input) noexcept;
 // Note: use output parameter to avoid unneeded copies
 template <typename Signer, typename Input>
 void signTemplate(const Data& dataIn, Data& dataOut) {
-    auto input = Input();
-    input.ParseFromArray(dataIn.data(), (int)dataIn.size());
-    auto serializedOut = Signer::sign(input).SerializeAsString();
-    dataOut.insert(dataOut.end(), serializedOut.begin(), serializedOut.end());
+    SigningArenaScope arena;
+    auto input = google::protobuf::Arena::CreateMessage<Input>(arena.get());
+    {
+        TW_INSTRUMENT_STAGE(parse);
+        input->ParseFromArray(dataIn.data(), (int)dataIn.size());
+    }
+    const auto output = Signer::sign(*input);
+    TW_INSTRUMENT_STAGE(serialize);
+    serializeTo(output, dataOut);
 }
 
 // Note: use output parameter to avoid unneeded copies
 template <typename Planner, typename Input>
 void planTemplate(const Data& dataIn, Data& dataOut) {
-    auto input = Input();
-    input.ParseFromArray(dataIn.data(), (int)dataIn.size());
-    auto serializedOut = Planner::plan(input).SerializeAsString();
-    dataOut.insert(dataOut.end(), serializedOut.begin(), serializedOut.end());
+    SigningArenaScope arena;
+    auto input = google::protobuf::Arena::CreateMessage<Input>(arena.get());
+    {
+        TW_INSTRUMENT_STAGE(parse);
+        input->ParseFromArray(dataIn.data(), (int)dataIn.size());
+    }
+    const auto output = Planner::plan(*input);
+    TW_INSTRUMENT_STAGE(serialize);
+    serializeTo(output, dataOut);
 }
 
 } // namespace TW
@@ -0,0 +1,248 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "ProtobufSerialization.h"
+
+#include "Base64.h"
+#include "Bech32Address.h"
+#include "CanonicalJSON.h"
+
+#include <stdexcept>
+
+using namespace TW;
+using namespace TW::Cosmos;
+
+using string = std::string;
+
+namespace {
+
+const string TYPE_URL_MSG_SEND = "/cosmos.bank.v1beta1.MsgSend";
+const string TYPE_URL_MSG_DELEGATE = "/cosmos.staking.v1beta1.MsgDelegate";
+const string TYPE_URL_MSG_UNDELEGATE = "/cosmos.staking.v1beta1.MsgUndelegate";
+const string TYPE_URL_MSG_REDELEGATE = "/cosmos.staking.v1beta1.MsgBeginRedelegate";
+const string TYPE_URL_MSG_WITHDRAW_REWARD = "/cosmos.distribution.v1beta1.MsgWithdrawDelegatorReward";
+const string TYPE_URL_PUBLIC_KEY = "/cosmos.crypto.secp256k1.PubKey";
+const string TYPE_URL_THORCHAIN_MSG_SEND = "/types.MsgSend";
+
+const string TYPE_PREFIX_MSG_SEND = "cosmos-sdk/MsgSend";
+const string TYPE_PREFIX_THORCHAIN_MSG_SEND = "thorchain/MsgSend";
+
+const uint64_t SIGN_MODE_DIRECT = 1;
+
+enum WireType : uint8_t {
+    Varint = 0,
+    LengthDelimited = 2,
+};
+
+/// Appends protobuf fields to a sink; fields holding default values are omitted, as protobuf 3 does.
+class ProtoWriter {
+  public:
+    explicit ProtoWriter(ByteSink& sink) : sink(sink) {}
+
+    void varint(uint64_t value) {
+        while (value >= 0x80) {
+            sink.write(static_cast<byte>(value | 0x80));
+            value >>= 7;
+        }
+        sink.write(static_cast<byte>(value));
+    }
+
+    void uint64(uint32_t field, uint64_t value) {
+        if (value == 0) {
+            return;
+        }
+        tag(field, Varint);
+        varint(value);
+    }
+
+    void bytes(uint32_t field, const byte* data, size_t size) {
+        if (size == 0) {
+            return;
+        }
+        tag(field, LengthDelimited);
+        varint(size);
+        sink.write(data, size);
+    }
+
+    void bytes(uint32_t field, const Data& data) { bytes(field, data.data(), data.size()); }
+
+    void string(uint32_t field, const std::string& string) {
+        bytes(field, reinterpret_cast<const byte*>(string.data()), string.size());
+    }
+
+    /// Writes an embedded message, even if empty.
+    void message(uint32_t field, const Data& encoded) {
+        tag(field, LengthDelimited);
+        varint(encoded.size());
+        sink.write(encoded.data(), encoded.size());
+    }
+
+  private:
+    void tag(uint32_t field, WireType type) { varint((uint64_t(field) << 3) | type); }
+
+    ByteSink& sink;
+};
+
+/// Encodes a message with the given writer function.
+template <typename Write>
+Data encode(Write&& write) {
+    Data data;
+    DataSink sink(data);
+    ProtoWriter writer(sink);
+    write(writer);
+    return data;
+}
+
+Data coin(const Proto::Amount& amount) {
+    return encode([&](ProtoWriter& w) {
+        w.string(1, amount.denom());
+        w.string(2, std::to_string(amount.amount()));
+    });
+}
+
+Data any(const string& typeUrl, const Data& value) {
+    return encode([&](ProtoWriter& w) {
+        w.string(1, typeUrl);
+        w.bytes(2, value);
+    });
+}
+
+/// The account bytes of a bech32 address.
+Data accountBytes(const string& address) {
+    Bech32Address decoded("");
+    if (!Bech32Address::decode(address, decoded, "")) {
+        throw std::invalid_argument("invalid address " + address);
+    }
+    return decoded.getKeyHash();
+}
+
+Data message(const Proto::Message& msg) {
+    if (msg.has_send_coins_message()) {
+        const auto& send = msg.send_coins_message();
+        if (send.type_prefix() == TYPE_PREFIX_THORCHAIN_MSG_SEND) {
+            // THORChain's own MsgSend, holding the account bytes instead of the addresses
+            return any(TYPE_URL_THORCHAIN_MSG_SEND, encode([&](ProtoWriter& w) {
+                w.bytes(1, accountBytes(send.from_address()));
+                w.bytes(2, accountBytes(send.to_address()));
+                for (const auto& amount : send.amounts()) {
+                    w.message(3, coin(amount));
+                }
+            }));
+        }
+        if (!send.type_prefix().empty() && send.type_prefix() != TYPE_PREFIX_MSG_SEND) {
+            throw std::invalid_argument("message type " + send.type_prefix() + " not supported in protobuf signing mode");
+        }
+        return any(TYPE_URL_MSG_SEND, encode([&](ProtoWriter& w) {
+            w.string(1, send.from_address());
+            w.string(2, send.to_address());
+            for (const auto& amount : send.amounts()) {
+                w.message(3, coin(amount));
+            }
+        }));
+    } else if (msg.has_stake_message()) {
+        const auto& stake = msg.stake_message();
+        return any(TYPE_URL_MSG_DELEGATE, encode([&](ProtoWriter& w) {
+            w.string(1, stake.delegator_address());
+            w.string(2, stake.validator_address());
+            w.message(3, coin(stake.amount()));
+        }));
+    } else if (msg.has_unstake_message()) {
+        const auto& unstake = msg.unstake_message();
+        return any(TYPE_URL_MSG_UNDELEGATE, encode([&](ProtoWriter& w) {
+            w.string(1, unstake.delegator_address());
+            w.string(2, unstake.validator_address());
+            w.message(3, coin(unstake.amount()));
+        }));
+    } else if (msg.has_restake_message()) {
+        const auto& restake = msg.restake_message();
+        return any(TYPE_URL_MSG_REDELEGATE, encode([&](ProtoWriter& w) {
+            w.string(1, restake.delegator_address());
+            w.string(2, restake.validator_src_address());
+            w.string(3, restake.validator_dst_address());
+            w.message(4, coin(restake.amount()));
+        }));
+    } else if (msg.has_withdraw_stake_reward_message()) {
+        const auto& withdraw = msg.withdraw_stake_reward_message();
+        return any(TYPE_URL_MSG_WITHDRAW_REWARD, encode([&](ProtoWriter& w) {
+            w.string(1, withdraw.delegator_address());
+            w.string(2, withdraw.validator_address());
+        }));
+    }
+    throw std::invalid_argument("message not supported in protobuf signing mode");
+}
+
+string broadcastMode(Proto::BroadcastMode mode) {
+    switch (mode) {
+    case Proto::BroadcastMode::BLOCK:
+        return "BROADCAST_MODE_BLOCK";
+    case Proto::BroadcastMode::ASYNC:
+        return "BROADCAST_MODE_ASYNC";
+    default: return "BROADCAST_MODE_SYNC";
+    }
+}
+
+} // namespace
+
+Data Cosmos::buildProtoTxBody(const Proto::SigningInput& input) {
+    return encode([&](ProtoWriter& w) {
+        for (const auto& msg : input.messages()) {
+            w.message(1, message(msg));
+        }
+        w.string(2, input.memo());
+    });
+}
+
+Data Cosmos::buildProtoAuthInfo(const Proto::SigningInput& input, const Data& publicKey) {
+    const auto signerInfo = encode([&](ProtoWriter& w) {
+        w.message(1, any(TYPE_URL_PUBLIC_KEY, encode([&](ProtoWriter& key) {
+            key.bytes(1, publicKey);
+        })));
+        // mode_info: single, SIGN_MODE_DIRECT
+        w.message(2, encode([](ProtoWriter& modeInfo) {
+            modeInfo.message(1, encode([](ProtoWriter& single) {
+                single.uint64(1, SIGN_MODE_DIRECT);
+            }));
+        }));
+        w.uint64(3, input.sequence());
+    });
+    const auto fee = encode([&](ProtoWriter& w) {
+        for (const auto& amount : input.fee().amounts()) {
+            w.message(1, coin(amount));
+        }
+        w.uint64(2, input.fee().gas());
+    });
+    return encode([&](ProtoWriter& w) {
+        w.message(1, signerInfo);
+        w.message(2, fee);
+    });
+}
+
+void Cosmos::signDirectPreimage(const Proto::SigningInput& input, const Data& bodyBytes, const Data& authInfoBytes, ByteSink& sink) {
+    ProtoWriter w(sink);
+    w.bytes(1, bodyBytes);
+    w.bytes(2, authInfoBytes);
+    w.string(3, input.chain_id());
+    w.uint64(4, input.account_number());
+}
+
+Data Cosmos::buildProtoTxRaw(const Data& bodyBytes, const Data& authInfoBytes, const Data& signature) {
+    return encode([&](ProtoWriter& w) {
+        w.bytes(1, bodyBytes);
+        w.bytes(2, authInfoBytes);
+        w.bytes(3, signature);
+    });
+}
+
+string Cosmos::transactionDirectJSON(const Proto::SigningInput& input, const Data& txRaw) {
+    Data data;
+    DataSink sink(data);
+    CanonicalJSONWriter w(sink);
+    w.beginObject()
+        .key("mode").value(broadcastMode(input.mode()))
+        .key("tx_bytes").value(Base64::encode(txRaw))
+        .endObject();
+    return string(data.begin(), data.end());
+}
@@ -0,0 +1,35 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "../proto/Cosmos.pb.h"
+#include "ByteSink.h"
+#include "Data.h"
+
+#include <string>
+
+namespace TW::Cosmos {
+
+// Serialization for SIGN_MODE_DIRECT, see cosmos/tx/v1beta1/tx.proto of the Cosmos SDK.
+// The messages are encoded by hand: fields in field number order, default values omitted.
+
+/// Encodes the body of the transaction (TxBody): the messages and the memo.
+Data buildProtoTxBody(const Proto::SigningInput& input);
+
+/// Encodes the auth info of the transaction (AuthInfo): the signer, secp256k1 public key, and the fee.
+Data buildProtoAuthInfo(const Proto::SigningInput& input, const Data& publicKey);
+
+/// Writes the document to sign (SignDoc) into the sink.
+void signDirectPreimage(const Proto::SigningInput& input, const Data& bodyBytes, const Data& authInfoBytes, ByteSink& sink);
+
+/// Encodes the signed transaction (TxRaw).
+Data buildProtoTxRaw(const Data& bodyBytes, const Data& authInfoBytes, const Data& signature);
+
+/// Returns the body of the broadcast request of an encoded TxRaw, JSON.
+std::string transactionDirectJSON(const Proto::SigningInput& input, const Data& txRaw);
+
+} // namespace TW::Cosmos
@@ -9,8 +9,11 @@
 #include "../Cosmos/Address.h"
 #include "../proto/Cosmos.pb.h"
 #include "Base64.h"
+#include "CanonicalJSON.h"
 #include "PrivateKey.h"
 
+#include <nlohmann/json.hpp>
+
 using namespace TW;
 using namespace TW::Cosmos;
 
@@ -34,163 +37,182 @@ static string broadcastMode(Proto::BroadcastMode mode) {
     }
 }
 
-static json broadcastJSON(json& j, Proto::BroadcastMode mode) {
-    return {
-        {"tx", j},
-        {"mode", broadcastMode(mode)}
-    };
-}
-
-static json amountJSON(const Proto::Amount& amount) {
-    return {
-        {"amount", std::to_string(amount.amount())},
-        {"denom", amount.denom()}
-    };
+static void amountJSON(CanonicalJSONWriter& w, const Proto::Amount& amount) {
+    w.beginObject()
+        .key("amount").value(std::to_string(amount.amount()))
+        .key("denom").value(amount.denom())
+        .endObject();
 }
 
-static json amountsJSON(const ::google::protobuf::RepeatedPtrField<Proto::Amount>& amounts) {
-    json j = json::array();
+static void amountsJSON(CanonicalJSONWriter& w, const ::google::protobuf::RepeatedPtrField<Proto::Amount>& amounts) {
+    w.beginArray();
     for (auto& amount : amounts) {
-        j.push_back(amountJSON(amount));
+        amountJSON(w, amount);
     }
-    return j;
+    w.endArray();
 }
 
-static json feeJSON(const Proto::Fee& fee) {
-    json js = json::array();
-
-    for (auto& amount : fee.amounts()) {
-        js.push_back(amountJSON(amount));
-    }
-
-    return {
-        {"amount", js},
-        {"gas", std::to_string(fee.gas())}
-    };
+static void feeJSON(CanonicalJSONWriter& w, const Proto::Fee& fee) {
+    w.beginObject().key("amount");
+    amountsJSON(w, fee.amounts());
+    w.key("gas").value(std::to_string(fee.gas()))
+        .endObject();
 }
 
-static json messageSend(const Proto::Message_Send& message) {
+static void messageSend(CanonicalJSONWriter& w, const Proto::Message_Send& message) {
     auto typePrefix = message.type_prefix().empty() ? TYPE_PREFIX_MSG_SEND : message.type_prefix();
 
-    return {
-        {"type", typePrefix},
-        {"value", {
-            {"amount", amountsJSON(message.amounts())},
-            {"from_address", message.from_address()},
-            {"to_address", message.to_address()}
-        }}
-    };
+    w.beginObject()
+        .key("type").value(typePrefix)
+        .key("value").beginObject()
+            .key("amount");
+    amountsJSON(w, message.amounts());
+    w.key("from_address").value(message.from_address())
+            .key("to_address").value(message.to_address())
+        .endObject()
+        .endObject();
 }
 
-static json messageDelegate(const Proto::Message_Delegate& message) {
+static void messageDelegate(CanonicalJSONWriter& w, const Proto::Message_Delegate& message) {
     auto typePrefix = message.type_prefix().empty() ? TYPE_PREFIX_MSG_DELEGATE : message.type_prefix();
 
-    return {
-        {"type", typePrefix},
-        {"value", {
-            {"amount", amountJSON(message.amount())},
-            {"delegator_address", message.delegator_address()},
-            {"validator_address", message.validator_address()}
-        }}
-    };
+    w.beginObject()
+        .key("type").value(typePrefix)
+        .key("value").beginObject()
+            .key("amount");
+    amountJSON(w, message.amount());
+    w.key("delegator_address").value(message.delegator_address())
+            .key("validator_address").value(message.validator_address())
+        .endObject()
+        .endObject();
 }
 
-static json messageUndelegate(const Proto::Message_Undelegate& message) {
+static void messageUndelegate(CanonicalJSONWriter& w, const Proto::Message_Undelegate& message) {
     auto typePrefix = message.type_prefix().empty() ? TYPE_PREFIX_MSG_UNDELEGATE : message.type_prefix();
 
-    return {
-        {"type", typePrefix},
-        {"value", {
-            {"amount", amountJSON(message.amount())},
-            {"delegator_address", message.delegator_address()},
-            {"validator_address", message.validator_address()}
-        }}
-    };
+    w.beginObject()
+        .key("type").value(typePrefix)
+        .key("value").beginObject()
+            .key("amount");
+    amountJSON(w, message.amount());
+    w.key("delegator_address").value(message.delegator_address())
+            .key("validator_address").value(message.validator_address())
+        .endObject()
+        .endObject();
 }
 
-static json messageRedelegate(const Proto::Message_BeginRedelegate& message) {
+static void messageRedelegate(CanonicalJSONWriter& w, const Proto::Message_BeginRedelegate& message) {
     auto typePrefix = message.type_prefix().empty() ? TYPE_PREFIX_MSG_REDELEGATE : message.type_prefix();
 
-    return {
-        {"type", typePrefix},
-        {"value", {
-            {"amount", amountJSON(message.amount())},
-            {"delegator_address", message.delegator_address()},
-            {"validator_src_address", message.validator_src_address()},
-            {"validator_dst_address", message.validator_dst_address()},
-        }}
-    };
+    w.beginObject()
+        .key("type").value(typePrefix)
+        .key("value").beginObject()
+            .key("amount");
+    amountJSON(w, message.amount());
+    w.key("delegator_address").value(message.delegator_address())
+            .key("validator_dst_address").value(message.validator_dst_address())
+            .key("validator_src_address").value(message.validator_src_address())
+        .endObject()
+        .endObject();
 }
 
-static json messageWithdrawReward(const Proto::Message_WithdrawDelegationReward& message) {
+static void messageWithdrawReward(CanonicalJSONWriter& w, const Proto::Message_WithdrawDelegationReward& message) {
     auto typePrefix = message.type_prefix().empty() ? TYPE_PREFIX_MSG_WITHDRAW_REWARD : message.type_prefix();
 
-    return {
-        {"type", typePrefix},
-        {"value", {
-            {"delegator_address", message.delegator_address()},
-            {"validator_address", message.validator_address()}
-        }}
-    };
+    w.beginObject()
+        .key("type").value(typePrefix)
+        .key("value").beginObject()
+            .key("delegator_address").value(message.delegator_address())
+            .key("validator_address").value(message.validator_address())
+        .endObject()
+        .endObject();
 }
 
-static json messageRawJSON(const Proto::Message_RawJSON& message) {
-    return {
-        {"type", message.type()},
-        {"value", json::parse(message.value())},
-    };
+static void messageRawJSON(CanonicalJSONWriter& w, const Proto::Message_RawJSON& message) {
+    // arbitrary JSON: parsed and dumped to sort its keys
+    w.beginObject()
+        .key("type").value(message.type())
+        .key("value").raw(json::parse(message.value()).dump())
+        .endObject();
 }
-static json messagesJSON(const Proto::SigningInput& input) {
-    json j = json::array();
+
+static void messagesJSON(CanonicalJSONWriter& w, const Proto::SigningInput& input) {
+    w.beginArray();
     for (auto& msg : input.messages()) {
         if (msg.has_send_coins_message()) {
-            j.push_back(messageSend(msg.send_coins_message()));
+            messageSend(w, msg.send_coins_message());
         } else if (msg.has_stake_message()) {
-            j.push_back(messageDelegate(msg.stake_message()));
+            messageDelegate(w, msg.stake_message());
         } else if (msg.has_unstake_message()) {
-            j.push_back(messageUndelegate(msg.unstake_message()));
+            messageUndelegate(w, msg.unstake_message());
         } else if (msg.has_withdraw_stake_reward_message()) {
-            j.push_back(messageWithdrawReward(msg.withdraw_stake_reward_message()));
+            messageWithdrawReward(w, msg.withdraw_stake_reward_message());
         } else if (msg.has_restake_message()) {
-            j.push_back(messageRedelegate(msg.restake_message()));
+            messageRedelegate(w, msg.restake_message());
         } else if (msg.has_raw_json_message()) {
-            j.push_back(messageRawJSON(msg.raw_json_message()));
+            messageRawJSON(w, msg.raw_json_message());
         }
     }
-    return j;
+    w.endArray();
+}
+
+static void signatureJSON(CanonicalJSONWriter& w, const Data& signature, const Data& pubkey) {
+    w.beginObject()
+        .key("pub_key").beginObject()
+            .key("type").value(TYPE_PREFIX_PUBLIC_KEY)
+            .key("value").value(Base64::encode(pubkey))
+        .endObject()
+        .key("signature").value(Base64::encode(signature))
+        .endObject();
 }
 
-static json signatureJSON(const Data& signature, const Data& pubkey) {
-    return {
-        {"pub_key", {
-            {"type", TYPE_PREFIX_PUBLIC_KEY},
-            {"value", Base64::encode(pubkey)}
-        }},
-        {"signature", Base64::encode(signature)}
-    };
+void Cosmos::signaturePreimage(const Proto::SigningInput& input, ByteSink& sink) {
+    CanonicalJSONWriter w(sink);
+    w.beginObject()
+        .key("account_number").value(std::to_string(input.account_number()))
+        .key("chain_id").value(input.chain_id())
+        .key("fee");
+    feeJSON(w, input.fee());
+    w.key("memo").value(input.memo())
+        .key("msgs");
+    messagesJSON(w, input);
+    w.key("sequence").value(std::to_string(input.sequence()))
+        .endObject();
 }
 
-json Cosmos::signaturePreimage(const Proto::SigningInput& input) {
-    return {
-        {"account_number", std::to_string(input.account_number())},
-        {"chain_id", input.chain_id()},
-        {"fee", feeJSON(input.fee())},
-        {"memo", input.memo()},
-        {"msgs", messagesJSON(input)},
-        {"sequence", std::to_string(input.sequence())}
-    };
+/// Size to reserve for a JSON document of the input, enough for typical documents to be written without regrowth.
+static size_t jsonCapacity(const Proto::SigningInput& input) {
+    return 512 + 384 * input.messages_size();
 }
 
-json Cosmos::transactionJSON(const Proto::SigningInput& input, const Data& signature) {
+string Cosmos::signaturePreimage(const Proto::SigningInput& input) {
+    string preimage;
+    preimage.reserve(jsonCapacity(input));
+    StringSink sink(preimage);
+    signaturePreimage(input, sink);
+    return preimage;
+}
+
+string Cosmos::transactionJSON(const Proto::SigningInput& input, const Data& signature) {
     auto privateKey = PrivateKey(input.private_key());
     auto publicKey = privateKey.getPublicKey(TWPublicKeyTypeSECP256k1);
-    json tx = {
-        {"fee", feeJSON(input.fee())},
-        {"memo", input.memo()},
-        {"msg", messagesJSON(input)},
-        {"signatures", json::array({
-            signatureJSON(signature, Data(publicKey.bytes))
-        })}
-    };
-    return broadcastJSON(tx, input.mode());
+
+    string json;
+    json.reserve(jsonCapacity(input));
+    StringSink sink(json);
+    CanonicalJSONWriter w(sink);
+    w.beginObject()
+        .key("mode").value(broadcastMode(input.mode()))
+        .key("tx").beginObject()
+            .key("fee");
+    feeJSON(w, input.fee());
+    w.key("memo").value(input.memo())
+            .key("msg");
+    messagesJSON(w, input);
+    w.key("signatures").beginArray();
+    signatureJSON(w, signature, Data(publicKey.bytes));
+    w.endArray()
+        .endObject()
+        .endObject();
+    return json;
 }
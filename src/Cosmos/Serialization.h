@@ -7,11 +7,12 @@
 #pragma once
 
 #include "../proto/Cosmos.pb.h"
+#include "ByteSink.h"
 #include "Data.h"
-#include <nlohmann/json.hpp>
+
+#include <string>
 
 using string = std::string;
-using json = nlohmann::json;
 
 extern const string TYPE_PREFIX_MSG_SEND;
 extern const string TYPE_PREFIX_MSG_DELEGATE;
@@ -22,7 +23,11 @@ extern const string TYPE_PREFIX_PUBLIC_KEY;
 
 namespace TW::Cosmos {
 
-json signaturePreimage(const Proto::SigningInput& input);
-json transactionJSON(const Proto::SigningInput& input, const Data& signature);
+/// Writes the sign document, canonical JSON, into the sink.
+void signaturePreimage(const Proto::SigningInput& input, ByteSink& sink);
+/// Returns the sign document, canonical JSON.
+std::string signaturePreimage(const Proto::SigningInput& input);
+/// Returns the broadcast JSON of the signed transaction.
+std::string transactionJSON(const Proto::SigningInput& input, const Data& signature);
 
 } // namespace
@@ -6,10 +6,12 @@
 
 #include "Signer.h"
 #include "PrivateKey.h"
+#include "ProtobufSerialization.h"
 #include "Serialization.h"
 
+#include "ByteSink.h"
 #include "Data.h"
-#include "Hash.h"
+#include "IncrementalHash.h"
 
 #include <google/protobuf/util/json_util.h>
 
@@ -17,15 +19,50 @@ using namespace TW;
 using namespace TW::Cosmos;
 
 Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
+    if (input.signing_mode() == Proto::Protobuf) {
+        try {
+            return signProtobuf(input);
+        } catch (const std::exception& ex) {
+            auto output = Proto::SigningOutput();
+            output.set_error(ex.what());
+            return output;
+        }
+    }
+    return signJsonSerialized(input);
+}
+
+Proto::SigningOutput Signer::signJsonSerialized(const Proto::SigningInput& input) noexcept {
     auto key = PrivateKey(input.private_key());
-    auto preimage = signaturePreimage(input).dump();
-    auto hash = Hash::sha256(preimage);
-    auto signedHash = key.sign(hash, TWCurveSECP256k1);
+    auto hasher = Hash::Sha256();
+    auto sink = HashSink<Hash::Sha256>(hasher);
+    signaturePreimage(input, sink);
+    const auto hash = hasher.final();
+    auto signedHash = key.sign(Data(hash.begin(), hash.end()), TWCurveSECP256k1);
+
+    auto output = Proto::SigningOutput();
+    auto signature = Data(signedHash.begin(), signedHash.end() - 1);
+    output.set_json(transactionJSON(input, signature));
+    output.set_signature(signature.data(), signature.size());
+    return output;
+}
+
+Proto::SigningOutput Signer::signProtobuf(const Proto::SigningInput& input) {
+    auto key = PrivateKey(input.private_key());
+    auto publicKey = key.getPublicKey(TWPublicKeyTypeSECP256k1);
+    const auto body = buildProtoTxBody(input);
+    const auto authInfo = buildProtoAuthInfo(input, Data(publicKey.bytes));
+
+    auto hasher = Hash::Sha256();
+    auto sink = HashSink<Hash::Sha256>(hasher);
+    signDirectPreimage(input, body, authInfo, sink);
+    const auto hash = hasher.final();
+    auto signedHash = key.sign(Data(hash.begin(), hash.end()), TWCurveSECP256k1);
 
     auto output = Proto::SigningOutput();
     auto signature = Data(signedHash.begin(), signedHash.end() - 1);
-    auto txJson = transactionJSON(input, signature);
-    output.set_json(txJson.dump());
+    const auto txRaw = buildProtoTxRaw(body, authInfo, signature);
+    output.set_serialized(txRaw.data(), txRaw.size());
+    output.set_json(transactionDirectJSON(input, txRaw));
     output.set_signature(signature.data(), signature.size());
     return output;
 }
@@ -16,6 +16,10 @@ class Signer {
   public:
     /// Signs a Proto::SigningInput transaction
     static Proto::SigningOutput sign(const Proto::SigningInput& input) noexcept;
+    /// Signs the Amino JSON sign document
+    static Proto::SigningOutput signJsonSerialized(const Proto::SigningInput& input) noexcept;
+    /// Signs the protobuf SignDoc (SIGN_MODE_DIRECT); throws for messages without a protobuf encoding
+    static Proto::SigningOutput signProtobuf(const Proto::SigningInput& input);
     /// Signs a json Proto::SigningInput with private key
     static std::string signJSON(const std::string& json, const Data& key);
 };
@@ -15,3 +15,9 @@ void OutPoint::encode(Data& data) const {
     encode32LE(index, data);
     data.push_back(static_cast<byte>(tree));
 }
+
+void OutPoint::encode(ByteSink& sink) const {
+    sink.write(hash);
+    encode32LE(index, sink);
+    sink.write(static_cast<byte>(tree));
+}
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "../ByteSink.h"
 #include "../Data.h"
 #include "../proto/Bitcoin.pb.h"
 
@@ -49,6 +50,9 @@ class OutPoint {
     /// Encodes the out-point into the provided buffer.
     void encode(Data& data) const;
 
+    /// Encodes the out-point into the provided sink.
+    void encode(ByteSink& sink) const;
+
     friend bool operator<(const OutPoint& a, const OutPoint& b) {
         int cmp = std::memcmp(a.hash.data(), b.hash.data(), 32);
         return cmp < 0 || (cmp == 0 && a.index < b.index);
@@ -21,12 +21,12 @@ using namespace TW;
 using namespace TW::Decred;
 
 Bitcoin::Proto::TransactionPlan Signer::plan(const Bitcoin::Proto::SigningInput& input) noexcept {
-    auto signer = Signer(std::move(input));
+    auto signer = Signer(input);
     return signer.txPlan.proto();
 }
 
 Proto::SigningOutput Signer::sign(const Bitcoin::Proto::SigningInput& input) noexcept {
-    auto signer = Signer(std::move(input));
+    auto signer = Signer(input);
     auto result = signer.sign();
     auto output = Proto::SigningOutput();
     if (!result) {
@@ -9,6 +9,7 @@
 #include "../Bitcoin/SigHashType.h"
 #include "../BinaryCoding.h"
 #include "../Hash.h"
+#include "../IncrementalHash.h"
 
 #include "Bitcoin/SignatureVersion.h"
 
@@ -23,9 +24,6 @@ static const uint32_t sigHashSerializePrefix = 1;
 
 // Indicates the serialization only contains witness data.
 static const uint32_t sigHashSerializeWitness = 3;
-
-std::size_t sigHashWitnessSize(const std::vector<TransactionInput>& inputs,
-                               const Bitcoin::Script& signScript);
 } // namespace
 
 Data Transaction::computeSignatureHash(const Bitcoin::Script& prevOutScript, size_t index,
@@ -58,89 +56,87 @@ Data Transaction::computeSignatureHash(const Bitcoin::Script& prevOutScript, siz
         break;
     }
 
-    auto preimage = Data();
-    preimage.reserve(Hash::sha256Size * 2 + 4);
-    encode32LE(hashType, preimage);
-
-    const auto prefixHash =
-        computePrefixHash(inputsToSign, outputsToSign, signIndex, index, hashType);
-    std::copy(prefixHash.begin(), prefixHash.end(), std::back_inserter(preimage));
-
-    const auto witnessHash = computeWitnessHash(inputsToSign, prevOutScript, signIndex);
-    std::copy(witnessHash.begin(), witnessHash.end(), std::back_inserter(preimage));
+    auto hasher = Hash::Blake256();
+    auto sink = HashSink<Hash::Blake256>(hasher);
+    encode32LE(hashType, sink);
+    sink.write(computePrefixHash(inputsToSign, outputsToSign, signIndex, index, hashType));
+    sink.write(computeWitnessHash(inputsToSign, prevOutScript, signIndex));
 
-    return Hash::blake256(preimage);
+    const auto hash = hasher.final();
+    return Data(hash.begin(), hash.end());
 }
 
 Data Transaction::computePrefixHash(const std::vector<TransactionInput>& inputsToSign,
                                     const std::vector<TransactionOutput>& outputsToSign,
                                     std::size_t signIndex, std::size_t index,
                                     enum TWBitcoinSigHashType hashType) const {
-    auto preimage = Data{};
+    auto hasher = Hash::Blake256();
+    auto sink = HashSink<Hash::Blake256>(hasher);
 
     // Commit to the version and hash serialization type.
     encode32LE(static_cast<uint32_t>(version) |
                    (static_cast<uint32_t>(sigHashSerializePrefix) << 16),
-               preimage);
+               sink);
 
     // Commit to the relevant transaction inputs.
-    encodeVarInt(inputsToSign.size(), preimage);
+    encodeVarInt(inputsToSign.size(), sink);
     for (auto i = 0; i < inputsToSign.size(); i += 1) {
         auto& input = inputsToSign[i];
-        input.previousOutput.encode(preimage);
+        input.previousOutput.encode(sink);
 
         auto sequence = input.sequence;
         if ((Bitcoin::hashTypeIsNone(hashType) || Bitcoin::hashTypeIsSingle(hashType)) &&
             i != signIndex) {
             sequence = 0;
         }
-        encode32LE(sequence, preimage);
+        encode32LE(sequence, sink);
     }
 
     // Commit to the relevant transaction outputs.
-    encodeVarInt(outputsToSign.size(), preimage);
+    encodeVarInt(outputsToSign.size(), sink);
     for (auto i = 0; i < outputsToSign.size(); i += 1) {
         auto& output = outputsToSign[i];
-        auto value = output.value;
-        auto pkScript = output.script;
         if (Bitcoin::hashTypeIsSingle(hashType) && i != index) {
-            value = -1;
-            pkScript = {};
+            encode64LE(static_cast<uint64_t>(-1), sink);
+            encode16LE(output.version, sink);
+            Bitcoin::Script().encode(sink);
+        } else {
+            encode64LE(output.value, sink);
+            encode16LE(output.version, sink);
+            output.script.encode(sink);
         }
-        encode64LE(value, preimage);
-        encode16LE(output.version, preimage);
-        pkScript.encode(preimage);
     }
 
-    encode32LE(lockTime, preimage);
-    encode32LE(expiry, preimage);
+    encode32LE(lockTime, sink);
+    encode32LE(expiry, sink);
 
-    return Hash::blake256(preimage);
+    const auto hash = hasher.final();
+    return Data(hash.begin(), hash.end());
 }
 
 Data Transaction::computeWitnessHash(const std::vector<TransactionInput>& inputsToSign,
                                      const Bitcoin::Script& signScript,
                                      std::size_t signIndex) const {
-    const auto size = sigHashWitnessSize(inputsToSign, signScript);
-    auto witnessBuf = Data();
-    witnessBuf.reserve(size);
+    auto hasher = Hash::Blake256();
+    auto sink = HashSink<Hash::Blake256>(hasher);
 
     // Commit to the version and hash serialization type.
     encode32LE(static_cast<uint32_t>(version) |
                    (static_cast<uint32_t>(sigHashSerializeWitness) << 16),
-               witnessBuf);
+               sink);
 
     // Commit to the relevant transaction inputs.
-    encodeVarInt(inputsToSign.size(), witnessBuf);
+    encodeVarInt(inputsToSign.size(), sink);
     for (auto i = 0; i < inputsToSign.size(); i += 1) {
         if (i == signIndex) {
-            signScript.encode(witnessBuf);
+            signScript.encode(sink);
         } else {
-            Bitcoin::Script().encode(witnessBuf);
+            Bitcoin::Script().encode(sink);
         }
     }
 
-    return Hash::blake256(witnessBuf);
+    const auto hash = hasher.final();
+    return Data(hash.begin(), hash.end());
 }
 
 Data Transaction::hash() const {
@@ -213,28 +209,3 @@ Proto::Transaction Transaction::proto() const {
 
     return protoTx;
 }
-
-namespace {
-/// Returns the number of bytes the passed parameters would take when encoded
-/// with the format used by the witness hash portion of the overall signature
-/// hash.
-std::size_t sigHashWitnessSize(const std::vector<TransactionInput>& inputs,
-                               const Bitcoin::Script& signScript) {
-    // 1) 4 bytes version/serialization type
-    // 2) number of inputs varint
-    // 3) per input:
-    //    a) prevout pkscript varint (1 byte if not input being signed)
-    //    b) N bytes prevout pkscript (0 bytes if not input being signed)
-    //
-    // NOTE: The prevout pkscript is replaced by nil for all inputs except
-    // the input being signed.  Thus, all other inputs (aka numTxIns-1) commit
-    // to a nil script which gets encoded as a single 0x00 byte.  This is
-    // because encoding 0 as a varint results in 0x00 and there is no script
-    // to write.  So, rather than looping through all inputs and manually
-    // calculating the size per input, use (numTxIns - 1) as an
-    // optimization.
-    const auto numTxIns = inputs.size();
-    return 4 + varIntSize(numTxIns) + (numTxIns - 1) + varIntSize(signScript.bytes.size()) +
-           signScript.bytes.size();
-}
-} // namespace
@@ -20,8 +20,8 @@ struct DerivationPathIndex {
     uint32_t value = 0;
     bool hardened = true;
 
-    DerivationPathIndex() = default;
-    DerivationPathIndex(uint32_t value, bool hardened = true) : value(value), hardened(hardened) {}
+    constexpr DerivationPathIndex() = default;
+    constexpr DerivationPathIndex(uint32_t value, bool hardened = true) : value(value), hardened(hardened) {}
 
     /// The derivation index.
     uint32_t derivationIndex() const {
@@ -53,7 +53,7 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
         }
 
         // sign the transaction with a Signer
-        auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+        auto key = PrivateKey(input.private_key());
         auto chainId = Data(input.chain_id().begin(), input.chain_id().end());
         Signer(chainId).sign(key, type, tx);
 
@@ -15,3 +15,4 @@
 #include "ABI/Function.h"
 #include "ABI/ParamFactory.h"
 #include "ABI/ParamStruct.h"
+#include "ABI/TypedData.h"
@@ -15,7 +15,7 @@ using namespace TW::Ethereum::ABI;
 
 Data Function::getSignature() const {
     auto typ = getType();
-    auto hash = Hash::keccak256(Data(typ.begin(), typ.end()));
+    auto hash = Hash::keccak256(typ);
     auto signature = Data(hash.begin(), hash.begin() + 4);
     return signature;
 }
@@ -62,11 +62,7 @@ std::string ParamSetNamed::getType() const {
 }
 
 Data ParamSetNamed::encodeHashes() const {
-    Data hashes;
-    for (auto p: _params) {
-        append(hashes, p->hashStruct());
-    }
-    return hashes;
+    return ParamStruct::hashStructs(std::vector<std::shared_ptr<ParamBase>>(_params.begin(), _params.end()));
 }
 
 std::string ParamSetNamed::getExtraTypes(std::vector<std::string>& ignoreList) const {
@@ -114,6 +110,42 @@ Data ParamStruct::hashStruct() const {
     return hash;
 }
 
+Data ParamStruct::hashStructs(const std::vector<std::shared_ptr<ParamBase>>& params) {
+    std::vector<Data> hashes(params.size());
+    std::vector<Data> structHashes;
+    std::vector<size_t> structIndices;
+    for (size_t i = 0; i < params.size(); ++i) {
+        auto param = params[i];
+        if (auto named = std::dynamic_pointer_cast<ParamNamed>(param)) {
+            param = named->getParam();
+        }
+        auto paramStruct = std::dynamic_pointer_cast<ParamStruct>(param);
+        if (!paramStruct) {
+            hashes[i] = params[i]->hashStruct();
+            continue;
+        }
+        auto encoded = paramStruct->encodeHashes();
+        if (encoded.size() == 0) {
+            hashes[i] = Data(32);
+            continue;
+        }
+        structIndices.push_back(i);
+        structHashes.push_back(std::move(encoded));
+    }
+
+    std::vector<Data> digests;
+    Hash::keccak256Batch(structHashes, digests);
+    for (size_t j = 0; j < structIndices.size(); ++j) {
+        hashes[structIndices[j]] = std::move(digests[j]);
+    }
+
+    Data result;
+    for (const auto& hash: hashes) {
+        append(result, hash);
+    }
+    return result;
+}
+
 std::string ParamStruct::getExtraTypes(std::vector<std::string>& ignoreList) const {
     std::string types;
     if (std::find(ignoreList.begin(), ignoreList.end(), _name) == ignoreList.end()) {
@@ -153,14 +185,13 @@ Data ParamStruct::hashStructJson(const std::string& messageJson) {
         message["domain"].dump(),
         message["types"].dump());
     if (domainStruct) {
-        TW::append(hashes, domainStruct->hashStruct());
-
         auto messageStruct = makeStruct(
             message["primaryType"].get<std::string>(),
             message["message"].dump(),
             message["types"].dump());
         if (messageStruct) {
-            TW::append(hashes, messageStruct->hashStruct());
+            // domain and message hashes in one batch
+            TW::append(hashes, hashStructs({domainStruct, messageStruct}));
             return Hash::keccak256(hashes);
         }
     }
@@ -92,6 +92,10 @@ public:
     virtual std::string getExtraTypes(std::vector<std::string>& ignoreList) const;
     std::shared_ptr<ParamNamed> findParamByName(const std::string& name) const { return _params.findParamByName(name); }
 
+    /// Compute the concatenated hashStruct of each parameter.  Struct parameters are hashed together
+    /// in one keccak batch, other parameters hash themselves.
+    static Data hashStructs(const std::vector<std::shared_ptr<ParamBase>>& params);
+
     /// Compute the hash of a struct, used for signing, according to EIP712 ("v4").
     /// Input is a Json object (as string), with following fields:
     /// - types: map of used struct types (see makeTypes())
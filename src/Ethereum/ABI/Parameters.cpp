@@ -5,6 +5,7 @@
 // file LICENSE at the root of the source code distribution tree.
 
 #include "Parameters.h"
+#include "ParamStruct.h"
 #include "ValueEncoder.h"
 #include <Hash.h>
 
@@ -146,11 +147,7 @@ bool ParamSet::decode(const Data& encoded, size_t& offset_inout) {
 }
 
 Data ParamSet::encodeHashes() const {
-    Data hashes;
-    for (auto p: _params) {
-        append(hashes, p->hashStruct());
-    }
-    return hashes;
+    return ParamStruct::hashStructs(_params);
 }
 
 Data Parameters::hashStruct() const {
@@ -0,0 +1,173 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "TypedData.h"
+#include "ParamFactory.h"
+#include <Hash.h>
+#include <HexCoding.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace TW::Ethereum::ABI;
+using namespace TW;
+using json = nlohmann::json;
+
+static const Data EipStructPrefix = parse_hex("1901");
+static const auto Eip712Domain = "EIP712Domain";
+
+static bool isArrayType(const std::string& type) {
+    return type.length() >= 2 && type.substr(type.length() - 2, 2) == "[]";
+}
+
+TypedData::TypedData(const std::string& typesJson, const std::string& domainJson) {
+    auto types = json::parse(typesJson, nullptr, false);
+    if (types.is_discarded()) {
+        throw std::invalid_argument("Could not parse types Json");
+    }
+    if (!types.is_object()) {
+        throw std::invalid_argument("Expecting object");
+    }
+    // type order is not defined: first the names, then the fields
+    for (auto it = types.begin(); it != types.end(); ++it) {
+        structIndices.emplace(it.key(), structs.size());
+        structs.push_back(Struct{it.key()});
+    }
+    for (auto it = types.begin(); it != types.end(); ++it) {
+        auto& typeStruct = structs[structIndices.at(it.key())];
+        if (!it.value().is_array()) {
+            throw std::invalid_argument("Expecting array");
+        }
+        for (const auto& p : it.value()) {
+            if (!p.is_object() || !p.contains("name") || !p["name"].is_string() || !p.contains("type") || !p["type"].is_string() ||
+                p["name"].get<std::string>().empty() || p["type"].get<std::string>().empty()) {
+                throw std::invalid_argument("Expecting 'name' and 'type', in " + it.key());
+            }
+            auto field = Field{p["name"].get<std::string>(), p["type"].get<std::string>()};
+            if (auto param = ParamFactory::make(field.type)) {
+                // simple type (incl. array of simple type)
+                field.type = param->getType();
+            } else {
+                field.isArray = isArrayType(field.type);
+                const auto structType = field.isArray ? field.type.substr(0, field.type.length() - 2) : field.type;
+                const auto found = structIndices.find(structType);
+                if (found == structIndices.end()) {
+                    throw std::invalid_argument("Unknown type " + field.type);
+                }
+                field.structIndex = static_cast<int>(found->second);
+            }
+            typeStruct.fields.push_back(std::move(field));
+        }
+        if (typeStruct.fields.empty()) {
+            throw std::invalid_argument("No valid params found");
+        }
+    }
+    for (size_t i = 0; i < structs.size(); ++i) {
+        structs[i].typeHash = Hash::keccak256(TW::data(encodeType(i)));
+    }
+
+    auto domain = json::parse(domainJson, nullptr, false);
+    if (domain.is_discarded()) {
+        throw std::invalid_argument("Could not parse domain Json");
+    }
+    _domainSeparator = hashStruct(Eip712Domain, domain);
+}
+
+size_t TypedData::findStruct(const std::string& type) const {
+    const auto found = structIndices.find(type);
+    if (found == structIndices.end()) {
+        throw std::invalid_argument("Type not found, " + type);
+    }
+    return found->second;
+}
+
+std::string TypedData::encodeType(size_t index) const {
+    std::vector<std::string> ignoreList;
+    std::string types;
+    appendTypes(index, ignoreList, types);
+    return types;
+}
+
+// Same order as ParamStruct::getExtraTypes: the struct, then the types used by its fields, depth first.
+void TypedData::appendTypes(size_t index, std::vector<std::string>& ignoreList, std::string& types) const {
+    const auto& typeStruct = structs[index];
+    if (std::find(ignoreList.begin(), ignoreList.end(), typeStruct.name) == ignoreList.end()) {
+        types += typeStruct.name + "(";
+        for (size_t i = 0; i < typeStruct.fields.size(); ++i) {
+            if (i > 0) {
+                types += ",";
+            }
+            types += typeStruct.fields[i].type + " " + typeStruct.fields[i].name;
+        }
+        types += ")";
+        ignoreList.push_back(typeStruct.name);
+    }
+    for (const auto& field : typeStruct.fields) {
+        if (std::find(ignoreList.begin(), ignoreList.end(), field.type) == ignoreList.end()) {
+            if (field.structIndex >= 0) {
+                appendTypes(field.structIndex, ignoreList, types);
+            }
+            ignoreList.push_back(field.type);
+        }
+    }
+}
+
+Data TypedData::hashStruct(const std::string& type, const json& value) const {
+    return hashStruct(findStruct(type), value);
+}
+
+Data TypedData::hashStruct(size_t index, const json& value) const {
+    if (!value.is_object()) {
+        throw std::invalid_argument("Expecting object");
+    }
+    const auto& typeStruct = structs[index];
+    Data encoded;
+    encoded.reserve(32 * (1 + typeStruct.fields.size()));
+    append(encoded, typeStruct.typeHash);
+    static const json null;
+    for (const auto& field : typeStruct.fields) {
+        const auto found = value.find(field.name);
+        const auto& fieldValue = found == value.end() ? null : *found;
+        if (field.structIndex < 0) {
+            auto param = ParamFactory::make(field.type);
+            const auto valueString = fieldValue.is_string() ? fieldValue.get<std::string>() : fieldValue.dump();
+            if (!param->setValueJson(valueString)) {
+                throw std::invalid_argument("Could not set type for param " + field.name);
+            }
+            append(encoded, param->hashStruct());
+        } else if (field.isArray) {
+            if (!fieldValue.is_array()) {
+                throw std::invalid_argument("Value must be array for type " + field.type);
+            }
+            Data hashes;
+            hashes.reserve(32 * fieldValue.size());
+            for (const auto& element : fieldValue) {
+                append(hashes, hashStruct(field.structIndex, element));
+            }
+            // an empty array hashes to zero, as an empty ParamArray
+            append(encoded, hashes.empty() ? Data(32) : Hash::keccak256(hashes));
+        } else {
+            // a missing sub-struct hashes to zero, as an empty ParamStruct
+            append(encoded, fieldValue.is_null() ? Data(32) : hashStruct(field.structIndex, fieldValue));
+        }
+    }
+    return Hash::keccak256(encoded);
+}
+
+Data TypedData::hashMessage(const std::string& primaryType, const json& message) const {
+    Data hashes = EipStructPrefix;
+    append(hashes, _domainSeparator);
+    append(hashes, hashStruct(primaryType, message));
+    return Hash::keccak256(hashes);
+}
+
+Data TypedData::hashMessageJson(const std::string& primaryType, const std::string& messageJson) const {
+    auto message = json::parse(messageJson, nullptr, false);
+    if (message.is_discarded()) {
+        throw std::invalid_argument("Could not parse Json");
+    }
+    return hashMessage(primaryType, message);
+}
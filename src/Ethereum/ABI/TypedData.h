@@ -0,0 +1,81 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+
+#include <nlohmann/json.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace TW::Ethereum::ABI {
+
+/// EIP712 types and domain, compiled once for hashing many messages that share them.
+/// The type hash of each struct and the domain separator are computed on construction; messages are
+/// hashed straight from their values, without building parameter objects for the structs.
+/// Type hashes come from the declared types only; ParamStruct::hashStructJson derives them from the values, so the
+/// two give the same hashes as long as every struct field and struct array of the message has a value.
+class TypedData {
+public:
+    /// Compiles the types, in the form of the 'types' field of a typed data message (see ParamStruct::hashStructJson),
+    /// and hashes the domain, of type EIP712Domain.
+    /// Throws on error.
+    TypedData(const std::string& typesJson, const std::string& domainJson);
+
+    /// Returns the hash of the domain.
+    const Data& domainSeparator() const { return _domainSeparator; }
+
+    /// Returns the type hash of a struct.  Throws if the type is unknown.
+    const Data& typeHash(const std::string& type) const { return structs[findStruct(type)].typeHash; }
+
+    /// Returns the full type of a struct, extended by the used sub-types, as in ParamStruct::encodeType().
+    /// Throws if the type is unknown.
+    std::string encodeType(const std::string& type) const { return encodeType(findStruct(type)); }
+
+    /// Computes the hash of a struct value.  Throws on error.
+    Data hashStruct(const std::string& type, const nlohmann::json& value) const;
+
+    /// Computes the hash to sign of a message of the primary type, with the compiled domain.  Throws on error.
+    Data hashMessage(const std::string& primaryType, const nlohmann::json& message) const;
+
+    /// Same as hashMessage, with the message values given in Json.  Throws on error.
+    Data hashMessageJson(const std::string& primaryType, const std::string& messageJson) const;
+
+private:
+    struct Field {
+        std::string name;
+        /// Type, canonical for simple types
+        std::string type;
+        /// Index of the struct type, or of the element struct type of an array; -1 for simple types
+        int structIndex = -1;
+        bool isArray = false;
+    };
+
+    struct Struct {
+        std::string name;
+        std::vector<Field> fields;
+        Data typeHash;
+    };
+
+    size_t findStruct(const std::string& type) const;
+    std::string encodeType(size_t index) const;
+    void appendTypes(size_t index, std::vector<std::string>& ignoreList, std::string& types) const;
+    Data hashStruct(size_t index, const nlohmann::json& value) const;
+
+    std::vector<Struct> structs;
+    std::unordered_map<std::string, size_t> structIndices;
+    Data _domainSeparator;
+};
+
+} // namespace TW::Ethereum::ABI
+
+/// Wrapper for C interface.
+struct TWEthereumAbiTypedData {
+    TW::Ethereum::ABI::TypedData impl;
+};
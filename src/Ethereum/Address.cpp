@@ -38,8 +38,8 @@ Address::Address(const PublicKey& publicKey) {
     if (publicKey.type != TWPublicKeyTypeSECP256k1Extended) {
         throw std::invalid_argument("Ethereum::Address needs an extended SECP256k1 public key.");
     }
-    const auto data = publicKey.hash({}, static_cast<Hash::HasherSimpleType>(Hash::keccak256), true);
-    std::copy(data.end() - Address::size, data.end(), bytes.begin());
+    const auto hash = publicKey.hash<Hash::Algorithm::keccak256>(true);
+    std::copy(hash.end() - Address::size, hash.end(), bytes.begin());
 }
 
 std::string Address::string() const {
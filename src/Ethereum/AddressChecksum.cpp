@@ -13,9 +13,9 @@
 using namespace TW;
 using namespace TW::Ethereum;
 
-std::string Ethereum::checksumed(const Address& address, enum ChecksumType type) {
-    const auto addressString = hex(address.bytes);
-    const auto hash = hex(Hash::keccak256(addressString));
+/// Applies the checksum casing to a lowercase hex address, from the hash of that string.
+static std::string applyChecksum(const std::string& addressString, const Data& hashData) {
+    const auto hash = hex(hashData);
 
     std::string string = "0x";
     for (auto i = 0; i < std::min(addressString.size(), hash.size()); i += 1) {
@@ -32,3 +32,26 @@ std::string Ethereum::checksumed(const Address& address, enum ChecksumType type)
 
     return string;
 }
+
+std::string Ethereum::checksumed(const Address& address, enum ChecksumType type) {
+    const auto addressString = hex(address.bytes);
+    return applyChecksum(addressString, Hash::keccak256(addressString));
+}
+
+std::vector<std::string> Ethereum::checksumed(const std::vector<Address>& addresses, enum ChecksumType type) {
+    std::vector<Data> addressStrings;
+    addressStrings.reserve(addresses.size());
+    for (const auto& address : addresses) {
+        addressStrings.push_back(TW::data(hex(address.bytes)));
+    }
+    std::vector<Data> hashes;
+    Hash::keccak256Batch(addressStrings, hashes);
+
+    std::vector<std::string> strings;
+    strings.reserve(addresses.size());
+    for (size_t i = 0; i < addresses.size(); ++i) {
+        const auto& addressString = addressStrings[i];
+        strings.push_back(applyChecksum(std::string(addressString.begin(), addressString.end()), hashes[i]));
+    }
+    return strings;
+}
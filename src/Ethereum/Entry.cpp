@@ -7,7 +7,9 @@
 #include "Entry.h"
 
 #include "Address.h"
+#include "AddressChecksum.h"
 #include "Signer.h"
+#include "../Hash.h"
 
 using namespace TW::Ethereum;
 using namespace std;
@@ -25,6 +27,27 @@ string Entry::deriveAddress(TWCoinType coin, const PublicKey& publicKey, TW::byt
     return Address(publicKey).string();
 }
 
+vector<string> Entry::deriveAddresses(TWCoinType coin, const vector<PublicKey>& publicKeys, TW::byte, const char*) const {
+    // keccak of the keys without the type prefix, all in one batch
+    vector<TW::Data> keys;
+    keys.reserve(publicKeys.size());
+    for (const auto& publicKey : publicKeys) {
+        if (publicKey.type != TWPublicKeyTypeSECP256k1Extended) {
+            throw std::invalid_argument("Ethereum::Address needs an extended SECP256k1 public key.");
+        }
+        keys.emplace_back(publicKey.bytes.begin() + 1, publicKey.bytes.end());
+    }
+    vector<TW::Data> hashes;
+    TW::Hash::keccak256Batch(keys, hashes);
+
+    vector<Address> addresses;
+    addresses.reserve(hashes.size());
+    for (const auto& hash : hashes) {
+        addresses.emplace_back(TW::Data(hash.end() - Address::size, hash.end()));
+    }
+    return checksumed(addresses, ChecksumType::eip55);
+}
+
 void Entry::sign(TWCoinType coin, const TW::Data& dataIn, TW::Data& dataOut) const {
     signTemplate<Signer, Proto::SigningInput>(dataIn, dataOut);
 }
@@ -16,47 +16,29 @@ using namespace TW;
 using namespace TW::Ethereum;
 
 Data RLP::encode(const uint256_t& value) noexcept {
-    using boost::multiprecision::cpp_int;
-
-    Data bytes;
-    export_bits(value, std::back_inserter(bytes), 8);
-
-    if (bytes.empty() || (bytes.size() == 1 && bytes[0] == 0)) {
-        return {0x80};
-    }
-
-    return encode(bytes);
+    Data encoded;
+    appendEncoded(encoded, value);
+    return encoded;
 }
 
 Data RLP::encodeList(const Data& encoded) noexcept {
-    auto result = encodeHeader(encoded.size(), 0xc0, 0xf7);
-    result.reserve(result.size() + encoded.size());
+    Data result;
+    result.reserve(9 + encoded.size());
+    appendHeader(result, encoded.size(), 0xc0, 0xf7);
     result.insert(result.end(), encoded.begin(), encoded.end());
     return result;
 }
 
 Data RLP::encode(const Data& data) noexcept {
-    if (data.size() == 1 && data[0] <= 0x7f) {
-        // Fits in single byte, no header
-        return data;
-    }
-
-    auto encoded = encodeHeader(data.size(), 0x80, 0xb7);
-    encoded.insert(encoded.end(), data.begin(), data.end());
+    Data encoded;
+    encoded.reserve(9 + data.size());
+    appendEncoded(encoded, data.data(), data.size());
     return encoded;
 }
 
 Data RLP::encodeHeader(uint64_t size, uint8_t smallTag, uint8_t largeTag) noexcept {
-    if (size < 56) {
-        return {static_cast<uint8_t>(smallTag + size)};
-    }
-
-    const auto sizeData = putint(size);
-
-    auto header = Data();
-    header.reserve(1 + sizeData.size());
-    header.push_back(largeTag + static_cast<uint8_t>(sizeData.size()));
-    header.insert(header.end(), sizeData.begin(), sizeData.end());
+    Data header;
+    appendHeader(header, size, smallTag, largeTag);
     return header;
 }
 
@@ -10,6 +10,7 @@
 #include "../Data.h"
 #include "../uint256.h"
 
+#include <array>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -88,6 +89,47 @@ struct RLP {
     /// Encodes a list header.
     static Data encodeHeader(uint64_t size, uint8_t smallTag, uint8_t largeTag) noexcept;
 
+    /// Appends the encoding of a number to a byte buffer (Data or ArenaData), without intermediate buffers.
+    template <typename Buffer>
+    static void appendEncoded(Buffer& out, const uint256_t& number) noexcept {
+        std::array<uint8_t, 32> bytes;
+        const auto size = static_cast<size_t>(export_bits(number, bytes.begin(), 8) - bytes.begin());
+        if (size == 1 && bytes[0] == 0) {
+            out.push_back(0x80);
+            return;
+        }
+        appendEncoded(out, bytes.data(), size);
+    }
+
+    /// Appends the encoding of a block of data to a byte buffer.
+    template <typename Buffer>
+    static void appendEncoded(Buffer& out, const uint8_t* data, size_t size) noexcept {
+        if (size == 1 && data[0] <= 0x7f) {
+            // Fits in single byte, no header
+            out.push_back(data[0]);
+            return;
+        }
+        appendHeader(out, size, 0x80, 0xb7);
+        out.insert(out.end(), data, data + size);
+    }
+
+    /// Appends a string or list header to a byte buffer.
+    template <typename Buffer>
+    static void appendHeader(Buffer& out, uint64_t size, uint8_t smallTag, uint8_t largeTag) noexcept {
+        if (size < 56) {
+            out.push_back(static_cast<uint8_t>(smallTag + size));
+            return;
+        }
+        uint8_t sizeLength = 0;
+        for (auto rest = size; rest > 0; rest >>= 8) {
+            ++sizeLength;
+        }
+        out.push_back(static_cast<uint8_t>(largeTag + sizeLength));
+        for (auto shift = 8 * (sizeLength - 1); shift >= 0; shift -= 8) {
+            out.push_back(static_cast<uint8_t>(size >> shift));
+        }
+    }
+
     /// Returns the representation of an integer using the least number of bytes
     /// needed.
     static Data putint(uint64_t i) noexcept;
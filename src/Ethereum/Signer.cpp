@@ -6,6 +6,9 @@
 
 #include "Signer.h"
 #include "HexCoding.h"
+#include "../BinaryCoding.h"
+#include "../IncrementalHash.h"
+#include "../Parallel.h"
 #include <google/protobuf/util/json_util.h>
 
 using namespace TW;
@@ -14,7 +17,7 @@ using namespace TW::Ethereum;
 Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
     try {
         uint256_t chainID = load(input.chain_id());
-        auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+        auto key = PrivateKey(input.private_key());
         auto transaction = Signer::build(input);
 
         auto preHash = transaction->preHash(chainID);
@@ -169,3 +172,92 @@ Signature Signer::sign(const PrivateKey& privateKey, const uint256_t& chainID, s
     auto preHash = transaction->preHash(chainID);
     return Signer::sign(privateKey, chainID, preHash);
 }
+
+BatchSigner::BatchSigner(const Proto::SigningInput& input)
+    : privateKey(input.private_key()), chainID(load(input.chain_id())) {
+    switch (input.transaction().transaction_oneof_case()) {
+    case Proto::Transaction::kTransfer:
+        isToken = false;
+        RLP::appendEncoded(callPrefix, reinterpret_cast<const uint8_t*>(input.transaction().transfer().data().data()),
+            input.transaction().transfer().data().size());
+        break;
+    case Proto::Transaction::kErc20Transfer:
+        {
+            isToken = true;
+            const auto contract = addressStringToData(input.to_address());
+            RLP::appendEncoded(tokenItems, contract.data(), contract.size());
+            RLP::appendEncoded(tokenItems, uint256_t(0));
+            // selector and address padding, from the encoding of a call with an empty address
+            const auto call = TransactionNonTyped::buildERC20TransferCall(Data(20), 0);
+            callPrefix = Data(call.begin(), call.begin() + 4 + 12);
+        }
+        break;
+    default:
+        throw std::invalid_argument("Unsupported batch transaction");
+    }
+    RLP::appendEncoded(gasItems, load(input.gas_price()));
+    RLP::appendEncoded(gasItems, load(input.gas_limit()));
+    RLP::appendEncoded(chainItems, chainID);
+    RLP::appendEncoded(chainItems, uint256_t(0));
+    RLP::appendEncoded(chainItems, uint256_t(0));
+}
+
+Data BatchSigner::sign(const BatchTransfer& transfer) const {
+    if (transfer.to.size() != Address::size) {
+        throw std::invalid_argument("Invalid batch transfer address");
+    }
+    Data items;
+    items.reserve(3 * 33 + gasItems.size() + tokenItems.size() + callPrefix.size() + 3 + Address::size + 32 + chainItems.size());
+    RLP::appendEncoded(items, transfer.nonce);
+    append(items, gasItems);
+    if (isToken) {
+        append(items, tokenItems);
+        // data: transfer(to, amount), fixed size
+        RLP::appendHeader(items, callPrefix.size() + Address::size + 32, 0x80, 0xb7);
+        append(items, callPrefix);
+        append(items, transfer.to);
+        encode256BE(items, transfer.amount, 256);
+    } else {
+        RLP::appendEncoded(items, transfer.to.data(), transfer.to.size());
+        RLP::appendEncoded(items, transfer.amount);
+        append(items, callPrefix);
+    }
+    const auto itemsSize = items.size();
+
+    // pre-image: the items, then the chain items, in one list
+    Data header;
+    RLP::appendHeader(header, itemsSize + chainItems.size(), 0xc0, 0xf7);
+    const auto preHash = Hash::Keccak256().update(header).update(items).update(chainItems).final();
+    const auto signature = Signer::sign(privateKey, chainID, Data(preHash.begin(), preHash.end()));
+
+    // encoded: the items, then the signature, replacing the chain items
+    RLP::appendEncoded(items, signature.v);
+    RLP::appendEncoded(items, signature.r);
+    RLP::appendEncoded(items, signature.s);
+    Data encoded;
+    encoded.reserve(9 + items.size());
+    RLP::appendHeader(encoded, items.size(), 0xc0, 0xf7);
+    append(encoded, items);
+    return encoded;
+}
+
+Data BatchSigner::sign(const std::vector<BatchTransfer>& transfers, size_t threads) const {
+    std::vector<Data> encoded(transfers.size());
+    std::vector<Data> hashes(transfers.size());
+    parallelFor(transfers.size(), threads, [&](size_t i) {
+        encoded[i] = sign(transfers[i]);
+        hashes[i] = Hash::keccak256(encoded[i]);
+    });
+
+    size_t size = 0;
+    for (const auto& e : encoded) {
+        size += 4 + e.size() + 32;
+    }
+    Data result;
+    result.reserve(size);
+    for (size_t i = 0; i < transfers.size(); ++i) {
+        encodeLengthPrefixed(encoded[i], result);
+        append(result, hashes[i]);
+    }
+    return result;
+}
@@ -51,6 +51,46 @@ class Signer {
     static Signature valuesRSV(const uint256_t& chainID, const Data& signature) noexcept;
 };
 
+/// One transfer of a batch signed by BatchSigner.
+struct BatchTransfer {
+    /// Recipient address bytes
+    Data to;
+    uint256_t amount;
+    uint256_t nonce;
+};
+
+/// Signs many transfers from the same key, e.g. payouts with consecutive nonces.
+/// The key is parsed once, and everything the transfers have in common (gas fields, token contract,
+/// ABI call prefix, chain ID) is encoded once; only nonce, recipient and amount are encoded per transfer.
+class BatchSigner {
+  public:
+    /// Takes the key, chain ID and gas fields from a template signing input, with either a native transfer
+    /// (recipient and amount are replaced for each transfer, data is kept) or an ERC20 transfer
+    /// (to_address is the token contract).  Throws on unsupported or invalid input.
+    explicit BatchSigner(const Proto::SigningInput& input);
+
+    /// Signs the transfers on up to `threads` threads.
+    /// Returns, for each transfer in order, the length-prefixed encoded transaction followed by its 32-byte hash.
+    /// Throws if a transfer is invalid.
+    Data sign(const std::vector<BatchTransfer>& transfers, size_t threads) const;
+
+    /// Signs one transfer, returns the encoded transaction.
+    Data sign(const BatchTransfer& transfer) const;
+
+  private:
+    PrivateKey privateKey;
+    uint256_t chainID;
+    bool isToken;
+    /// Encoded gas price and gas limit
+    Data gasItems;
+    /// Encoded to and amount items, for token transfers
+    Data tokenItems;
+    /// Data of the call up to the recipient address (token transfers), or whole data item (native transfers)
+    Data callPrefix;
+    /// Encoded chain ID and empty r, s items, ending the pre-image
+    Data chainItems;
+};
+
 } // namespace TW::Ethereum
 
 /// Wrapper for C interface.
@@ -9,6 +9,8 @@
 #include "ABI/ParamBase.h"
 #include "ABI/ParamAddress.h"
 #include "RLP.h"
+#include "../IncrementalHash.h"
+#include "../SigningArena.h"
 
 using namespace TW::Ethereum::ABI;
 using namespace TW::Ethereum;
@@ -46,31 +48,43 @@ std::shared_ptr<TransactionNonTyped> TransactionNonTyped::buildERC1155Transfer(c
 }
 
 Data TransactionNonTyped::preHash(const uint256_t chainID) const {
-    Data encoded;
-    append(encoded, RLP::encode(nonce));
-    append(encoded, RLP::encode(gasPrice));
-    append(encoded, RLP::encode(gasLimit));
-    append(encoded, RLP::encode(to));
-    append(encoded, RLP::encode(amount));
-    append(encoded, RLP::encode(payload));
-    append(encoded, RLP::encode(chainID));
-    append(encoded, RLP::encode(0));
-    append(encoded, RLP::encode(0));
-    return Hash::keccak256(RLP::encodeList(encoded));
+    ArenaData encoded;
+    encoded.reserve(7 * 33 + to.size() + payload.size() + 18);
+    RLP::appendEncoded(encoded, nonce);
+    RLP::appendEncoded(encoded, gasPrice);
+    RLP::appendEncoded(encoded, gasLimit);
+    RLP::appendEncoded(encoded, to.data(), to.size());
+    RLP::appendEncoded(encoded, amount);
+    RLP::appendEncoded(encoded, payload.data(), payload.size());
+    RLP::appendEncoded(encoded, chainID);
+    RLP::appendEncoded(encoded, uint256_t(0));
+    RLP::appendEncoded(encoded, uint256_t(0));
+    // hash the list header and items without joining them first
+    ArenaData header;
+    header.reserve(9);
+    RLP::appendHeader(header, encoded.size(), 0xc0, 0xf7);
+    const auto hash = Hash::Keccak256().update(header).update(encoded).final();
+    return Data(hash.begin(), hash.end());
 }
 
 Data TransactionNonTyped::encoded(const Signature& signature, const uint256_t chainID) const {
-    Data encoded;
-    append(encoded, RLP::encode(nonce));
-    append(encoded, RLP::encode(gasPrice));
-    append(encoded, RLP::encode(gasLimit));
-    append(encoded, RLP::encode(to));
-    append(encoded, RLP::encode(amount));
-    append(encoded, RLP::encode(payload));
-    append(encoded, RLP::encode(signature.v));
-    append(encoded, RLP::encode(signature.r));
-    append(encoded, RLP::encode(signature.s));
-    return RLP::encodeList(encoded);
+    ArenaData encoded;
+    encoded.reserve(7 * 33 + to.size() + payload.size() + 18);
+    RLP::appendEncoded(encoded, nonce);
+    RLP::appendEncoded(encoded, gasPrice);
+    RLP::appendEncoded(encoded, gasLimit);
+    RLP::appendEncoded(encoded, to.data(), to.size());
+    RLP::appendEncoded(encoded, amount);
+    RLP::appendEncoded(encoded, payload.data(), payload.size());
+    RLP::appendEncoded(encoded, signature.v);
+    RLP::appendEncoded(encoded, signature.r);
+    RLP::appendEncoded(encoded, signature.s);
+    // items are gathered in the signing arena, only the returned encoding is heap-allocated
+    Data result;
+    result.reserve(9 + encoded.size());
+    RLP::appendHeader(result, encoded.size(), 0xc0, 0xf7);
+    result.insert(result.end(), encoded.begin(), encoded.end());
+    return result;
 }
 
 Data TransactionNonTyped::buildERC20TransferCall(const Data& to, const uint256_t& amount) {
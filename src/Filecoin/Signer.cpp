@@ -13,7 +13,7 @@ using namespace TW::Filecoin;
 
 Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
     // Load private key and transaction from Protobuf input.
-    auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto key = PrivateKey(input.private_key());
     auto pubkey = key.getPublicKey(TWPublicKeyTypeSECP256k1Extended);
     Address from_address(pubkey);
     Address to_address(input.to());
@@ -11,6 +11,7 @@
 #include "Bitcoin/SegwitAddress.h"
 #include "Bitcoin/CashAddress.h"
 #include "Coin.h"
+#include "Instrumentation.h"
 
 #include <TrustWalletCore/TWHRP.h>
 #include <TrezorCrypto/bip32.h>
@@ -23,9 +24,9 @@ using namespace TW;
 
 namespace {
 
-uint32_t fingerprint(HDNode *node, Hash::Hasher hasher);
-std::string serialize(const HDNode *node, uint32_t fingerprint, uint32_t version, bool use_public, Hash::Hasher hasher);
-bool deserialize(const std::string& extended, TWCurve curve, Hash::Hasher hasher, HDNode *node);
+uint32_t fingerprint(HDNode *node, Hash::Algorithm hasher);
+std::string serialize(const HDNode *node, uint32_t fingerprint, uint32_t version, bool use_public, Hash::Algorithm hasher);
+bool deserialize(const std::string& extended, TWCurve curve, Hash::Algorithm hasher, HDNode *node);
 HDNode getNode(const HDWallet& wallet, TWCurve curve, const DerivationPath& derivationPath);
 HDNode getMasterNode(const HDWallet& wallet, TWCurve curve);
 
@@ -72,17 +73,16 @@ void HDWallet::updateEntropy() {
 
 PrivateKey HDWallet::getMasterKey(TWCurve curve) const {
     auto node = getMasterNode(*this, curve);
-    auto data = Data(node.private_key, node.private_key + PrivateKey::size);
-    return PrivateKey(data);
+    return PrivateKey(PrivateKey::Bytes(node.private_key, node.private_key + PrivateKey::size));
 }
 
 PrivateKey HDWallet::getMasterKeyExtension(TWCurve curve) const {
     auto node = getMasterNode(*this, curve);
-    auto data = Data(node.private_key_extension, node.private_key_extension + PrivateKey::size);
-    return PrivateKey(data);
+    return PrivateKey(PrivateKey::Bytes(node.private_key_extension, node.private_key_extension + PrivateKey::size));
 }
 
 PrivateKey HDWallet::getKey(TWCoinType coin, const DerivationPath& derivationPath) const {
+    TW_INSTRUMENT_STAGE(deriveKey);
     const auto curve = TWCoinTypeCurve(coin);
     const auto privateKeyType = getPrivateKeyType(curve);
     auto node = getNode(*this, curve, derivationPath);
@@ -98,8 +98,7 @@ PrivateKey HDWallet::getKey(TWCoinType coin, const DerivationPath& derivationPat
         case PrivateKeyTypeDefault32:
         default:
             // default path
-            auto data = Data(node.private_key, node.private_key + PrivateKey::size);
-            return PrivateKey(data);
+            return PrivateKey(PrivateKey::Bytes(node.private_key, node.private_key + PrivateKey::size));
     }
 }
 
@@ -154,9 +153,9 @@ std::optional<PublicKey> HDWallet::getPublicKeyFromExtended(const std::string& e
     assert(curve != TWCurveED25519 && curve != TWCurveED25519Blake2bNano && curve != TWCurveED25519Extended && curve != TWCurveCurve25519);
     TWPublicKeyType keyType = TW::publicKeyType(coin);
     if (curve == TWCurveSECP256k1 && keyType == TWPublicKeyTypeSECP256k1) {
-        return PublicKey(Data(node.public_key, node.public_key + 33), TWPublicKeyTypeSECP256k1);
+        return PublicKey(PublicKey::Bytes(node.public_key, node.public_key + PublicKey::secp256k1Size), TWPublicKeyTypeSECP256k1);
     } else if (curve == TWCurveNIST256p1 && keyType == TWPublicKeyTypeNIST256p1) {
-        return PublicKey(Data(node.public_key, node.public_key + 33), TWPublicKeyTypeNIST256p1);
+        return PublicKey(PublicKey::Bytes(node.public_key, node.public_key + PublicKey::secp256k1Size), TWPublicKeyTypeNIST256p1);
     }
     return {};
 }
@@ -172,7 +171,7 @@ std::optional<PrivateKey> HDWallet::getPrivateKeyFromExtended(const std::string&
     hdnode_private_ckd(&node, path.change());
     hdnode_private_ckd(&node, path.address());
 
-    return PrivateKey(Data(node.private_key, node.private_key + 32));
+    return PrivateKey(PrivateKey::Bytes(node.private_key, node.private_key + PrivateKey::size));
 }
 
 HDWallet::PrivateKeyType HDWallet::getPrivateKeyType(TWCurve curve) {
@@ -188,13 +187,13 @@ HDWallet::PrivateKeyType HDWallet::getPrivateKeyType(TWCurve curve) {
 
 namespace {
 
-uint32_t fingerprint(HDNode *node, Hash::Hasher hasher) {
+uint32_t fingerprint(HDNode *node, Hash::Algorithm hasher) {
     hdnode_fill_public_key(node);
-    auto digest = hasher(node->public_key, 33);
+    auto digest = Hash::hash(hasher, node->public_key, 33);
     return ((uint32_t) digest[0] << 24) + (digest[1] << 16) + (digest[2] << 8) + digest[3];
 }
 
-std::string serialize(const HDNode *node, uint32_t fingerprint, uint32_t version, bool use_public, Hash::Hasher hasher) {
+std::string serialize(const HDNode *node, uint32_t fingerprint, uint32_t version, bool use_public, Hash::Algorithm hasher) {
     Data node_data;
     node_data.reserve(78);
 
@@ -210,10 +209,10 @@ std::string serialize(const HDNode *node, uint32_t fingerprint, uint32_t version
         node_data.insert(node_data.end(), node->private_key, node->private_key + 32);
     }
 
-    return Base58::bitcoin.encodeCheck(node_data, hasher);
+    return Hash::withAlgorithm(hasher, [&](auto a) { return Base58::bitcoin.encodeCheck<decltype(a)::value>(node_data); });
 }
 
-bool deserialize(const std::string& extended, TWCurve curve, Hash::Hasher hasher, HDNode* node) {
+bool deserialize(const std::string& extended, TWCurve curve, Hash::Algorithm hasher, HDNode* node) {
     memset(node, 0, sizeof(HDNode));
     const char* curveNameStr = curveName(curve);
     if (curveNameStr == nullptr || ::strlen(curveNameStr) == 0) {
@@ -222,7 +221,7 @@ bool deserialize(const std::string& extended, TWCurve curve, Hash::Hasher hasher
     node->curve = get_curve_by_name(curveNameStr);
     assert(node->curve != nullptr);
 
-    const auto node_data = Base58::bitcoin.decodeCheck(extended, hasher);
+    const auto node_data = Hash::withAlgorithm(hasher, [&](auto a) { return Base58::bitcoin.decodeCheck<decltype(a)::value>(extended); });
     if (node_data.size() != 78) {
         return false;
     }
@@ -69,7 +69,7 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput &input) noexcept {
 }
 
 Proto::SigningOutput Signer::signTransaction(const Proto::SigningInput &input) noexcept {
-    auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto key = PrivateKey(input.private_key());
     Address toAddr;
     if (!Address::decode(input.transaction_message().to_address(), toAddr)) {
         // invalid to address
@@ -97,7 +97,7 @@ Proto::SigningOutput Signer::signTransaction(const Proto::SigningInput &input) n
 }
 
 Proto::SigningOutput Signer::signCreateValidator(const Proto::SigningInput &input) noexcept {
-    auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto key = PrivateKey(input.private_key());
     auto description = Description(
         /* name */ input.staking_message().create_validator_message().description().name(),
         /* identity */ input.staking_message().create_validator_message().description().identity(),
@@ -179,7 +179,7 @@ Proto::SigningOutput Signer::signCreateValidator(const Proto::SigningInput &inpu
 }
 
 Proto::SigningOutput Signer::signEditValidator(const Proto::SigningInput &input) noexcept {
-    auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto key = PrivateKey(input.private_key());
 
     auto description = Description(
         /* name */ input.staking_message().edit_validator_message().description().name(),
@@ -238,7 +238,7 @@ Proto::SigningOutput Signer::signEditValidator(const Proto::SigningInput &input)
 }
 
 Proto::SigningOutput Signer::signDelegate(const Proto::SigningInput &input) noexcept {
-    auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto key = PrivateKey(input.private_key());
 
     Address delegatorAddr;
     if (!Address::decode(input.staking_message().delegate_message().delegator_address(),
@@ -268,7 +268,7 @@ Proto::SigningOutput Signer::signDelegate(const Proto::SigningInput &input) noex
 }
 
 Proto::SigningOutput Signer::signUndelegate(const Proto::SigningInput &input) noexcept {
-    auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto key = PrivateKey(input.private_key());
 
     Address delegatorAddr;
     if (!Address::decode(input.staking_message().undelegate_message().delegator_address(),
@@ -298,7 +298,7 @@ Proto::SigningOutput Signer::signUndelegate(const Proto::SigningInput &input) no
 }
 
 Proto::SigningOutput Signer::signCollectRewards(const Proto::SigningInput &input) noexcept {
-    auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto key = PrivateKey(input.private_key());
 
     Address delegatorAddr;
     if (!Address::decode(input.staking_message().collect_rewards().delegator_address(),
@@ -5,94 +5,99 @@
 // file LICENSE at the root of the source code distribution tree.
 
 #include "Hash.h"
+#include "Keccak.h"
 #include "XXHash64.h"
 #include "BinaryCoding.h"
+#include "Instrumentation.h"
 
 #include <TrezorCrypto/blake256.h>
-#include <TrezorCrypto/blake2b.h>
 #include <TrezorCrypto/groestl.h>
 #include <TrezorCrypto/ripemd160.h>
 #include <TrezorCrypto/sha2.h>
-#include <TrezorCrypto/sha3.h>
 #include <TrezorCrypto/hmac.h>
 
+#include <stdexcept>
 #include <string>
 
 using namespace TW;
 
 Data Hash::sha1(const byte* data, size_t size) {
+    TW_INSTRUMENT_COUNT(hashes, 1);
     Data result(sha1Size);
     sha1_Raw(data, size, result.data());
     return result;
 }
 
 Data Hash::sha256(const byte* data, size_t size) {
+    TW_INSTRUMENT_COUNT(hashes, 1);
     Data result(sha256Size);
     sha256_Raw(data, size, result.data());
     return result;
 }
 
 Data Hash::sha512(const byte* data, size_t size) {
+    TW_INSTRUMENT_COUNT(hashes, 1);
     Data result(sha512Size);
     sha512_Raw(data, size, result.data());
     return result;
 }
 
 Data Hash::sha512_256(const byte* data, size_t size) {
+    TW_INSTRUMENT_COUNT(hashes, 1);
     Data result(sha256Size);
     sha512_256_Raw(data, size, result.data());
     return result;
 }
 
 Data Hash::keccak256(const byte* data, size_t size) {
+    TW_INSTRUMENT_COUNT(hashes, 1);
     Data result(sha256Size);
-    keccak_256(data, size, result.data());
+    Keccak::sponge(data, size, Keccak::rate256, Keccak::padKeccak, result.data(), sha256Size);
     return result;
 }
 
+void Hash::keccak256Batch(const std::vector<Data>& inputs, std::vector<Data>& outputs) {
+    TW_INSTRUMENT_COUNT(hashes, inputs.size());
+    Keccak::spongeBatch(inputs, Keccak::rate256, Keccak::padKeccak, sha256Size, outputs);
+}
+
 Data Hash::keccak512(const byte* data, size_t size) {
+    TW_INSTRUMENT_COUNT(hashes, 1);
     Data result(sha512Size);
-    keccak_512(data, size, result.data());
+    Keccak::sponge(data, size, Keccak::rate512, Keccak::padKeccak, result.data(), sha512Size);
     return result;
 }
 
 Data Hash::sha3_256(const byte* data, size_t size) {
+    TW_INSTRUMENT_COUNT(hashes, 1);
     Data result(sha256Size);
-    ::sha3_256(data, size, result.data());
+    Keccak::sponge(data, size, Keccak::rate256, Keccak::padSHA3, result.data(), sha256Size);
     return result;
 }
 
 Data Hash::sha3_512(const byte* data, size_t size) {
+    TW_INSTRUMENT_COUNT(hashes, 1);
     Data result(sha512Size);
-    ::sha3_512(data, size, result.data());
+    Keccak::sponge(data, size, Keccak::rate512, Keccak::padSHA3, result.data(), sha512Size);
     return result;
 }
 
 Data Hash::ripemd(const byte* data, size_t size) {
+    TW_INSTRUMENT_COUNT(hashes, 1);
     Data result(ripemdSize);
     ::ripemd160(data, static_cast<uint32_t>(size), result.data());
     return result;
 }
 
 Data Hash::blake256(const byte* data, size_t size) {
+    TW_INSTRUMENT_COUNT(hashes, 1);
     Data result(sha256Size);
     ::blake256(data, size, result.data());
     return result;
 }
 
-Data Hash::blake2b(const byte* data, size_t dataSize, size_t hashSize) {
-    Data result(hashSize);
-    ::blake2b(data, static_cast<uint32_t>(dataSize), result.data(), hashSize);
-    return result;
-}
-
-Data Hash::blake2b(const byte* data, size_t dataSize, size_t hashSize, const Data& personal) {
-    Data result(hashSize);
-    ::blake2b_Personal(data, static_cast<uint32_t>(dataSize), personal.data(), personal.size(), result.data(), hashSize);
-    return result;
-}
-
 Data Hash::groestl512(const byte* data, size_t size) {
+    TW_INSTRUMENT_COUNT(hashes, 1);
     GROESTL512_CTX ctx;
     Data result(sha512Size);
     groestl512_Init(&ctx);
@@ -101,6 +106,83 @@ Data Hash::groestl512(const byte* data, size_t size) {
     return result;
 }
 
+template <Hash::Algorithm A>
+Hash::Digest<A> Hash::digest(const byte* data, size_t size) {
+    TW_INSTRUMENT_COUNT(hashes, 1);
+    Digest<A> result;
+    if constexpr (A == Algorithm::sha1) {
+        sha1_Raw(data, size, result.data());
+    } else if constexpr (A == Algorithm::sha256) {
+        sha256_Raw(data, size, result.data());
+    } else if constexpr (A == Algorithm::sha512) {
+        sha512_Raw(data, size, result.data());
+    } else if constexpr (A == Algorithm::sha512_256) {
+        sha512_256_Raw(data, size, result.data());
+    } else if constexpr (A == Algorithm::keccak256 || A == Algorithm::keccak512) {
+        const auto rate = (A == Algorithm::keccak256) ? Keccak::rate256 : Keccak::rate512;
+        Keccak::sponge(data, size, rate, Keccak::padKeccak, result.data(), result.size());
+    } else if constexpr (A == Algorithm::sha3_256 || A == Algorithm::sha3_512) {
+        const auto rate = (A == Algorithm::sha3_256) ? Keccak::rate256 : Keccak::rate512;
+        Keccak::sponge(data, size, rate, Keccak::padSHA3, result.data(), result.size());
+    } else if constexpr (A == Algorithm::ripemd) {
+        ::ripemd160(data, static_cast<uint32_t>(size), result.data());
+    } else if constexpr (A == Algorithm::blake256) {
+        ::blake256(data, size, result.data());
+    } else if constexpr (A == Algorithm::groestl512) {
+        GROESTL512_CTX ctx;
+        groestl512_Init(&ctx);
+        groestl512_Update(&ctx, data, size);
+        groestl512_Final(&ctx, result.data());
+    } else if constexpr (A == Algorithm::sha256d) {
+        result = digest<Algorithm::sha256>(digest<Algorithm::sha256>(data, size));
+    } else if constexpr (A == Algorithm::sha256ripemd) {
+        result = digest<Algorithm::ripemd>(digest<Algorithm::sha256>(data, size));
+    } else if constexpr (A == Algorithm::sha3_256ripemd) {
+        result = digest<Algorithm::ripemd>(digest<Algorithm::sha3_256>(data, size));
+    } else if constexpr (A == Algorithm::blake256d) {
+        result = digest<Algorithm::blake256>(digest<Algorithm::blake256>(data, size));
+    } else if constexpr (A == Algorithm::blake256ripemd) {
+        result = digest<Algorithm::ripemd>(digest<Algorithm::blake256>(data, size));
+    } else if constexpr (A == Algorithm::groestl512d) {
+        result = digest<Algorithm::groestl512>(digest<Algorithm::groestl512>(data, size));
+    }
+    return result;
+}
+
+namespace TW::Hash {
+template Digest<Algorithm::sha1> digest<Algorithm::sha1>(const byte*, size_t);
+template Digest<Algorithm::sha256> digest<Algorithm::sha256>(const byte*, size_t);
+template Digest<Algorithm::sha512> digest<Algorithm::sha512>(const byte*, size_t);
+template Digest<Algorithm::sha512_256> digest<Algorithm::sha512_256>(const byte*, size_t);
+template Digest<Algorithm::keccak256> digest<Algorithm::keccak256>(const byte*, size_t);
+template Digest<Algorithm::keccak512> digest<Algorithm::keccak512>(const byte*, size_t);
+template Digest<Algorithm::sha3_256> digest<Algorithm::sha3_256>(const byte*, size_t);
+template Digest<Algorithm::sha3_512> digest<Algorithm::sha3_512>(const byte*, size_t);
+template Digest<Algorithm::ripemd> digest<Algorithm::ripemd>(const byte*, size_t);
+template Digest<Algorithm::blake256> digest<Algorithm::blake256>(const byte*, size_t);
+template Digest<Algorithm::groestl512> digest<Algorithm::groestl512>(const byte*, size_t);
+template Digest<Algorithm::sha256d> digest<Algorithm::sha256d>(const byte*, size_t);
+template Digest<Algorithm::sha256ripemd> digest<Algorithm::sha256ripemd>(const byte*, size_t);
+template Digest<Algorithm::sha3_256ripemd> digest<Algorithm::sha3_256ripemd>(const byte*, size_t);
+template Digest<Algorithm::blake256d> digest<Algorithm::blake256d>(const byte*, size_t);
+template Digest<Algorithm::blake256ripemd> digest<Algorithm::blake256ripemd>(const byte*, size_t);
+template Digest<Algorithm::groestl512d> digest<Algorithm::groestl512d>(const byte*, size_t);
+} // namespace TW::Hash
+
+namespace {
+
+template <Hash::Algorithm A>
+Data digestData(const byte* data, size_t size) {
+    const auto hash = Hash::digest<A>(data, size);
+    return Data(hash.begin(), hash.end());
+}
+
+} // namespace
+
+Data Hash::hash(Algorithm algorithm, const byte* data, size_t size) {
+    return withAlgorithm(algorithm, [&](auto a) { return digestData<decltype(a)::value>(data, size); });
+}
+
 uint64_t Hash::xxhash(const byte* data, size_t size, uint64_t seed)
 {
     return XXHash64::hash(data, size, seed);
@@ -8,7 +8,10 @@
 
 #include "Data.h"
 
+#include <array>
 #include <functional>
+#include <stdexcept>
+#include <type_traits>
 
 namespace TW::Hash {
 
@@ -29,6 +32,91 @@ static const size_t sha512Size = 64;
 /// Number of bytes in a RIPEMD160 hash.
 static const size_t ripemdSize = 20;
 
+/// Hash functions with a fixed digest size, selectable at compile time with `digest`.
+enum class Algorithm {
+    sha1,
+    sha256,
+    sha512,
+    sha512_256,
+    keccak256,
+    keccak512,
+    sha3_256,
+    sha3_512,
+    ripemd,
+    blake256,
+    groestl512,
+    sha256d,
+    sha256ripemd,
+    sha3_256ripemd,
+    blake256d,
+    blake256ripemd,
+    groestl512d,
+};
+
+/// Number of bytes in the digest of a hash function.
+constexpr size_t digestSize(Algorithm algorithm) {
+    switch (algorithm) {
+    case Algorithm::sha1:
+    case Algorithm::ripemd:
+    case Algorithm::sha256ripemd:
+    case Algorithm::sha3_256ripemd:
+    case Algorithm::blake256ripemd:
+        return ripemdSize;
+    case Algorithm::sha512:
+    case Algorithm::keccak512:
+    case Algorithm::sha3_512:
+    case Algorithm::groestl512:
+    case Algorithm::groestl512d:
+        return sha512Size;
+    default:
+        return sha256Size;
+    }
+}
+
+/// Fixed-size digest of a hash function, held on the stack.
+template <Algorithm A>
+using Digest = std::array<byte, digestSize(A)>;
+
+/// Computes the hash selected at compile time, without allocating.
+/// Instantiated in Hash.cpp for every `Algorithm`.
+template <Algorithm A>
+Digest<A> digest(const byte* data, size_t size);
+
+/// Computes the hash selected at compile time, without allocating.
+template <Algorithm A, typename T>
+Digest<A> digest(const T& data) {
+    return digest<A>(reinterpret_cast<const byte*>(data.data()), data.size());
+}
+
+/// Calls `f` with the algorithm selected at runtime as a compile-time constant, `std::integral_constant<Algorithm, A>`,
+/// so that code templated on the algorithm (e.g. `digest<A>`) can be used without a type-erased hasher.
+template <typename F>
+decltype(auto) withAlgorithm(Algorithm algorithm, F&& f) {
+    switch (algorithm) {
+    case Algorithm::sha1: return f(std::integral_constant<Algorithm, Algorithm::sha1>{});
+    case Algorithm::sha256: return f(std::integral_constant<Algorithm, Algorithm::sha256>{});
+    case Algorithm::sha512: return f(std::integral_constant<Algorithm, Algorithm::sha512>{});
+    case Algorithm::sha512_256: return f(std::integral_constant<Algorithm, Algorithm::sha512_256>{});
+    case Algorithm::keccak256: return f(std::integral_constant<Algorithm, Algorithm::keccak256>{});
+    case Algorithm::keccak512: return f(std::integral_constant<Algorithm, Algorithm::keccak512>{});
+    case Algorithm::sha3_256: return f(std::integral_constant<Algorithm, Algorithm::sha3_256>{});
+    case Algorithm::sha3_512: return f(std::integral_constant<Algorithm, Algorithm::sha3_512>{});
+    case Algorithm::ripemd: return f(std::integral_constant<Algorithm, Algorithm::ripemd>{});
+    case Algorithm::blake256: return f(std::integral_constant<Algorithm, Algorithm::blake256>{});
+    case Algorithm::groestl512: return f(std::integral_constant<Algorithm, Algorithm::groestl512>{});
+    case Algorithm::sha256d: return f(std::integral_constant<Algorithm, Algorithm::sha256d>{});
+    case Algorithm::sha256ripemd: return f(std::integral_constant<Algorithm, Algorithm::sha256ripemd>{});
+    case Algorithm::sha3_256ripemd: return f(std::integral_constant<Algorithm, Algorithm::sha3_256ripemd>{});
+    case Algorithm::blake256d: return f(std::integral_constant<Algorithm, Algorithm::blake256d>{});
+    case Algorithm::blake256ripemd: return f(std::integral_constant<Algorithm, Algorithm::blake256ripemd>{});
+    case Algorithm::groestl512d: return f(std::integral_constant<Algorithm, Algorithm::groestl512d>{});
+    }
+    throw std::invalid_argument("Invalid hash algorithm");
+}
+
+/// Computes the hash selected at runtime, e.g. from coin configuration.
+Data hash(Algorithm algorithm, const byte* data, size_t size);
+
 /// Computes the SHA1 hash.
 Data sha1(const byte* data, size_t size);
 
@@ -44,6 +132,10 @@ Data sha512_256(const byte* data, size_t size);
 /// Computes the Keccak SHA256 hash.
 Data keccak256(const byte* data, size_t size);
 
+/// Computes the Keccak SHA256 hash for each input, outputs are resized to match.
+/// Messages are hashed several at a time: 4 lanes with AVX2, 2 lanes otherwise.
+void keccak256Batch(const std::vector<Data>& inputs, std::vector<Data>& outputs);
+
 /// Computes the Keccak SHA512 hash.
 Data keccak512(const byte* data, size_t size);
 
@@ -62,7 +154,8 @@ Data blake256(const byte* data, size_t size);
 /// Computes the Blake2b hash.
 Data blake2b(const byte* data, size_t dataSize, size_t hashSize);
 
-Data blake2b(const byte* data, size_t dataSize, size_t hsshSize, const Data& personal);
+/// Computes the Blake2b hash with a 16-byte personalization string.
+Data blake2b(const byte* data, size_t dataSize, size_t hashSize, const Data& personal);
 
 /// Computes the Groestl 512 hash.
 Data groestl512(const byte* data, size_t size);
@@ -93,6 +186,12 @@ Data hash(Hasher hasher, const T& data) {
     return hasher(reinterpret_cast<const byte*>(data.data()), data.size());
 }
 
+/// Computes requested hash for data.
+template <typename T>
+Data hash(Algorithm algorithm, const T& data) {
+    return hash(algorithm, reinterpret_cast<const byte*>(data.data()), data.size());
+}
+
 /// Computes the SHA1 hash.
 template <typename T>
 Data sha1(const T& data) {
@@ -164,6 +263,48 @@ Data blake2b(const T& data, size_t size, const Data& personal) {
     return blake2b(reinterpret_cast<const byte*>(data.data()), data.size(), size, personal);
 }
 
+/// Number of bytes in the largest Blake2b hash.
+static const size_t blake2bMaxSize = 64;
+
+/// Number of bytes in a Blake2b personalization string.
+static const size_t blake2bPersonalSize = 16;
+
+/// Streaming Blake2b hasher, for messages assembled from several pieces.
+///
+/// Produces the same digest as `blake2b` over the concatenated input, without
+/// building the concatenation first.
+class Blake2b {
+public:
+    /// Number of bytes in a Blake2b input block.
+    static const size_t blockSize = 128;
+
+    explicit Blake2b(size_t hashSize);
+
+    /// Initializes a personalized hasher; `personal` must be 16 bytes.
+    Blake2b(size_t hashSize, const Data& personal);
+    Blake2b(size_t hashSize, const byte* personal, size_t personalSize);
+
+    /// Appends data to the message.
+    Blake2b& update(const byte* data, size_t size);
+
+    template <typename T>
+    Blake2b& update(const T& data) {
+        return update(reinterpret_cast<const byte*>(data.data()), data.size());
+    }
+
+    /// Finishes the message and returns its hash; the hasher must not be updated afterwards.
+    Data final();
+
+private:
+    void compressBlock(const byte* block, bool last);
+
+    size_t hashSize;
+    uint64_t state[8];
+    uint64_t counter = 0;
+    byte buffer[blockSize];
+    size_t bufferSize = 0;
+};
+
 /// Computes the Groestl512 hash.
 template <typename T>
 Data groestl512(const T& data) {
@@ -172,32 +313,42 @@ Data groestl512(const T& data) {
 
 /// Computes the SHA256 hash of the SHA256 hash.
 inline Data sha256d(const byte* data, size_t size) {
-    return sha256(sha256(data, size));
+    const auto hash = digest<Algorithm::sha256d>(data, size);
+    return Data(hash.begin(), hash.end());
 }
 
 /// Computes the ripemd hash of the SHA256 hash.
 inline Data sha256ripemd(const byte* data, size_t size) {
-    return ripemd(sha256(data, size));
+    const auto hash = digest<Algorithm::sha256ripemd>(data, size);
+    return Data(hash.begin(), hash.end());
 }
 
+/// Computes the ripemd hash of the SHA256 hash for each input, outputs are resized to match.
+/// 33 and 65-byte inputs (public keys) go through a multi-lane kernel: 8 lanes with AVX2, 4 lanes otherwise.
+void hash160Batch(const std::vector<Data>& inputs, std::vector<Data>& outputs);
+
 /// Computes the ripemd hash of the SHA256 hash.
 inline Data sha3_256ripemd(const byte* data, size_t size) {
-    return ripemd(sha3_256(data, size));
+    const auto hash = digest<Algorithm::sha3_256ripemd>(data, size);
+    return Data(hash.begin(), hash.end());
 }
 
 /// Computes the Blake256 hash of the Blake256 hash.
 inline Data blake256d(const byte* data, size_t size) {
-    return blake256(blake256(data, size));
+    const auto hash = digest<Algorithm::blake256d>(data, size);
+    return Data(hash.begin(), hash.end());
 }
 
 /// Computes the ripemd hash of the Blake256 hash.
 inline Data blake256ripemd(const byte* data, size_t size) {
-    return ripemd(blake256(data, size));
+    const auto hash = digest<Algorithm::blake256ripemd>(data, size);
+    return Data(hash.begin(), hash.end());
 }
 
 /// Computes the Groestl512 hash of the Groestl512 hash.
 inline Data groestl512d(const byte* data, size_t size) {
-    return groestl512(groestl512(data, size));
+    const auto hash = digest<Algorithm::groestl512d>(data, size);
+    return Data(hash.begin(), hash.end());
 }
 
 /// Compute the SHA256-based HMAC of a message
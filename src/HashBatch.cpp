@@ -0,0 +1,281 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Hash.h"
+#include "SIMD.h"
+
+#include <cstring>
+
+using namespace TW;
+using namespace TW::SIMD;
+
+namespace {
+
+// SHA256 (FIPS 180-4), multi-lane
+
+constexpr uint32_t sha256K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+constexpr uint32_t sha256Init[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+template <typename V>
+TW_SIMD_INLINE V rotr32(V x, int n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+template <typename V>
+TW_SIMD_INLINE V rotl32(V x, int n) {
+    return (x << n) | (x >> (32 - n));
+}
+
+template <typename V>
+TW_SIMD_INLINE V bswap32(V x) {
+    return (x >> 24) | ((x >> 8) & 0xff00) | ((x << 8) & 0xff0000) | (x << 24);
+}
+
+template <typename V>
+TW_SIMD_INLINE void sha256Block(V state[8], const V block[16]) {
+    V w[64];
+    for (int t = 0; t < 16; ++t) {
+        w[t] = block[t];
+    }
+    for (int t = 16; t < 64; ++t) {
+        const V s0 = rotr32(w[t - 15], 7) ^ rotr32(w[t - 15], 18) ^ (w[t - 15] >> 3);
+        const V s1 = rotr32(w[t - 2], 17) ^ rotr32(w[t - 2], 19) ^ (w[t - 2] >> 10);
+        w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+    }
+
+    V a = state[0], b = state[1], c = state[2], d = state[3];
+    V e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int t = 0; t < 64; ++t) {
+        const V s1 = rotr32(e, 6) ^ rotr32(e, 11) ^ rotr32(e, 25);
+        const V ch = (e & f) ^ (~e & g);
+        const V t1 = h + s1 + ch + sha256K[t] + w[t];
+        const V s0 = rotr32(a, 2) ^ rotr32(a, 13) ^ rotr32(a, 22);
+        const V maj = (a & b) ^ (a & c) ^ (b & c);
+        const V t2 = s0 + maj;
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+// RIPEMD160, multi-lane
+
+constexpr int ripemdRL[80] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    7, 4, 13, 1, 10, 6, 15, 3, 12, 0, 9, 5, 2, 14, 11, 8,
+    3, 10, 14, 4, 9, 15, 8, 1, 2, 7, 0, 6, 13, 11, 5, 12,
+    1, 9, 11, 10, 0, 8, 12, 4, 13, 3, 7, 15, 14, 5, 6, 2,
+    4, 0, 5, 9, 7, 12, 2, 10, 14, 1, 3, 8, 11, 6, 15, 13,
+};
+constexpr int ripemdRR[80] = {
+    5, 14, 7, 0, 9, 2, 11, 4, 13, 6, 15, 8, 1, 10, 3, 12,
+    6, 11, 3, 7, 0, 13, 5, 10, 14, 15, 8, 12, 4, 9, 1, 2,
+    15, 5, 1, 3, 7, 14, 6, 9, 11, 8, 12, 2, 10, 0, 4, 13,
+    8, 6, 4, 1, 3, 11, 15, 0, 5, 12, 2, 13, 9, 7, 10, 14,
+    12, 15, 10, 4, 1, 5, 8, 7, 6, 2, 13, 14, 0, 3, 9, 11,
+};
+constexpr int ripemdSL[80] = {
+    11, 14, 15, 12, 5, 8, 7, 9, 11, 13, 14, 15, 6, 7, 9, 8,
+    7, 6, 8, 13, 11, 9, 7, 15, 7, 12, 15, 9, 11, 7, 13, 12,
+    11, 13, 6, 7, 14, 9, 13, 15, 14, 8, 13, 6, 5, 12, 7, 5,
+    11, 12, 14, 15, 14, 15, 9, 8, 9, 14, 5, 6, 8, 6, 5, 12,
+    9, 15, 5, 11, 6, 8, 13, 12, 5, 12, 13, 14, 11, 8, 5, 6,
+};
+constexpr int ripemdSR[80] = {
+    8, 9, 9, 11, 13, 15, 15, 5, 7, 7, 8, 11, 14, 14, 12, 6,
+    9, 13, 15, 7, 12, 8, 9, 11, 7, 7, 12, 7, 6, 15, 13, 11,
+    9, 7, 15, 11, 8, 6, 6, 14, 12, 13, 5, 14, 13, 13, 7, 5,
+    15, 5, 8, 11, 14, 14, 6, 14, 6, 9, 12, 9, 12, 5, 15, 8,
+    8, 5, 12, 9, 12, 5, 14, 6, 8, 13, 6, 5, 15, 13, 11, 11,
+};
+constexpr uint32_t ripemdKL[5] = {0x00000000, 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xa953fd4e};
+constexpr uint32_t ripemdKR[5] = {0x50a28be6, 0x5c4dd124, 0x6d703ef3, 0x7a6d76e9, 0x00000000};
+
+template <int R, typename V>
+TW_SIMD_INLINE V ripemdF(V x, V y, V z) {
+    if constexpr (R == 0) {
+        return x ^ y ^ z;
+    } else if constexpr (R == 1) {
+        return (x & y) | (~x & z);
+    } else if constexpr (R == 2) {
+        return (x | ~y) ^ z;
+    } else if constexpr (R == 3) {
+        return (x & z) | (y & ~z);
+    } else {
+        return x ^ (y | ~z);
+    }
+}
+
+/// One 16-step round of both lines; the right line uses the boolean functions in reverse order.
+template <int R, typename V>
+TW_SIMD_INLINE void ripemdRound(V l[5], V r[5], const V x[16]) {
+    for (int i = 0; i < 16; ++i) {
+        const int j = R * 16 + i;
+        V t = rotl32(l[0] + ripemdF<R>(l[1], l[2], l[3]) + x[ripemdRL[j]] + ripemdKL[R], ripemdSL[j]) + l[4];
+        l[0] = l[4]; l[4] = l[3]; l[3] = rotl32(l[2], 10); l[2] = l[1]; l[1] = t;
+        t = rotl32(r[0] + ripemdF<4 - R>(r[1], r[2], r[3]) + x[ripemdRR[j]] + ripemdKR[R], ripemdSR[j]) + r[4];
+        r[0] = r[4]; r[4] = r[3]; r[3] = rotl32(r[2], 10); r[2] = r[1]; r[1] = t;
+    }
+}
+
+template <typename V>
+TW_SIMD_INLINE void ripemdBlock(V state[5], const V x[16]) {
+    V l[5] = {state[0], state[1], state[2], state[3], state[4]};
+    V r[5] = {state[0], state[1], state[2], state[3], state[4]};
+    ripemdRound<0>(l, r, x);
+    ripemdRound<1>(l, r, x);
+    ripemdRound<2>(l, r, x);
+    ripemdRound<3>(l, r, x);
+    ripemdRound<4>(l, r, x);
+    const V t = state[1] + l[2] + r[3];
+    state[1] = state[2] + l[3] + r[4];
+    state[2] = state[3] + l[4] + r[0];
+    state[3] = state[4] + l[0] + r[1];
+    state[4] = state[0] + l[1] + r[2];
+    state[0] = t;
+}
+
+inline uint32_t readBE32(const byte* p) {
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+/// Computes RIPEMD160(SHA256(in)) for as many same-size inputs as the lane type has lanes.
+/// Inputs must be at most 119 bytes, so that the padded SHA256 message fits in two blocks.
+template <typename V>
+TW_SIMD_INLINE void hash160Lanes(const byte* const* in, size_t size, byte* const* out) {
+    constexpr auto L = lanes<V>();
+    const size_t blocks = size <= 55 ? 1 : 2;
+
+    // pad each lane's message, then transpose into lane-vectors
+    byte padded[L][128];
+    for (size_t lane = 0; lane < L; ++lane) {
+        std::memset(padded[lane], 0, sizeof(padded[lane]));
+        std::memcpy(padded[lane], in[lane], size);
+        padded[lane][size] = 0x80;
+        const uint64_t bits = uint64_t(size) * 8;
+        for (int i = 0; i < 8; ++i) {
+            padded[lane][blocks * 64 - 1 - i] = static_cast<byte>(bits >> (8 * i));
+        }
+    }
+
+    V state[8];
+    for (int i = 0; i < 8; ++i) {
+        state[i] = V{} + sha256Init[i];
+    }
+    for (size_t b = 0; b < blocks; ++b) {
+        V w[16];
+        for (int i = 0; i < 16; ++i) {
+            for (size_t lane = 0; lane < L; ++lane) {
+                w[i][lane] = readBE32(padded[lane] + b * 64 + i * 4);
+            }
+        }
+        sha256Block(state, w);
+    }
+
+    // RIPEMD160 over the 32-byte digest: little-endian words, single padded block
+    V x[16];
+    for (int i = 0; i < 8; ++i) {
+        x[i] = bswap32(state[i]);
+    }
+    x[8] = V{} + 0x80u;
+    for (int i = 9; i < 16; ++i) {
+        x[i] = V{};
+    }
+    x[14] = V{} + 256u;
+
+    V h[5] = {V{} + 0x67452301u, V{} + 0xefcdab89u, V{} + 0x98badcfeu, V{} + 0x10325476u, V{} + 0xc3d2e1f0u};
+    ripemdBlock(h, x);
+
+    for (size_t lane = 0; lane < L; ++lane) {
+        for (int i = 0; i < 5; ++i) {
+            const uint32_t v = h[i][lane];
+            out[lane][i * 4 + 0] = static_cast<byte>(v);
+            out[lane][i * 4 + 1] = static_cast<byte>(v >> 8);
+            out[lane][i * 4 + 2] = static_cast<byte>(v >> 16);
+            out[lane][i * 4 + 3] = static_cast<byte>(v >> 24);
+        }
+    }
+}
+
+void hash160x4(const byte* const* in, size_t size, byte* const* out) {
+    hash160Lanes<u32x4>(in, size, out);
+}
+
+#if defined(TW_SIMD_X86)
+TW_SIMD_TARGET_AVX2 void hash160x8(const byte* const* in, size_t size, byte* const* out) {
+    hash160Lanes<u32x8>(in, size, out);
+}
+#endif
+
+/// Runs the widest available kernel over a group of same-size inputs; a partial last group
+/// is filled up by repeating its first lane, those results are discarded.
+void hash160Group(const std::vector<Data>& inputs, const std::vector<size_t>& indices, size_t size, std::vector<Data>& outputs) {
+    size_t width = 4;
+    auto kernel = hash160x4;
+#if defined(TW_SIMD_X86)
+    if (hasAVX2()) {
+        width = 8;
+        kernel = hash160x8;
+    }
+#endif
+    const byte* in[8];
+    byte* out[8];
+    byte scratch[8][Hash::ripemdSize];
+    for (size_t start = 0; start < indices.size(); start += width) {
+        for (size_t lane = 0; lane < width; ++lane) {
+            if (start + lane < indices.size()) {
+                const auto index = indices[start + lane];
+                in[lane] = inputs[index].data();
+                out[lane] = outputs[index].data();
+            } else {
+                in[lane] = in[0];
+                out[lane] = scratch[lane];
+            }
+        }
+        kernel(in, size, out);
+    }
+}
+
+} // namespace
+
+void Hash::hash160Batch(const std::vector<Data>& inputs, std::vector<Data>& outputs) {
+    outputs.resize(inputs.size());
+    std::vector<size_t> compressed;
+    std::vector<size_t> extended;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const auto& input = inputs[i];
+        if (input.size() == 33) {
+            compressed.push_back(i);
+            outputs[i].resize(ripemdSize);
+        } else if (input.size() == 65) {
+            extended.push_back(i);
+            outputs[i].resize(ripemdSize);
+        } else {
+            outputs[i] = sha256ripemd(input.data(), input.size());
+        }
+    }
+    hash160Group(inputs, compressed, 33, outputs);
+    hash160Group(inputs, extended, 65, outputs);
+}
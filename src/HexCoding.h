@@ -70,9 +70,10 @@ inline Data parse_hex(const Iter begin, const Iter end) {
         it += 2;
     }
     try {
-        std::string temp;
-        boost::algorithm::unhex(it, end, std::back_inserter(temp));
-        return Data(temp.begin(), temp.end());
+        Data result;
+        result.reserve((end - it) / 2);
+        boost::algorithm::unhex(it, end, std::back_inserter(result));
+        return result;
     } catch (...) {
         return {};
     }
@@ -0,0 +1,82 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "IncrementalHash.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace TW;
+using namespace TW::Hash;
+
+Sha256::Sha256() {
+    sha256_Init(&ctx);
+}
+
+Sha256& Sha256::update(const byte* data, size_t size) {
+    sha256_Update(&ctx, data, size);
+    return *this;
+}
+
+Sha256::Digest Sha256::final() {
+    Digest digest;
+    sha256_Final(&ctx, digest.data());
+    return digest;
+}
+
+Keccak256& Keccak256::update(const byte* data, size_t size) {
+    while (size > 0) {
+        const size_t count = std::min(size, rate - bufferSize);
+        std::memcpy(buffer + bufferSize, data, count);
+        bufferSize += count;
+        data += count;
+        size -= count;
+        if (bufferSize == rate) {
+            Keccak::absorb(state, buffer, rate);
+            bufferSize = 0;
+        }
+    }
+    return *this;
+}
+
+Keccak256::Digest Keccak256::final() {
+    Digest digest;
+    Keccak::finish(state, buffer, bufferSize, rate, Keccak::padKeccak, digest.data(), digest.size());
+    return digest;
+}
+
+Blake256::Blake256() {
+    blake256_Init(&ctx);
+}
+
+Blake256& Blake256::update(const byte* data, size_t size) {
+    // blake256_Update drops buffered input when called with no data
+    if (size > 0) {
+        blake256_Update(&ctx, data, size);
+    }
+    return *this;
+}
+
+Blake256::Digest Blake256::final() {
+    Digest digest;
+    blake256_Final(&ctx, digest.data());
+    return digest;
+}
+
+Groestl512::Groestl512() {
+    groestl512_Init(&ctx);
+}
+
+Groestl512& Groestl512::update(const byte* data, size_t size) {
+    groestl512_Update(&ctx, data, size);
+    return *this;
+}
+
+Groestl512::Digest Groestl512::final() {
+    Digest digest;
+    groestl512_Final(&ctx, digest.data());
+    return digest;
+}
@@ -0,0 +1,134 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+#include "Hash.h"
+#include "Keccak.h"
+
+#include <TrezorCrypto/blake256.h>
+#include <TrezorCrypto/groestl.h>
+#include <TrezorCrypto/sha2.h>
+
+#include <array>
+#include <cstdint>
+
+// Incremental hashers: each one is ready for input on construction, takes any number
+// of `update` calls, and `final` returns the digest of everything written so far.
+// A hasher must not be updated after `final`.  See also `Hash::Blake2b` in Hash.h.
+
+namespace TW::Hash {
+
+/// Incremental SHA256.
+class Sha256 {
+public:
+    static const size_t size = sha256Size;
+    using Digest = std::array<byte, size>;
+
+    Sha256();
+
+    Sha256& update(const byte* data, size_t size);
+
+    template <typename T>
+    Sha256& update(const T& data) {
+        return update(reinterpret_cast<const byte*>(data.data()), data.size());
+    }
+
+    Digest final();
+
+private:
+    SHA256_CTX ctx;
+};
+
+/// Incremental SHA256 of the SHA256 hash.
+class Sha256d {
+public:
+    static const size_t size = sha256Size;
+    using Digest = std::array<byte, size>;
+
+    Sha256d& update(const byte* data, size_t size) {
+        inner.update(data, size);
+        return *this;
+    }
+
+    template <typename T>
+    Sha256d& update(const T& data) {
+        return update(reinterpret_cast<const byte*>(data.data()), data.size());
+    }
+
+    Digest final() { return Sha256().update(inner.final()).final(); }
+
+private:
+    Sha256 inner;
+};
+
+/// Incremental Keccak SHA256 (Ethereum flavour, original Keccak padding).
+class Keccak256 {
+public:
+    static const size_t size = sha256Size;
+    using Digest = std::array<byte, size>;
+
+    Keccak256& update(const byte* data, size_t size);
+
+    template <typename T>
+    Keccak256& update(const T& data) {
+        return update(reinterpret_cast<const byte*>(data.data()), data.size());
+    }
+
+    Digest final();
+
+private:
+    static const size_t rate = Keccak::rate256;
+
+    uint64_t state[25] = {};
+    byte buffer[rate];
+    size_t bufferSize = 0;
+};
+
+/// Incremental Blake256.
+class Blake256 {
+public:
+    static const size_t size = sha256Size;
+    using Digest = std::array<byte, size>;
+
+    Blake256();
+
+    Blake256& update(const byte* data, size_t size);
+
+    template <typename T>
+    Blake256& update(const T& data) {
+        return update(reinterpret_cast<const byte*>(data.data()), data.size());
+    }
+
+    Digest final();
+
+private:
+    BLAKE256_CTX ctx;
+};
+
+/// Incremental Groestl512.
+class Groestl512 {
+public:
+    static const size_t size = sha512Size;
+    using Digest = std::array<byte, size>;
+
+    Groestl512();
+
+    Groestl512& update(const byte* data, size_t size);
+
+    template <typename T>
+    Groestl512& update(const T& data) {
+        return update(reinterpret_cast<const byte*>(data.data()), data.size());
+    }
+
+    Digest final();
+
+private:
+    GROESTL512_CTX ctx;
+};
+
+} // namespace TW::Hash
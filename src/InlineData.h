@@ -0,0 +1,176 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+namespace TW {
+
+/// Byte buffer with inline storage of a fixed maximum capacity, for small values of
+/// bounded size (keys, signatures).  Mirrors the parts of the Data (std::vector) API used
+/// for such values and converts to Data where one is needed; copies never allocate.
+///
+/// @throws std::invalid_argument when an operation would exceed the capacity.
+template <std::size_t Capacity>
+class InlineData {
+  public:
+    using value_type = byte;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = byte&;
+    using const_reference = const byte&;
+    using pointer = byte*;
+    using const_pointer = const byte*;
+    using iterator = byte*;
+    using const_iterator = const byte*;
+
+    InlineData() = default;
+
+    /// Initializes a buffer of `count` bytes of the given value.
+    explicit InlineData(size_type count, byte value = 0) { assign(count, value); }
+
+    /// Initializes a buffer with a copy of the range.
+    template <typename Iter, typename = std::enable_if_t<!std::is_integral<Iter>::value>>
+    InlineData(Iter first, Iter last) { assign(first, last); }
+
+    /// Initializes a buffer with a copy of the data.
+    explicit InlineData(const Data& data) { assign(data.begin(), data.end()); }
+
+    InlineData& operator=(const Data& data) {
+        assign(data.begin(), data.end());
+        return *this;
+    }
+
+    /// Copy of the contents as Data.
+    operator Data() const { return Data(begin(), end()); }
+
+    static constexpr size_type capacity() { return Capacity; }
+    static constexpr size_type max_size() { return Capacity; }
+    size_type size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    byte* data() { return storage.data(); }
+    const byte* data() const { return storage.data(); }
+
+    iterator begin() { return storage.data(); }
+    iterator end() { return storage.data() + length; }
+    const_iterator begin() const { return storage.data(); }
+    const_iterator end() const { return storage.data() + length; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    byte& operator[](size_type index) { return storage[index]; }
+    const byte& operator[](size_type index) const { return storage[index]; }
+    byte& front() { return storage[0]; }
+    const byte& front() const { return storage[0]; }
+    byte& back() { return storage[length - 1]; }
+    const byte& back() const { return storage[length - 1]; }
+
+    /// No-op beyond checking the capacity, the storage is always reserved.
+    void reserve(size_type size) const { checkCapacity(size); }
+
+    void clear() { length = 0; }
+
+    void resize(size_type size, byte value = 0) {
+        checkCapacity(size);
+        if (size > length) {
+            std::fill(storage.begin() + length, storage.begin() + size, value);
+        }
+        length = size;
+    }
+
+    void push_back(byte value) {
+        checkCapacity(length + 1);
+        storage[length++] = value;
+    }
+
+    void pop_back() { --length; }
+
+    void assign(size_type count, byte value) {
+        checkCapacity(count);
+        std::fill(storage.begin(), storage.begin() + count, value);
+        length = count;
+    }
+
+    template <typename Iter>
+    void assign(Iter first, Iter last) {
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        checkCapacity(count);
+        std::copy(first, last, storage.begin());
+        length = count;
+    }
+
+    /// Inserts a copy of the range before `position`, returns an iterator to the first inserted byte.
+    template <typename Iter>
+    iterator insert(const_iterator position, Iter first, Iter last) {
+        const auto offset = static_cast<size_type>(position - begin());
+        const auto count = static_cast<size_type>(std::distance(first, last));
+        checkCapacity(length + count);
+        std::copy_backward(begin() + offset, end(), end() + count);
+        std::copy(first, last, begin() + offset);
+        length += count;
+        return begin() + offset;
+    }
+
+    iterator insert(const_iterator position, byte value) {
+        return insert(position, &value, &value + 1);
+    }
+
+  private:
+    static void checkCapacity(size_type size) {
+        if (size > Capacity) {
+            throw std::invalid_argument("Data exceeds the buffer capacity");
+        }
+    }
+
+    std::array<byte, Capacity> storage{};
+    size_type length = 0;
+};
+
+template <std::size_t N, std::size_t M>
+inline bool operator==(const InlineData<N>& lhs, const InlineData<M>& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <std::size_t N>
+inline bool operator==(const InlineData<N>& lhs, const Data& rhs) {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <std::size_t N>
+inline bool operator==(const Data& lhs, const InlineData<N>& rhs) {
+    return rhs == lhs;
+}
+
+template <std::size_t N, std::size_t M>
+inline bool operator!=(const InlineData<N>& lhs, const InlineData<M>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <std::size_t N>
+inline bool operator!=(const InlineData<N>& lhs, const Data& rhs) {
+    return !(lhs == rhs);
+}
+
+template <std::size_t N>
+inline bool operator!=(const Data& lhs, const InlineData<N>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <std::size_t N>
+inline void append(Data& data, const InlineData<N>& suffix) {
+    data.insert(data.end(), suffix.begin(), suffix.end());
+}
+
+} // namespace TW
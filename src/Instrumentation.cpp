@@ -0,0 +1,202 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Instrumentation.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+using namespace TW;
+using namespace TW::Instrumentation;
+
+namespace {
+
+// Each thread updates its own stats, without contention; reads and resets merge or clear the stats of all threads.
+// Cells are atomic only so that other threads can read them, and are written by their thread alone.
+
+struct StageCells {
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> totalNanoseconds{0};
+    std::atomic<uint64_t> maxNanoseconds{0};
+};
+
+struct ThreadStats {
+    std::array<StageCells, stageCount> stages;
+    std::array<std::atomic<uint64_t>, counterCount> counters{};
+};
+
+void add(std::atomic<uint64_t>& cell, uint64_t value) {
+    cell.store(cell.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void raise(std::atomic<uint64_t>& cell, uint64_t value) {
+    if (value > cell.load(std::memory_order_relaxed)) {
+        cell.store(value, std::memory_order_relaxed);
+    }
+}
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadStats*> threads;
+    /// Stats of the threads that have exited
+    ThreadStats exited;
+};
+
+Registry& registry() {
+    // never destroyed, as threads may exit after static destruction
+    static auto* instance = new Registry();
+    return *instance;
+}
+
+/// Stats of the current thread, registered for its lifetime.
+class ThreadSlot {
+public:
+    ThreadSlot() {
+        auto& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.threads.push_back(&stats);
+    }
+    ~ThreadSlot() {
+        auto& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (size_t i = 0; i < stageCount; ++i) {
+            add(r.exited.stages[i].calls, stats.stages[i].calls.load());
+            add(r.exited.stages[i].totalNanoseconds, stats.stages[i].totalNanoseconds.load());
+            raise(r.exited.stages[i].maxNanoseconds, stats.stages[i].maxNanoseconds.load());
+        }
+        for (size_t i = 0; i < counterCount; ++i) {
+            add(r.exited.counters[i], stats.counters[i].load());
+        }
+        r.threads.erase(std::find(r.threads.begin(), r.threads.end(), &stats));
+    }
+    ThreadSlot(const ThreadSlot&) = delete;
+    ThreadSlot& operator=(const ThreadSlot&) = delete;
+
+    ThreadStats stats;
+};
+
+ThreadStats& threadStats() {
+    thread_local ThreadSlot slot;
+    return slot.stats;
+}
+
+/// Calls `f` with the stats of the exited threads and of every running thread.
+template <typename F>
+void forAllStats(F f) {
+    auto& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    f(r.exited);
+    for (auto* stats : r.threads) {
+        f(*stats);
+    }
+}
+
+std::atomic<Sink> sink{nullptr};
+std::atomic<void*> sinkContext{nullptr};
+
+} // namespace
+
+const char* Instrumentation::name(Stage stage) {
+    switch (stage) {
+    case Stage::anySign: return "anySign";
+    case Stage::anyPlan: return "anyPlan";
+    case Stage::parse: return "parse";
+    case Stage::serialize: return "serialize";
+    case Stage::bitcoinPlan: return "bitcoinPlan";
+    case Stage::utxoSelection: return "utxoSelection";
+    case Stage::feeEstimation: return "feeEstimation";
+    case Stage::bitcoinSign: return "bitcoinSign";
+    case Stage::sighash: return "sighash";
+    case Stage::ecSign: return "ecSign";
+    case Stage::deriveKey: return "deriveKey";
+    case Stage::decrypt: return "decrypt";
+    }
+    return "";
+}
+
+const char* Instrumentation::name(Counter counter) {
+    switch (counter) {
+    case Counter::allocations: return "allocations";
+    case Counter::allocatedBytes: return "allocatedBytes";
+    case Counter::hashes: return "hashes";
+    case Counter::ecOperations: return "ecOperations";
+    }
+    return "";
+}
+
+void Instrumentation::setSink(Sink newSink, void* context) {
+    sinkContext.store(context);
+    sink.store(newSink);
+}
+
+void Instrumentation::record(Stage stage, uint64_t nanoseconds) {
+    auto& stats = threadStats().stages[static_cast<size_t>(stage)];
+    add(stats.calls, 1);
+    add(stats.totalNanoseconds, nanoseconds);
+    raise(stats.maxNanoseconds, nanoseconds);
+
+    if (const auto callback = sink.load()) {
+        callback(sinkContext.load(), name(stage), nanoseconds);
+    }
+}
+
+void Instrumentation::count(Counter counter, uint64_t value) {
+    add(threadStats().counters[static_cast<size_t>(counter)], value);
+}
+
+StageStats Instrumentation::stats(Stage stage) {
+    StageStats result;
+    forAllStats([&](const ThreadStats& stats) {
+        const auto& cells = stats.stages[static_cast<size_t>(stage)];
+        result.calls += cells.calls.load();
+        result.totalNanoseconds += cells.totalNanoseconds.load();
+        result.maxNanoseconds = std::max(result.maxNanoseconds, cells.maxNanoseconds.load());
+    });
+    return result;
+}
+
+uint64_t Instrumentation::value(Counter counter) {
+    uint64_t result = 0;
+    forAllStats([&](const ThreadStats& stats) { result += stats.counters[static_cast<size_t>(counter)].load(); });
+    return result;
+}
+
+void Instrumentation::reset() {
+    forAllStats([](ThreadStats& stats) {
+        for (auto& cells : stats.stages) {
+            cells.calls.store(0);
+            cells.totalNanoseconds.store(0);
+            cells.maxNanoseconds.store(0);
+        }
+        for (auto& counter : stats.counters) {
+            counter.store(0);
+        }
+    });
+}
+
+std::string Instrumentation::statsJSON() {
+    auto stages = nlohmann::json::object();
+    for (size_t i = 0; i < stageCount; ++i) {
+        const auto stage = static_cast<Stage>(i);
+        const auto current = stats(stage);
+        stages[name(stage)] = {
+            {"calls", current.calls},
+            {"totalNanoseconds", current.totalNanoseconds},
+            {"maxNanoseconds", current.maxNanoseconds},
+        };
+    }
+    auto counterValues = nlohmann::json::object();
+    for (size_t i = 0; i < counterCount; ++i) {
+        const auto counter = static_cast<Counter>(i);
+        counterValues[name(counter)] = value(counter);
+    }
+    return nlohmann::json{{"enabled", enabled()}, {"stages", stages}, {"counters", counterValues}}.dump();
+}
@@ -0,0 +1,111 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// Optional timing and counting of the signing pipeline stages.
+///
+/// Hooks are placed with the TW_INSTRUMENT_* macros, which compile to nothing unless
+/// the library is built with TW_INSTRUMENTATION (cmake -DTW_INSTRUMENTATION=ON).
+/// Stages nest (e.g. ecSign runs inside bitcoinSign, which runs inside anySign), so their totals overlap.
+namespace TW::Instrumentation {
+
+enum class Stage {
+    anySign,
+    anyPlan,
+    parse,
+    serialize,
+    bitcoinPlan,
+    utxoSelection,
+    feeEstimation,
+    bitcoinSign,
+    sighash,
+    ecSign,
+    deriveKey,
+    decrypt,
+};
+constexpr size_t stageCount = static_cast<size_t>(Stage::decrypt) + 1;
+
+enum class Counter {
+    /// Heap blocks taken by the signing arena
+    allocations,
+    /// Bytes of the heap blocks taken by the signing arena
+    allocatedBytes,
+    hashes,
+    ecOperations,
+};
+constexpr size_t counterCount = static_cast<size_t>(Counter::ecOperations) + 1;
+
+struct StageStats {
+    uint64_t calls = 0;
+    uint64_t totalNanoseconds = 0;
+    uint64_t maxNanoseconds = 0;
+};
+
+/// Receives the duration of every timed stage, on the thread that ran it.
+using Sink = void (*)(void* context, const char* stage, uint64_t nanoseconds);
+
+/// Whether the library was built with the instrumentation hooks.
+constexpr bool enabled() {
+#ifdef TW_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char* name(Stage stage);
+const char* name(Counter counter);
+
+/// Sets the sink, or removes it when null.
+/// Not synchronized with running operations: set it before signing starts.
+void setSink(Sink sink, void* context);
+
+void record(Stage stage, uint64_t nanoseconds);
+void count(Counter counter, uint64_t value);
+
+/// Stats are kept per thread; these merge the stats of all threads, including exited ones.
+StageStats stats(Stage stage);
+uint64_t value(Counter counter);
+/// Clears the stats of all threads.  Updates made concurrently by running operations may be lost.
+void reset();
+
+/// Aggregated stats as a JSON object with "stages" and "counters".
+std::string statsJSON();
+
+/// Records the time from its construction to its destruction.
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Stage stage) : stage(stage), start(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        record(stage, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Stage stage;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace TW::Instrumentation
+
+#ifdef TW_INSTRUMENTATION
+#define TW_INSTRUMENT_CONCAT_(a, b) a##b
+#define TW_INSTRUMENT_CONCAT(a, b) TW_INSTRUMENT_CONCAT_(a, b)
+#define TW_INSTRUMENT_STAGE(stage) \
+    ::TW::Instrumentation::ScopedTimer TW_INSTRUMENT_CONCAT(instrumentationTimer, __LINE__)(::TW::Instrumentation::Stage::stage)
+#define TW_INSTRUMENT_COUNT(counter, value) ::TW::Instrumentation::count(::TW::Instrumentation::Counter::counter, value)
+#else
+#define TW_INSTRUMENT_STAGE(stage) ((void)0)
+#define TW_INSTRUMENT_COUNT(counter, value) ((void)0)
+#endif
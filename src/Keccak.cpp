@@ -0,0 +1,246 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Keccak.h"
+#include "SIMD.h"
+
+#include <cstring>
+#include <map>
+#include <stdexcept>
+
+using namespace TW;
+using namespace TW::SIMD;
+
+namespace {
+
+constexpr uint64_t roundConstants[24] = {
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+    0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+    0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+    0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+    0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+};
+
+template <typename V>
+TW_SIMD_INLINE V rotl64(V x, int n) {
+    return (x << n) | (x >> (64 - n));
+}
+
+/// Keccak-f[1600] over a lane type: uint64_t for a single state, or a vector of 64-bit
+/// lanes holding that many independent states.  Each round is written out in full,
+/// with rho and pi merged into a single pass.
+template <typename V>
+TW_SIMD_INLINE void keccakF1600(V a[25]) {
+    for (int round = 0; round < 24; ++round) {
+        // theta
+        const V c0 = a[0] ^ a[5] ^ a[10] ^ a[15] ^ a[20];
+        const V c1 = a[1] ^ a[6] ^ a[11] ^ a[16] ^ a[21];
+        const V c2 = a[2] ^ a[7] ^ a[12] ^ a[17] ^ a[22];
+        const V c3 = a[3] ^ a[8] ^ a[13] ^ a[18] ^ a[23];
+        const V c4 = a[4] ^ a[9] ^ a[14] ^ a[19] ^ a[24];
+        const V d0 = c4 ^ rotl64(c1, 1);
+        const V d1 = c0 ^ rotl64(c2, 1);
+        const V d2 = c1 ^ rotl64(c3, 1);
+        const V d3 = c2 ^ rotl64(c4, 1);
+        const V d4 = c3 ^ rotl64(c0, 1);
+        for (int y = 0; y < 25; y += 5) {
+            a[y + 0] ^= d0;
+            a[y + 1] ^= d1;
+            a[y + 2] ^= d2;
+            a[y + 3] ^= d3;
+            a[y + 4] ^= d4;
+        }
+
+        // rho and pi
+        V b[25];
+        b[0] = a[0];
+        b[1] = rotl64(a[6], 44);
+        b[2] = rotl64(a[12], 43);
+        b[3] = rotl64(a[18], 21);
+        b[4] = rotl64(a[24], 14);
+        b[5] = rotl64(a[3], 28);
+        b[6] = rotl64(a[9], 20);
+        b[7] = rotl64(a[10], 3);
+        b[8] = rotl64(a[16], 45);
+        b[9] = rotl64(a[22], 61);
+        b[10] = rotl64(a[1], 1);
+        b[11] = rotl64(a[7], 6);
+        b[12] = rotl64(a[13], 25);
+        b[13] = rotl64(a[19], 8);
+        b[14] = rotl64(a[20], 18);
+        b[15] = rotl64(a[4], 27);
+        b[16] = rotl64(a[5], 36);
+        b[17] = rotl64(a[11], 10);
+        b[18] = rotl64(a[17], 15);
+        b[19] = rotl64(a[23], 56);
+        b[20] = rotl64(a[2], 62);
+        b[21] = rotl64(a[8], 55);
+        b[22] = rotl64(a[14], 39);
+        b[23] = rotl64(a[15], 41);
+        b[24] = rotl64(a[21], 2);
+
+        // chi
+        for (int y = 0; y < 25; y += 5) {
+            a[y + 0] = b[y + 0] ^ (~b[y + 1] & b[y + 2]);
+            a[y + 1] = b[y + 1] ^ (~b[y + 2] & b[y + 3]);
+            a[y + 2] = b[y + 2] ^ (~b[y + 3] & b[y + 4]);
+            a[y + 3] = b[y + 3] ^ (~b[y + 4] & b[y + 0]);
+            a[y + 4] = b[y + 4] ^ (~b[y + 0] & b[y + 1]);
+        }
+
+        // iota
+        a[0] ^= roundConstants[round];
+    }
+}
+
+inline uint64_t load64LE(const byte* p) {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; --i) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+/// Builds the final, padded block of a message: the bytes after the last full block,
+/// the domain byte, and the closing 0x80 bit.
+inline void padLastBlock(const byte* data, size_t size, size_t rate, byte pad, byte* block) {
+    std::memset(block, 0, rate);
+    const size_t full = size - size % rate;
+    if (size > full) {
+        std::memcpy(block, data + full, size - full);
+    }
+    block[size - full] ^= pad;
+    block[rate - 1] ^= 0x80;
+}
+
+/// Sponge over as many messages as the lane type has lanes; all messages span `blocks` blocks
+/// (including the padded last one).
+template <typename V>
+TW_SIMD_INLINE void spongeLanes(const byte* const* in, const size_t* sizes, size_t blocks, size_t rate, byte pad, byte* const* out, size_t outSize) {
+    constexpr auto L = lanes<V>();
+    const size_t words = rate / 8;
+
+    byte last[L][200];
+    for (size_t lane = 0; lane < L; ++lane) {
+        padLastBlock(in[lane], sizes[lane], rate, pad, last[lane]);
+    }
+
+    V state[25] = {};
+    for (size_t b = 0; b < blocks; ++b) {
+        for (size_t i = 0; i < words; ++i) {
+            V w;
+            for (size_t lane = 0; lane < L; ++lane) {
+                const byte* block = (b + 1 < blocks) ? in[lane] + b * rate : last[lane];
+                w[lane] = load64LE(block + 8 * i);
+            }
+            state[i] ^= w;
+        }
+        keccakF1600(state);
+    }
+
+    for (size_t lane = 0; lane < L; ++lane) {
+        for (size_t i = 0; i < outSize; ++i) {
+            out[lane][i] = static_cast<byte>(state[i / 8][lane] >> (8 * (i % 8)));
+        }
+    }
+}
+
+void spongeX2(const byte* const* in, const size_t* sizes, size_t blocks, size_t rate, byte pad, byte* const* out, size_t outSize) {
+    spongeLanes<u64x2>(in, sizes, blocks, rate, pad, out, outSize);
+}
+
+#if defined(TW_SIMD_X86)
+TW_SIMD_TARGET_AVX2 void spongeX4(const byte* const* in, const size_t* sizes, size_t blocks, size_t rate, byte pad, byte* const* out, size_t outSize) {
+    spongeLanes<u64x4>(in, sizes, blocks, rate, pad, out, outSize);
+}
+#endif
+
+} // namespace
+
+void Keccak::permute(uint64_t state[25]) {
+    keccakF1600(state);
+}
+
+void Keccak::absorb(uint64_t state[25], const byte* block, size_t rate) {
+    for (size_t i = 0; i < rate / 8; ++i) {
+        state[i] ^= load64LE(block + 8 * i);
+    }
+    keccakF1600(state);
+}
+
+void Keccak::finish(uint64_t state[25], const byte* data, size_t size, size_t rate, byte pad, byte* out, size_t outSize) {
+    byte last[200];
+    padLastBlock(data, size, rate, pad, last);
+    absorb(state, last, rate);
+
+    for (size_t i = 0; i < outSize; ++i) {
+        out[i] = static_cast<byte>(state[i / 8] >> (8 * (i % 8)));
+    }
+}
+
+void Keccak::sponge(const byte* data, size_t size, size_t rate, byte pad, byte* out, size_t outSize) {
+    uint64_t state[25] = {};
+    const size_t full = size - size % rate;
+    for (size_t offset = 0; offset < full; offset += rate) {
+        absorb(state, data + offset, rate);
+    }
+    finish(state, data + full, size - full, rate, pad, out, outSize);
+}
+
+void Keccak::spongeBatch(const std::vector<Data>& inputs, size_t rate, byte pad, size_t outSize, std::vector<Data>& outputs) {
+    if (outSize > rate) {
+        throw std::invalid_argument("Keccak output larger than rate");
+    }
+    outputs.resize(inputs.size());
+
+    // messages with the same number of blocks share a run of the multi-lane kernel
+    std::map<size_t, std::vector<size_t>> groups;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        outputs[i].resize(outSize);
+        groups[inputs[i].size() / rate + 1].push_back(i);
+    }
+
+    size_t width = 2;
+    auto kernel = spongeX2;
+#if defined(TW_SIMD_X86)
+    if (hasAVX2()) {
+        width = 4;
+        kernel = spongeX4;
+    }
+#endif
+
+    const byte* in[4];
+    size_t sizes[4];
+    byte* out[4];
+    // outputs of unused lanes
+    Data scratch[4];
+    for (const auto& group : groups) {
+        const auto& indices = group.second;
+        for (size_t start = 0; start < indices.size(); start += width) {
+            if (indices.size() - start == 1) {
+                // single message left, no need for the multi-lane kernel
+                const auto& input = inputs[indices[start]];
+                sponge(input.data(), input.size(), rate, pad, outputs[indices[start]].data(), outSize);
+                continue;
+            }
+            for (size_t lane = 0; lane < width; ++lane) {
+                if (start + lane < indices.size()) {
+                    const auto index = indices[start + lane];
+                    in[lane] = inputs[index].data();
+                    sizes[lane] = inputs[index].size();
+                    out[lane] = outputs[index].data();
+                } else {
+                    in[lane] = in[0];
+                    sizes[lane] = sizes[0];
+                    scratch[lane].resize(outSize);
+                    out[lane] = scratch[lane].data();
+                }
+            }
+            kernel(in, sizes, group.first, rate, pad, out, outSize);
+        }
+    }
+}
@@ -0,0 +1,46 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+
+#include <cstdint>
+#include <vector>
+
+/// Keccak-f[1600] permutation and sponge, used for the Keccak and SHA-3 hash functions.
+namespace TW::Keccak {
+
+/// Sponge rate in bytes for 256-bit output (Keccak256, SHA3-256).
+static const size_t rate256 = 136;
+
+/// Sponge rate in bytes for 512-bit output (Keccak512, SHA3-512).
+static const size_t rate512 = 72;
+
+/// Padding (domain separation) byte of the original Keccak submission, as used by Ethereum.
+static const byte padKeccak = 0x01;
+
+/// Padding (domain separation) byte of FIPS 202 SHA-3.
+static const byte padSHA3 = 0x06;
+
+/// Applies the 24-round Keccak-f[1600] permutation to a state of 25 64-bit lanes.
+void permute(uint64_t state[25]);
+
+/// Absorbs one full block of `rate` bytes into the state.
+void absorb(uint64_t state[25], const byte* block, size_t rate);
+
+/// Absorbs the final, partial block (`size` is less than `rate`) with padding, and squeezes
+/// `outSize` (at most `rate`) bytes of output.
+void finish(uint64_t state[25], const byte* data, size_t size, size_t rate, byte pad, byte* out, size_t outSize);
+
+/// Absorbs a message and squeezes `outSize` (at most `rate`) bytes of output.
+void sponge(const byte* data, size_t size, size_t rate, byte pad, byte* out, size_t outSize);
+
+/// Runs the sponge over each input, several messages in parallel: 4 lanes with AVX2, 2 lanes otherwise.
+/// Outputs are resized to match the inputs.  Throws if `outSize` is more than `rate`.
+void spongeBatch(const std::vector<Data>& inputs, size_t rate, byte pad, size_t outSize, std::vector<Data>& outputs);
+
+} // namespace TW::Keccak
@@ -8,6 +8,7 @@
 
 #include "../Hash.h"
 #include "../HexCoding.h"
+#include "../Instrumentation.h"
 
 #include <TrezorCrypto/aes.h>
 #include <TrezorCrypto/pbkdf2.h>
@@ -52,6 +53,7 @@ EncryptionParameters::~EncryptionParameters() {
 }
 
 Data EncryptionParameters::decrypt(const Data& password) const {
+    TW_INSTRUMENT_STAGE(decrypt);
     auto derivedKey = Data();
     auto mac = Data();
 
@@ -206,7 +206,7 @@ Transaction Signer::prepareUnsignedTransaction(const Proto::SigningInput& input,
 Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
     auto output = Proto::SigningOutput();
     try {
-        auto signer = Signer(PrivateKey(Data(input.private_key().begin(), input.private_key().end())));
+        auto signer = Signer(PrivateKey(input.private_key()));
         Proto::TransactionPlan plan;
         if (input.has_plan()) {
             plan = input.plan();
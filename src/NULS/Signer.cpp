@@ -106,8 +106,7 @@ Data Signer::sign() const {
     // Calc transaction hash
     Data txHash = calcTransactionDigest(dataRet);
    
-    Data privKey = data(input.private_key());
-    auto priv = PrivateKey(privKey);
+    auto priv = PrivateKey(input.private_key());
     auto transactionSignature = makeTransactionSignature(priv, txHash);
     encodeVarInt(transactionSignature.size(), dataRet);
     std::copy(transactionSignature.begin(), transactionSignature.end(), std::back_inserter(dataRet));
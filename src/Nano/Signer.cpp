@@ -6,6 +6,7 @@
 // file LICENSE at the root of the source code distribution tree.
 
 #include "Signer.h"
+#include "Work.h"
 #include "../BinaryCoding.h"
 #include "../Hash.h"
 #include "../HexCoding.h"
@@ -14,6 +15,8 @@
 #include <boost/multiprecision/cpp_int.hpp>
 #include <google/protobuf/util/json_util.h>
 
+#include <thread>
+
 using namespace TW;
 
 using uint128_t = boost::multiprecision::uint128_t;
@@ -104,23 +107,36 @@ std::array<byte, 32> hashBlockData(const PublicKey& publicKey, const Proto::Sign
         throw std::invalid_argument("Missing link block hash");
     }
 
-    auto msg = Data();
-    msg.insert(msg.end(), kBlockHashPreamble.begin(), kBlockHashPreamble.end());
-    msg.insert(msg.end(), publicKey.bytes.begin(), publicKey.bytes.end());
-    msg.insert(msg.end(), parentHash.begin(), parentHash.end());
-    msg.insert(msg.end(), repPublicKey.begin(), repPublicKey.end());
-    msg.insert(msg.end(), balance.begin(), balance.end());
-    msg.insert(msg.end(), link.begin(), link.end());
-
     std::array<byte, 32> blockHash = {0};
-    auto digest = Hash::blake2b(msg, blockHash.size());
+    auto digest = Hash::Blake2b(blockHash.size())
+                      .update(kBlockHashPreamble)
+                      .update(publicKey.bytes)
+                      .update(parentHash)
+                      .update(repPublicKey)
+                      .update(balance)
+                      .update(link)
+                      .final();
     std::copy_n(digest.begin(), blockHash.size(), blockHash.begin());
 
     return blockHash;
 }
 
+/// Generates the work of the block: its root is the previous block hash, or the account public key for the first block.
+std::string generateBlockWork(const Proto::SigningInput& input, const PublicKey& publicKey, const std::array<byte, 32>& previous) {
+    WorkRoot root = previous;
+    if (std::all_of(previous.begin(), previous.end(), [](auto b) { return b == 0; })) {
+        std::copy_n(publicKey.bytes.begin(), root.size(), root.begin());
+    }
+    auto threshold = input.work_difficulty();
+    if (threshold == 0) {
+        threshold = input.link_oneof_case() == Proto::SigningInput::kLinkBlock ? workThresholdReceive : workThresholdSend;
+    }
+    const auto work = generateWork(root, threshold, std::thread::hardware_concurrency());
+    return workString(*work);
+}
+
 Signer::Signer(const Proto::SigningInput& input)
-  : privateKey(Data(input.private_key().begin(), input.private_key().end())),
+  : privateKey(input.private_key()),
     publicKey(privateKey.getPublicKey(TWPublicKeyTypeED25519Blake2b)),
     input(input),
     previous{previousFromInput(input)},
@@ -169,12 +185,14 @@ Proto::SigningOutput Signer::build() const {
         {"representative", Address(input.representative()).string()},
         {"balance", input.balance()},
         {"link", hex(link)},
-        {"link_as_account", Address(PublicKey(Data(link.begin(), link.end()), TWPublicKeyTypeED25519Blake2b)).string()},
+        {"link_as_account", Address(PublicKey(link.data(), link.size(), TWPublicKeyTypeED25519Blake2b)).string()},
         {"signature", hex(signature)},
     };
 
     if (input.work().size() > 0) {
         json["work"] = input.work();
+    } else if (input.generate_work()) {
+        json["work"] = generateBlockWork(input, publicKey, previous);
     }
 
     output.set_json(json.dump());
@@ -0,0 +1,162 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Work.h"
+
+#include "../BinaryCoding.h"
+#include "../Blake2b.h"
+#include "../HexCoding.h"
+#include "../Parallel.h"
+
+#include <limits>
+
+using namespace TW;
+using namespace TW::SIMD;
+
+namespace {
+
+/// Number of nonces a search thread hashes between two checks of the stop flags.
+constexpr uint64_t checkInterval = 1024;
+
+void loadRoot(const Nano::WorkRoot& root, uint64_t words[4]) {
+    for (int i = 0; i < 4; ++i) {
+        words[i] = decode64LE(root.data() + 8 * i);
+    }
+}
+
+/// Computes the 8-byte Blake2b digest of `nonce || root` as a little-endian word, for one nonce per lane.
+/// The 40-byte message fits a single block, so this is one compression of a mostly constant
+/// message, and only the first state word is needed for the digest.
+template <typename V>
+TW_SIMD_INLINE V workValues(V nonce, const uint64_t root[4]) {
+    const V zero{};
+    V m[16];
+    m[0] = nonce;
+    for (int i = 1; i < 16; ++i) {
+        m[i] = zero;
+    }
+    for (int i = 0; i < 4; ++i) {
+        m[i + 1] = zero + root[i];
+    }
+
+    // parameter block: 8-byte digest, no key, fanout 1, depth 1
+    const uint64_t h0 = Blake2b::iv[0] ^ 0x01010008;
+    V v[16];
+    v[0] = zero + h0;
+    for (int i = 1; i < 8; ++i) {
+        v[i] = zero + Blake2b::iv[i];
+    }
+    for (int i = 0; i < 8; ++i) {
+        v[i + 8] = zero + Blake2b::iv[i];
+    }
+    // message length, final block
+    v[12] ^= 40;
+    v[14] = ~v[14];
+
+    for (const auto& s : Blake2b::sigma) {
+        Blake2b::mix(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+        Blake2b::mix(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+        Blake2b::mix(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+        Blake2b::mix(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+        Blake2b::mix(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+        Blake2b::mix(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+        Blake2b::mix(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+        Blake2b::mix(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+    }
+    return (zero + h0) ^ v[0] ^ v[8];
+}
+
+/// Tries consecutive nonces from `first`, `lanes<V>()` at a time, until one reaches the threshold
+/// (stored in `work`) or one of the stop flags is set.
+template <typename V>
+TW_SIMD_INLINE bool searchLanes(const uint64_t root[4], uint64_t first, uint64_t threshold,
+                                const std::atomic<bool>& found, const std::atomic<bool>* cancel, uint64_t& work) {
+    constexpr auto count = lanes<V>();
+    V offsets;
+    for (size_t i = 0; i < count; ++i) {
+        offsets[i] = i;
+    }
+    for (uint64_t start = first;; start += checkInterval) {
+        if (found.load(std::memory_order_relaxed) || (cancel != nullptr && cancel->load(std::memory_order_relaxed))) {
+            return false;
+        }
+        for (uint64_t offset = 0; offset < checkInterval; offset += count) {
+            const V nonces = offsets + (start + offset);
+            const V values = workValues(nonces, root);
+            for (size_t i = 0; i < count; ++i) {
+                if (values[i] >= threshold) {
+                    work = nonces[i];
+                    return true;
+                }
+            }
+        }
+    }
+}
+
+using SearchFunction = bool (*)(const uint64_t root[4], uint64_t first, uint64_t threshold,
+                                const std::atomic<bool>& found, const std::atomic<bool>* cancel, uint64_t& work);
+
+bool searchPortable(const uint64_t root[4], uint64_t first, uint64_t threshold,
+                    const std::atomic<bool>& found, const std::atomic<bool>* cancel, uint64_t& work) {
+    return searchLanes<u64x2>(root, first, threshold, found, cancel, work);
+}
+
+#if defined(TW_SIMD_X86)
+TW_SIMD_TARGET_AVX2 bool searchAVX2(const uint64_t root[4], uint64_t first, uint64_t threshold,
+                                    const std::atomic<bool>& found, const std::atomic<bool>* cancel, uint64_t& work) {
+    return searchLanes<u64x4>(root, first, threshold, found, cancel, work);
+}
+#endif
+
+SearchFunction selectSearch() {
+#if defined(TW_SIMD_X86)
+    if (hasAVX2()) {
+        return searchAVX2;
+    }
+#endif
+    return searchPortable;
+}
+
+// selected on first use, so that work generation during static initialization of other units is safe
+SearchFunction searchFunction() {
+    static const SearchFunction selected = selectSearch();
+    return selected;
+}
+
+} // namespace
+
+uint64_t Nano::workValue(const WorkRoot& root, uint64_t work) {
+    uint64_t words[4];
+    loadRoot(root, words);
+    return workValues<uint64_t>(work, words);
+}
+
+std::optional<uint64_t> Nano::generateWork(const WorkRoot& root, uint64_t threshold, size_t threads,
+                                           const std::atomic<bool>* cancel) {
+    uint64_t words[4];
+    loadRoot(root, words);
+
+    // each thread starts at its own share of the nonce space
+    threads = std::max<size_t>(threads, 1);
+    const uint64_t share = std::numeric_limits<uint64_t>::max() / threads;
+
+    const auto search = searchFunction();
+    std::atomic<bool> found{false};
+    std::optional<uint64_t> result;
+    parallelFor(threads, threads, [&](size_t t) {
+        uint64_t work = 0;
+        if (search(words, t * share, threshold, found, cancel, work) && !found.exchange(true)) {
+            result = work;
+        }
+    });
+    return result;
+}
+
+std::string Nano::workString(uint64_t work) {
+    Data data;
+    encode64BE(work, data);
+    return hex(data);
+}
@@ -0,0 +1,47 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "../Data.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+/// Nano proof of work: a nonce whose 8-byte Blake2b hash, together with the block root
+/// (previous block hash, or account public key for the first block), reaches a difficulty threshold.
+namespace TW::Nano {
+
+using WorkRoot = std::array<byte, 32>;
+
+/// Difficulty threshold of send and change blocks.
+static const uint64_t workThresholdSend = 0xfffffff800000000;
+
+/// Difficulty threshold of receive and open blocks.
+static const uint64_t workThresholdReceive = 0xfffffe0000000000;
+
+/// Computes the difficulty reached by a work nonce for a block root.
+uint64_t workValue(const WorkRoot& root, uint64_t work);
+
+/// Checks a work nonce against a difficulty threshold, with a single hash.
+inline bool validateWork(const WorkRoot& root, uint64_t work, uint64_t threshold) {
+    return workValue(root, work) >= threshold;
+}
+
+/// Searches for a work nonce reaching the threshold.  Nonces are hashed several at a time
+/// (4 lanes with AVX2, 2 lanes otherwise) and the search space is split over `threads` threads,
+/// which all stop as soon as one finds a nonce; 0 or 1 runs on the calling thread.
+/// Returns nothing if `cancel` gets set before a nonce is found.
+std::optional<uint64_t> generateWork(const WorkRoot& root, uint64_t threshold, size_t threads,
+                                     const std::atomic<bool>* cancel = nullptr);
+
+/// Formats a work nonce as in block JSON: 16 hex digits, most significant first.
+std::string workString(uint64_t work);
+
+} // namespace TW::Nano
@@ -24,7 +24,7 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
         input.payload()
     );
     
-    auto privateKey = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto privateKey = PrivateKey(input.private_key());
     signer.sign(privateKey, tx);
 
     auto output = Proto::SigningOutput();
@@ -10,8 +10,6 @@
 #include "../Hash.h"
 #include "../HexCoding.h"
 
-#include <TrezorCrypto/blake2b.h>
-
 #include <algorithm>
 #include <cassert>
 #include <cmath>
@@ -93,8 +91,7 @@ Address::Address(const std::vector<uint8_t>& data) {
 }
 
 Address::Address(const PublicKey& publicKey) {
-    auto hash = std::array<uint8_t, 32>();
-    blake2b(publicKey.bytes.data(), 32, hash.data(), hash.size());
+    const auto hash = Hash::blake2b(publicKey.bytes.data(), 32, 32);
     std::copy(hash.begin(), hash.begin() + Address::size, bytes.begin());
 }
 
@@ -0,0 +1,74 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace TW {
+
+/// Largest useful number of threads: the hardware concurrency, or 1 if it is not known.
+inline size_t maxThreads() {
+    static const size_t max = std::max(std::thread::hardware_concurrency(), 1u);
+    return max;
+}
+
+/// Calls `body(i)` for every `i` in `[0, count)`, split in contiguous chunks over up to `threads` threads,
+/// at most `maxThreads()`.
+/// The calling thread takes the first chunk; with `threads` 0 or 1 everything runs on the calling thread.
+/// If `body` throws, the first exception is rethrown once all threads are done.
+template <typename F>
+void parallelFor(size_t count, size_t threads, F body) {
+    threads = std::min({threads, count, maxThreads()});
+    if (threads <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            body(i);
+        }
+        return;
+    }
+
+    const size_t chunk = (count + threads - 1) / threads;
+    std::vector<std::exception_ptr> errors(threads);
+    const auto runChunk = [&](size_t t) {
+        try {
+            const auto end = std::min(count, (t + 1) * chunk);
+            for (size_t i = t * chunk; i < end; ++i) {
+                body(i);
+            }
+        } catch (...) {
+            errors[t] = std::current_exception();
+        }
+    };
+
+    {
+        std::vector<std::thread> workers;
+        // joins the started workers on exit, also if starting another one throws
+        struct JoinAll {
+            std::vector<std::thread>& workers;
+            ~JoinAll() {
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+        } joinAll{workers};
+        workers.reserve(threads - 1);
+        for (size_t t = 1; t < threads; ++t) {
+            workers.emplace_back(runChunk, t);
+        }
+        runChunk(0);
+    }
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+} // namespace TW
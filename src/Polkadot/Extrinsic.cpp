@@ -7,6 +7,7 @@
 #include "Extrinsic.h"
 #include <TrustWalletCore/TWSS58AddressType.h>
 #include <map>
+#include <stdexcept>
 
 using namespace TW;
 using namespace TW::Polkadot;
@@ -18,7 +19,7 @@ static constexpr uint32_t multiAddrSpecVersion = 28;
 static constexpr uint32_t multiAddrSpecVersionKsm = 2028;
 
 static const std::string balanceTransfer = "Balances.transfer";
-static const std::string utilityBatch = "Utility.batch";
+static const std::string utilityBatchAll = "Utility.batch_all";
 static const std::string stakingBond = "Staking.bond";
 static const std::string stakingBondExtra = "Staking.bond_extra";
 static const std::string stakingUnbond = "Staking.unbond";
@@ -27,7 +28,7 @@ static const std::string stakingNominate = "Staking.nominate";
 static const std::string stakingChill = "Staking.chill";
 
 // Readable decoded call index can be found from https://polkascan.io
-static std::map<const std::string, Data> polkadotCallIndices = {
+static const std::map<const std::string, Data> polkadotCallIndices = {
     {balanceTransfer,       Data{0x05, 0x00}},
     {stakingBond,           Data{0x07, 0x00}},
     {stakingBondExtra,      Data{0x07, 0x01}},
@@ -35,10 +36,10 @@ static std::map<const std::string, Data> polkadotCallIndices = {
     {stakingWithdrawUnbond, Data{0x07, 0x03}},
     {stakingNominate,       Data{0x07, 0x05}},
     {stakingChill,          Data{0x07, 0x06}},
-    {utilityBatch,          Data{0x1a, 0x02}},
+    {utilityBatchAll,       Data{0x1a, 0x02}},
 };
 
-static std::map<const std::string, Data> kusamaCallIndices = {
+static const std::map<const std::string, Data> kusamaCallIndices = {
     {balanceTransfer,       Data{0x04, 0x00}},
     {stakingBond,           Data{0x06, 0x00}},
     {stakingBondExtra,      Data{0x06, 0x01}},
@@ -46,15 +47,15 @@ static std::map<const std::string, Data> kusamaCallIndices = {
     {stakingWithdrawUnbond, Data{0x06, 0x03}},
     {stakingNominate,       Data{0x06, 0x05}},
     {stakingChill,          Data{0x06, 0x06}},
-    {utilityBatch,          Data{0x18, 0x02}},
+    {utilityBatchAll,       Data{0x18, 0x02}},
 };
 
 static Data getCallIndex(TWSS58AddressType network, const std::string& key) {
     switch (network) {
     case TWSS58AddressTypePolkadot:
-        return polkadotCallIndices[key];
+        return polkadotCallIndices.at(key);
     case TWSS58AddressTypeKusama:
-        return kusamaCallIndices[key];
+        return kusamaCallIndices.at(key);
     }
 }
 
@@ -66,15 +67,33 @@ bool Extrinsic::encodeRawAccount(TWSS58AddressType network, uint32_t specVersion
     return true;
 }
 
+/// Appends the compact encoding of a big-endian big integer value; native integers skip the big integer conversion.
+static void encodeValue(const std::string& value, Data& data) {
+    const auto begin = std::find_if(value.begin(), value.end(), [](char c) { return c != 0; });
+    if (value.end() - begin > 8) {
+        encodeCompact(CompactInteger(load(value)), data);
+        return;
+    }
+    uint64_t v = 0;
+    for (auto it = begin; it != value.end(); ++it) {
+        v = (v << 8) | static_cast<uint8_t>(*it);
+    }
+    encodeCompact(v, data);
+}
+
 Data Extrinsic::encodeEraNonceTip() const {
     Data data;
+    encodeEraNonceTip(data);
+    return data;
+}
+
+void Extrinsic::encodeEraNonceTip(Data& data) const {
     // era
     append(data, era);
     // nonce
-    append(data, encodeCompact(nonce));
+    encodeCompact(nonce, data);
     // tip
-    append(data, encodeCompact(tip));
-    return data;
+    encodeCompact(tip, data);
 }
 
 Data Extrinsic::encodeCall(const Proto::SigningInput& input) {
@@ -91,21 +110,94 @@ Data Extrinsic::encodeCall(const Proto::SigningInput& input) {
 
 Data Extrinsic::encodeBalanceCall(const Proto::Balance& balance, TWSS58AddressType network, uint32_t specVersion) {
     Data data;
-    auto transfer = balance.transfer();
+    if (balance.has_batch_transfer()) {
+        // all the transfers in one call, regardless of the limits
+        const auto& transfers = balance.batch_transfer().transfers();
+        append(data, getCallIndex(network, utilityBatchAll));
+        encodeCompact(uint64_t(transfers.size()), data);
+        for (const auto& transfer : transfers) {
+            encodeTransferCall(transfer, network, specVersion, data);
+        }
+        return data;
+    }
+    encodeTransferCall(balance.transfer(), network, specVersion, data);
+    return data;
+}
+
+void Extrinsic::encodeTransferCall(const Proto::Balance::Transfer& transfer, TWSS58AddressType network, uint32_t specVersion, Data& data) {
     auto address = SS58Address(transfer.to_address(), network);
-    auto value = load(transfer.value());
     // call index
     append(data, getCallIndex(network, balanceTransfer));
     // destination
-    append(data, encodeAccountId(address.keyBytes(), encodeRawAccount(network, specVersion)));
+    encodeAccountId(address.keyBytes(), encodeRawAccount(network, specVersion), data);
     // value
-    append(data, encodeCompact(value));
-    return data;
+    encodeValue(transfer.value(), data);
+}
+
+std::vector<Extrinsic> Extrinsic::batchTransfers(const Proto::SigningInput& input) {
+    const auto& batch = input.balance_call().batch_transfer();
+    const auto network = TWSS58AddressType(input.network());
+    const auto specVersion = input.spec_version();
+    const auto callIndex = getCallIndex(network, utilityBatchAll);
+
+    size_t maxCount = std::numeric_limits<size_t>::max();
+    if (batch.transfer_weight() > 0 && batch.max_weight() > 0) {
+        maxCount = std::max(batch.max_weight() / batch.transfer_weight(), uint64_t(1));
+    }
+    // signed extrinsic, without the nonce and the call: version, signer, signature type and signature, era, tip
+    const auto signerSize = encodeRawAccount(network, specVersion) ? 32 : 33;
+    const auto fixedSize = 1 + signerSize + 1 + 64 +
+        (input.has_era() ? 2 : 1) + encodeCompact(CompactInteger(load(input.tip()))).size();
+    const auto extrinsicSize = [&](uint64_t nonce, size_t count, size_t transfersSize) {
+        const auto size = fixedSize + compactSize(nonce) + callIndex.size() + compactSize(count) + transfersSize;
+        return compactSize(size) + size;
+    };
+
+    std::vector<Extrinsic> extrinsics;
+    // the transfer calls of the current extrinsic
+    Data transfers;
+    size_t count = 0;
+    const auto flush = [&]() {
+        Data call;
+        call.reserve(callIndex.size() + compactSize(count) + transfers.size());
+        append(call, callIndex);
+        encodeCompact(uint64_t(count), call);
+        append(call, transfers);
+        auto& extrinsic = extrinsics.emplace_back(input, std::move(call));
+        extrinsic.nonce = input.nonce() + extrinsics.size() - 1;
+        transfers.clear();
+        count = 0;
+    };
+
+    for (const auto& transfer : batch.transfers()) {
+        const auto start = transfers.size();
+        encodeTransferCall(transfer, network, specVersion, transfers);
+        const auto fits = [&](size_t n, size_t transfersSize) {
+            const auto nonce = input.nonce() + extrinsics.size();
+            return n <= maxCount &&
+                (batch.max_length() == 0 || extrinsicSize(nonce, n, transfersSize) <= batch.max_length());
+        };
+        if (count > 0 && !fits(count + 1, transfers.size())) {
+            // the transfer goes to the next extrinsic
+            auto next = Data(transfers.begin() + start, transfers.end());
+            transfers.resize(start);
+            flush();
+            transfers = std::move(next);
+        }
+        ++count;
+        if (!fits(count, transfers.size())) {
+            throw std::invalid_argument("transfer exceeds the extrinsic length limit");
+        }
+    }
+    if (count > 0) {
+        flush();
+    }
+    return extrinsics;
 }
 
 Data Extrinsic::encodeBatchCall(const std::vector<Data>& calls, TWSS58AddressType network) {
     Data data;
-    append(data, getCallIndex(network, utilityBatch));
+    append(data, getCallIndex(network, utilityBatchAll));
     append(data, encodeVector(calls));
     return data;
 }
@@ -215,11 +307,32 @@ Data Extrinsic::encodeStakingCall(const Proto::Staking& staking, TWSS58AddressTy
 }
 
 Data Extrinsic::encodePayload() const {
+    const auto suffix = encodePayloadSuffix();
     Data data;
+    data.reserve(payloadSize(suffix));
+    DataSink sink(data);
+    encodePayload(sink, suffix);
+    return data;
+}
+
+void Extrinsic::encodePayload(ByteSink& sink, const Data& suffix) const {
     // call
-    append(data, call);
+    sink.write(call);
     // era / nonce / tip
-    append(data, encodeEraNonceTip());
+    Data eraNonceTip;
+    encodeEraNonceTip(eraNonceTip);
+    sink.write(eraNonceTip);
+    // specVersion / transactionVersion / genesis hash / block hash
+    sink.write(suffix);
+}
+
+size_t Extrinsic::payloadSize(const Data& suffix) const {
+    return call.size() + era.size() + compactSize(nonce) + encodeCompact(tip).size() + suffix.size();
+}
+
+Data Extrinsic::encodePayloadSuffix() const {
+    Data data;
+    data.reserve(8 + genesisHash.size() + blockHash.size());
     // specVersion
     encode32LE(specVersion, data);
     // transactionVersion
@@ -232,20 +345,27 @@ Data Extrinsic::encodePayload() const {
 }
 
 Data Extrinsic::encodeSignature(const PublicKey& signer, const Data& signature) const {
+    Data signerId;
+    encodeAccountId(Data(signer.bytes), encodeRawAccount(network, specVersion), signerId);
+    Data eraNonceTip;
+    encodeEraNonceTip(eraNonceTip);
+    const auto size = 1 + signerId.size() + 1 + signature.size() + eraNonceTip.size() + call.size();
+
     Data data;
+    data.reserve(compactSize(size) + size);
+    // length, known upfront so nothing is moved to prepend it
+    encodeCompact(uint64_t(size), data);
     // version header
     append(data, Data{extrinsicFormat | signedBit});
     // signer public key
-    append(data, encodeAccountId(signer.bytes, encodeRawAccount(network, specVersion)));
+    append(data, signerId);
     // signature type
     append(data, sigTypeEd25519);
     // signature
     append(data, signature);
     // era / nonce / tip
-    append(data, encodeEraNonceTip());
+    append(data, eraNonceTip);
     // call
     append(data, call);
-    // append length
-    encodeLengthPrefix(data);
     return data;
 }
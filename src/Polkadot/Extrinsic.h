@@ -7,11 +7,14 @@
 #pragma once
 
 #include "Address.h"
+#include "../ByteSink.h"
 #include "../Data.h"
 #include "../proto/Polkadot.pb.h"
 #include "../uint256.h"
 #include  "ScaleCodec.h"
 
+#include <vector>
+
 namespace TW::Polkadot {
 
 // ExtrinsicV4
@@ -33,7 +36,9 @@ class Extrinsic {
     // network
     TWSS58AddressType network;
 
-    Extrinsic(const Proto::SigningInput& input)
+    Extrinsic(const Proto::SigningInput& input) : Extrinsic(input, encodeCall(input)) {}
+
+    Extrinsic(const Proto::SigningInput& input, Data call)
         : blockHash(input.block_hash().begin(), input.block_hash().end())
         , genesisHash(input.genesis_hash().begin(), input.genesis_hash().end())
         , nonce(input.nonce())
@@ -47,21 +52,32 @@ class Extrinsic {
           era = encodeCompact(0);
         }
         network = TWSS58AddressType(input.network());
-        call = encodeCall(input);
+        this->call = std::move(call);
     }
 
     static Data encodeCall(const Proto::SigningInput& input);
+    /// Packs the transfers of the batch transfer call of the input into Utility.batch_all extrinsics, with
+    /// consecutive nonces, each within the weight and length limits of the batch transfer.
+    static std::vector<Extrinsic> batchTransfers(const Proto::SigningInput& input);
     // Payload to sign.
     Data encodePayload() const;
+    /// Writes the payload to sign into the sink, ending with the given payload suffix.
+    void encodePayload(ByteSink& sink, const Data& suffix) const;
+    /// Size of the payload to sign, ending with the given payload suffix.
+    size_t payloadSize(const Data& suffix) const;
+    /// End of the payload, the same for all extrinsics against a block: spec and transaction versions, genesis and block hashes.
+    Data encodePayloadSuffix() const;
     // Encode final data with signer public key and signature.
     Data encodeSignature(const PublicKey& signer, const Data& signature) const;
 
   protected:
     static bool encodeRawAccount(TWSS58AddressType network, uint32_t specVersion);
     static Data encodeBalanceCall(const Proto::Balance& balance, TWSS58AddressType network, uint32_t specVersion);
+    static void encodeTransferCall(const Proto::Balance::Transfer& transfer, TWSS58AddressType network, uint32_t specVersion, Data& data);
     static Data encodeStakingCall(const Proto::Staking& staking, TWSS58AddressType network, uint32_t specVersion);
     static Data encodeBatchCall(const std::vector<Data>& calls, TWSS58AddressType network);
     Data encodeEraNonceTip() const;
+    void encodeEraNonceTip(Data& data) const;
 };
 
 } // namespace TW::Polkadot
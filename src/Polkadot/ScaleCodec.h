@@ -14,6 +14,7 @@
 #include <cmath>
 #include <algorithm>
 #include <bitset>
+#include <limits>
 
 
 /// Reference https://github.com/soramitsu/kagome/blob/master/core/scale/scale_encoder_stream.cpp
@@ -39,33 +40,56 @@ inline size_t countBytes(CompactInteger value) {
     return size;
 }
 
-inline Data encodeCompact(CompactInteger value) {
-    auto data = Data{};
+/// Number of significant bytes of a native integer, at least 1.
+inline size_t countBytes(uint64_t value) {
+    size_t size = 1;
+    while (value >>= 8) {
+        ++size;
+    }
+    return size;
+}
 
+/// Size of the compact encoding of a native integer.
+inline size_t compactSize(uint64_t value) {
     if (value < kMinUint16) {
-        auto v = value.convert_to<uint8_t>() << 2u;
-        data.push_back(static_cast<uint8_t>(v));
-        return data;
+        return 1;
     } else if (value < kMinUint32) {
-        auto v = (value.convert_to<uint16_t>() << 2u);
-        v += 0x01; // set 0b01 flag
-        auto minor_byte = static_cast<uint8_t>(v & 0xffu);
-        data.push_back(minor_byte);
-        v >>= 8u;
-        auto major_byte = static_cast<uint8_t>(v & 0xffu);
-        data.push_back(major_byte);
-        return data;
+        return 2;
     } else if (value < kMinBigInteger) {
-        uint32_t v = (value.convert_to<uint32_t>() << 2u);
-        v += 0x02; // set 0b10 flag
-        encode32LE(v, data);
-        return data;
+        return 4;
+    }
+    return 1 + countBytes(value);
+}
+
+/// Appends the compact encoding of a native integer; no big integer arithmetic involved.
+inline void encodeCompact(uint64_t value, Data& data) {
+    if (value < kMinUint16) {
+        data.push_back(static_cast<uint8_t>(value << 2u));
+    } else if (value < kMinUint32) {
+        encode16LE(static_cast<uint16_t>((value << 2u) + 0x01), data); // set 0b01 flag
+    } else if (value < kMinBigInteger) {
+        encode32LE(static_cast<uint32_t>((value << 2u) + 0x02), data); // set 0b10 flag
+    } else {
+        // at least 4 bytes, as value >= 2^30
+        const auto length = countBytes(value);
+        data.push_back(static_cast<uint8_t>(((length - 4) << 2u) + 0x03)); // set 0b11 flag
+        for (size_t i = 0; i < length; ++i) {
+            data.push_back(static_cast<uint8_t>(value >> (8 * i)));
+        }
+    }
+}
+
+/// Appends the compact encoding of a big integer; values fitting in 64 bits take the native path.
+inline void encodeCompact(const CompactInteger& value, Data& data) {
+    if (value <= std::numeric_limits<uint64_t>::max()) {
+        encodeCompact(value.convert_to<uint64_t>(), data);
+        return;
     }
 
     auto length = countBytes(value);
     if (length > 67) {
         // too big
-        return data;
+        return;
     }
     uint8_t header = (static_cast<uint8_t>(length) - 4) * 4;
     header += 0x03; // set 0b11 flag;
@@ -76,13 +100,24 @@ inline Data encodeCompact(CompactInteger value) {
         data.push_back(static_cast<uint8_t>(v & 0xff)); // push back least significant byte
         v >>= 8;
     }
+}
+
+inline Data encodeCompact(uint64_t value) {
+    auto data = Data{};
+    encodeCompact(value, data);
+    return data;
+}
+
+inline Data encodeCompact(const CompactInteger& value) {
+    auto data = Data{};
+    encodeCompact(value, data);
     return data;
 }
 
 // append length prefix
 inline void encodeLengthPrefix(Data& data) {
     size_t len = data.size();
-    auto prefix = encodeCompact(len);
+    auto prefix = encodeCompact(uint64_t(len));
     data.insert(data.begin(), prefix.begin(), prefix.end());
 }
 
@@ -91,21 +126,25 @@ inline Data encodeBool(bool value) {
 }
 
 inline Data encodeVector(const std::vector<Data>& vec) {
-    auto data = encodeCompact(vec.size());
-    for (auto v : vec) {
+    auto data = encodeCompact(uint64_t(vec.size()));
+    for (const auto& v : vec) {
         append(data, v);
     }
     return data;
 }
 
-inline Data encodeAccountId(const Data& bytes, bool raw) {
-    auto data = Data{};
+inline void encodeAccountId(const Data& bytes, bool raw, Data& data) {
     if (!raw) {
         // MultiAddress::AccountId
         // https://github.com/paritytech/substrate/blob/master/primitives/runtime/src/multiaddress.rs#L28
         append(data, 0x00);
     }
     append(data, bytes);
+}
+
+inline Data encodeAccountId(const Data& bytes, bool raw) {
+    auto data = Data{};
+    encodeAccountId(bytes, raw, data);
     return data;
 }
 
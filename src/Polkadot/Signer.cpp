@@ -6,27 +6,59 @@
 
 #include "Signer.h"
 #include "Extrinsic.h"
+#include "../ByteSink.h"
 #include "../Hash.h"
 #include "../PrivateKey.h"
 
+#include <cassert>
+
 using namespace TW;
 using namespace TW::Polkadot;
 
 static constexpr size_t hashTreshold = 256;
 
-Proto::SigningOutput Signer::sign(const Proto::SigningInput &input) noexcept {
-    auto privateKey = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
-    auto publicKey = privateKey.getPublicKey(TWPublicKeyTypeED25519);
-    auto extrinsic = Extrinsic(input);
-    auto payload = extrinsic.encodePayload();
+SigningSession::SigningSession(const Proto::SigningInput& input)
+    : privateKey(input.private_key())
+    , publicKey(privateKey.getPublicKey(TWPublicKeyTypeED25519))
+    , payloadSuffix(Extrinsic(input, Data()).encodePayloadSuffix()) {}
+
+Data SigningSession::sign(const Extrinsic& extrinsic) const {
+    assert(extrinsic.encodePayloadSuffix() == payloadSuffix);
+    Data payload;
     // check if need to hash
-    if (payload.size() > hashTreshold) {
-        payload = Hash::blake2b(payload, 32);
+    if (extrinsic.payloadSize(payloadSuffix) > hashTreshold) {
+        auto hasher = Hash::Blake2b(32);
+        auto sink = HashSink<Hash::Blake2b>(hasher);
+        extrinsic.encodePayload(sink, payloadSuffix);
+        payload = hasher.final();
+    } else {
+        auto sink = DataSink(payload);
+        extrinsic.encodePayload(sink, payloadSuffix);
     }
     auto signature = privateKey.sign(payload, TWCurveED25519);
-    auto encoded = extrinsic.encodeSignature(publicKey, signature);
+    return extrinsic.encodeSignature(publicKey, signature);
+}
 
+Proto::SigningOutput Signer::sign(const Proto::SigningInput &input) noexcept {
     auto protoOutput = Proto::SigningOutput();
-    protoOutput.set_encoded(encoded.data(), encoded.size());
+    try {
+        const auto session = SigningSession(input);
+        if (input.has_balance_call() && input.balance_call().has_batch_transfer()) {
+            for (const auto& extrinsic : Extrinsic::batchTransfers(input)) {
+                const auto encoded = session.sign(extrinsic);
+                protoOutput.add_encoded_batch(encoded.data(), encoded.size());
+            }
+            if (protoOutput.encoded_batch_size() > 0) {
+                protoOutput.set_encoded(protoOutput.encoded_batch(0));
+            }
+            return protoOutput;
+        }
+
+        auto encoded = session.sign(Extrinsic(input));
+        protoOutput.set_encoded(encoded.data(), encoded.size());
+    } catch (const std::exception&) {
+        // invalid input, e.g. a transfer over the extrinsic length limit: empty output
+        return Proto::SigningOutput();
+    }
     return protoOutput;
 }
@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include "Extrinsic.h"
 #include "../Data.h"
 #include "../PrivateKey.h"
+#include "../PublicKey.h"
 #include "../proto/Polkadot.pb.h"
 
 namespace TW::Polkadot {
@@ -22,4 +24,22 @@ public:
     static Proto::SigningOutput sign(const Proto::SigningInput& input) noexcept;
 };
 
+/// Signs extrinsics from the key of a signing input, against its block: the key pair and the payload suffix
+/// are prepared once for all the extrinsics.
+class SigningSession {
+public:
+    explicit SigningSession(const Proto::SigningInput& input);
+
+    /// Signs the extrinsic and returns it encoded.  Payloads over the hashing threshold are hashed as they
+    /// are encoded, without building them.
+    /// The extrinsic must be built from the input of the session: its payload ends with the suffix of that
+    /// input (spec and transaction versions, genesis and block hashes).
+    Data sign(const Extrinsic& extrinsic) const;
+
+private:
+    PrivateKey privateKey;
+    PublicKey publicKey;
+    Data payloadSuffix;
+};
+
 } // namespace TW::Polkadot
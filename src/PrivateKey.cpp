@@ -6,6 +6,7 @@
 
 #include "PrivateKey.h"
 
+#include "Instrumentation.h"
 #include "PublicKey.h"
 
 #include <TrezorCrypto/bignum.h>
@@ -21,9 +22,9 @@
 
 using namespace TW;
 
-bool PrivateKey::isValid(const Data& data) {
+bool PrivateKey::isValid(const byte* data, size_t dataSize) {
     // Check length.  Extended key needs 3*32 bytes.
-    if (data.size() != size && data.size() != extendedSize) {
+    if (dataSize != size && dataSize != extendedSize) {
         return false;
     }
 
@@ -37,10 +38,10 @@ bool PrivateKey::isValid(const Data& data) {
     return false;
 }
 
-bool PrivateKey::isValid(const Data& data, TWCurve curve)
+bool PrivateKey::isValid(const byte* data, size_t dataSize, TWCurve curve)
 {
     // check size
-    bool valid = isValid(data);
+    bool valid = isValid(data, dataSize);
     if (!valid) {
         return false;
     }
@@ -65,7 +66,7 @@ bool PrivateKey::isValid(const Data& data, TWCurve curve)
 
     if (ec_curve != nullptr) {
         bignum256 k;
-        bn_read_be(data.data(), &k);
+        bn_read_be(data, &k);
         if (!bn_is_less(&k, &ec_curve->order)) {
             memzero(&k, sizeof(k));
             return false;
@@ -75,19 +76,18 @@ bool PrivateKey::isValid(const Data& data, TWCurve curve)
     return true;
 }
 
-PrivateKey::PrivateKey(const Data& data) {
-    if (!isValid(data)) {
+PrivateKey::PrivateKey(const byte* data, size_t dataSize) {
+    if (!isValid(data, dataSize)) {
         throw std::invalid_argument("Invalid private key data");
     }
-    if (data.size() == extendedSize) {
+    bytes.assign(data, data + size);
+    if (dataSize == extendedSize) {
         // special extended case
-        *this = PrivateKey(
-            TW::data(data.data(), 32),
-            TW::data(data.data() + 32, 32),
-            TW::data(data.data() + 64, 32));
-    } else {
-        // default case
-        bytes = data;
+        extensionBytes.assign(data + size, data + 2 * size);
+        chainCodeBytes.assign(data + 2 * size, data + 3 * size);
+        if (!isValid(extensionBytes.data(), size) || !isValid(chainCodeBytes.data(), size)) {
+            throw std::invalid_argument("Invalid private key or extended key data");
+        }
     }
 }
 
@@ -101,7 +101,8 @@ PrivateKey::PrivateKey(const Data& data, const Data& ext, const Data& chainCode)
 }
 
 PublicKey PrivateKey::getPublicKey(TWPublicKeyType type) const {
-    Data result;
+    TW_INSTRUMENT_COUNT(ecOperations, 1);
+    PublicKey::Bytes result;
     switch (type) {
     case TWPublicKeyTypeSECP256k1:
         result.resize(PublicKey::secp256k1Size);
@@ -147,11 +148,12 @@ PublicKey PrivateKey::getPublicKey(TWPublicKeyType type) const {
 }
 
 Data PrivateKey::getSharedKey(const PublicKey& pubKey, TWCurve curve) const {
+    TW_INSTRUMENT_COUNT(ecOperations, 1);
     if (curve != TWCurveSECP256k1) {
         return {};
     }
 
-    Data result(PublicKey::secp256k1ExtendedSize);
+    PublicKey::Bytes result(PublicKey::secp256k1ExtendedSize);
     bool success = ecdh_multiply(&secp256k1, bytes.data(),
                                  pubKey.bytes.data(), result.data()) == 0;
 
@@ -172,8 +174,9 @@ int ecdsa_sign_digest_checked(const ecdsa_curve *curve, const uint8_t *priv_key,
     return ecdsa_sign_digest(curve, priv_key, digest, sig, pby, is_canonical);
 }
 
-Data PrivateKey::sign(const Data& digest, TWCurve curve) const {
-    Data result;
+PrivateKey::Signature PrivateKey::sign(const Data& digest, TWCurve curve) const {
+    TW_INSTRUMENT_COUNT(ecOperations, 1);
+    Signature result;
     bool success = false;
     switch (curve) {
     case TWCurveSECP256k1: {
@@ -226,8 +229,9 @@ Data PrivateKey::sign(const Data& digest, TWCurve curve) const {
     return result;
 }
 
-Data PrivateKey::sign(const Data& digest, TWCurve curve, int(*canonicalChecker)(uint8_t by, uint8_t sig[64])) const {
-    Data result;
+PrivateKey::Signature PrivateKey::sign(const Data& digest, TWCurve curve, int(*canonicalChecker)(uint8_t by, uint8_t sig[64])) const {
+    TW_INSTRUMENT_COUNT(ecOperations, 1);
+    Signature result;
     bool success = false;
     switch (curve) {
     case TWCurveSECP256k1: {
@@ -259,25 +263,26 @@ Data PrivateKey::sign(const Data& digest, TWCurve curve, int(*canonicalChecker)(
     return result;
 }
 
-Data PrivateKey::signAsDER(const Data& digest, TWCurve curve) const {
-    Data sig(64);
+PrivateKey::Signature PrivateKey::signAsDER(const Data& digest, TWCurve curve) const {
+    TW_INSTRUMENT_COUNT(ecOperations, 1);
+    std::array<uint8_t, 64> sig;
     bool success =
         ecdsa_sign_digest(&secp256k1, bytes.data(), digest.data(), sig.data(), nullptr, nullptr) == 0;
     if (!success) {
         return {};
     }
 
-    Data resultBytes(72);
+    std::array<uint8_t, 72> resultBytes;
     size_t size = ecdsa_sig_to_der(sig.data(), resultBytes.data());
 
-    auto result = Data{};
-    std::copy(resultBytes.begin(), resultBytes.begin() + size, std::back_inserter(result));
-    return result;
+    // one spare byte in Signature, as Bitcoin appends the sighash type
+    return Signature(resultBytes.begin(), resultBytes.begin() + size);
 }
 
-Data PrivateKey::signSchnorr(const Data& message, TWCurve curve) const {
+PrivateKey::Signature PrivateKey::signSchnorr(const Data& message, TWCurve curve) const {
+    TW_INSTRUMENT_COUNT(ecOperations, 1);
     bool success = false;
-    Data sig(64);
+    Signature sig(64);
     switch (curve) {
     case TWCurveSECP256k1: {
         success = zil_schnorr_sign(&secp256k1, bytes.data(), message.data(), static_cast<uint32_t>(message.size()), sig.data()) == 0;
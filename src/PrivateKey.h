@@ -7,6 +7,7 @@
 #pragma once
 
 #include "Data.h"
+#include "InlineData.h"
 #include "PublicKey.h"
 
 #include <TrustWalletCore/TWCurve.h>
@@ -20,24 +21,41 @@ class PrivateKey {
     /// The number of bytes in an extended private key.
     static const size_t extendedSize = 3 * 32;
 
+    /// Inline storage for one 32-byte part of a key.
+    using Bytes = InlineData<size>;
+    /// Inline storage for a signature, large enough for all the signature formats, including DER plus one appended byte.
+    using Signature = InlineData<73>;
+
     /// The private key bytes.
-    Data bytes;
+    Bytes bytes;
     /// Optional extended part of the key (additional 32 bytes)
-    Data extensionBytes;
+    Bytes extensionBytes;
     /// Optional chain code (additional 32 bytes)
-    Data chainCodeBytes;
+    Bytes chainCodeBytes;
 
     /// Determines if a collection of bytes makes a valid private key.
-    static bool isValid(const Data& data);
+    static bool isValid(const Data& data) { return isValid(data.data(), data.size()); }
+
+    /// Determines if a block of bytes makes a valid private key, without copying it.
+    static bool isValid(const byte* data, size_t size);
 
     /// Determines if a collection of bytes and curve make a valid private key.
-    static bool isValid(const Data& data, TWCurve curve);
+    static bool isValid(const Data& data, TWCurve curve) { return isValid(data.data(), data.size(), curve); }
+
+    /// Determines if a block of bytes and curve make a valid private key, without copying it.
+    static bool isValid(const byte* data, size_t size, TWCurve curve);
 
     /// Initializes a private key with an array of bytes.  Size must be exact (normally 32, or 96 for extended)
-    explicit PrivateKey(const Data& data);
+    explicit PrivateKey(const Data& data) : PrivateKey(data.data(), data.size()) {}
+
+    /// Initializes a private key with a block of bytes, without an intermediate copy.  Size must be exact (normally 32, or 96 for extended)
+    PrivateKey(const byte* data, size_t size);
+
+    /// Initializes a private key with inline bytes, without a heap copy.  Size must be exact (32).
+    explicit PrivateKey(const Bytes& data) : PrivateKey(data.data(), data.size()) {}
 
-    /// Initializes a private key from a string of bytes (convenience method).
-    explicit PrivateKey(const std::string& data) : PrivateKey(TW::data(data)) {}
+    /// Initializes a private key from a string of bytes (convenience method), such as a protobuf bytes field.
+    explicit PrivateKey(const std::string& data) : PrivateKey(reinterpret_cast<const byte*>(data.data()), data.size()) {}
 
     /// Initializes an extended private key with key, extended key, and chain code.
     explicit PrivateKey(const Data& data, const Data& ext, const Data& chainCode);
@@ -58,18 +76,18 @@ class PrivateKey {
     Data getSharedKey(const PublicKey& publicKey, TWCurve curve) const;
 
     /// Signs a digest using the given ECDSA curve.
-    Data sign(const Data& digest, TWCurve curve) const;
+    Signature sign(const Data& digest, TWCurve curve) const;
 
     /// Signs a digest using the given ECDSA curve and prepends the recovery id (a la graphene)
     /// Only a sig that passes canonicalChecker is returned
-    Data sign(const Data& digest, TWCurve curve, int(*canonicalChecker)(uint8_t by, uint8_t sig[64])) const;
+    Signature sign(const Data& digest, TWCurve curve, int(*canonicalChecker)(uint8_t by, uint8_t sig[64])) const;
 
     /// Signs a digest using the given ECDSA curve. The result is encoded with
     /// DER.
-    Data signAsDER(const Data& digest, TWCurve curve) const;
+    Signature signAsDER(const Data& digest, TWCurve curve) const;
 
     /// Signs a digest using given ECDSA curve, returns schnorr signature
-    Data signSchnorr(const Data& message, TWCurve curve) const;
+    Signature signSchnorr(const Data& message, TWCurve curve) const;
 
     /// Cleanup contents (fill with 0s), called before destruction
     void cleanup();
@@ -18,8 +18,7 @@ namespace TW {
 
 /// Determines if a collection of bytes makes a valid public key of the
 /// given type.
-bool PublicKey::isValid(const Data& data, enum TWPublicKeyType type) {
-    const auto size = data.size();
+bool PublicKey::isValid(const byte* data, size_t size, enum TWPublicKeyType type) {
     if (size == 0) {
         return false;
     }
@@ -45,36 +44,15 @@ bool PublicKey::isValid(const Data& data, enum TWPublicKeyType type) {
 /// Initializes a public key with a collection of bytes.
 ///
 /// @throws std::invalid_argument if the data is not a valid public key.
-PublicKey::PublicKey(const Data& data, enum TWPublicKeyType type) : type(type) {
-    if (!isValid(data, type)) {
+PublicKey::PublicKey(const byte* data, size_t size, enum TWPublicKeyType type) : type(type) {
+    if (!isValid(data, size, type)) {
         throw std::invalid_argument("Invalid public key data");
     }
-    switch (type) {
-    case TWPublicKeyTypeSECP256k1:
-    case TWPublicKeyTypeNIST256p1:
-    case TWPublicKeyTypeSECP256k1Extended:
-    case TWPublicKeyTypeNIST256p1Extended:
-        bytes.reserve(data.size());
-        std::copy(std::begin(data), std::end(data), std::back_inserter(bytes));
-        break;
-
-    case TWPublicKeyTypeED25519:
-    case TWPublicKeyTypeCURVE25519:
-        bytes.reserve(ed25519Size);
-        if (data.size() == ed25519Size + 1) {
-            std::copy(std::begin(data) + 1, std::end(data), std::back_inserter(bytes));
-        } else {
-            std::copy(std::begin(data), std::end(data), std::back_inserter(bytes));
-        }
-        break;
-    case TWPublicKeyTypeED25519Blake2b:
-        bytes.reserve(ed25519Size);
-        assert(data.size() == ed25519Size); // ensured by isValid() above
-        std::copy(std::begin(data), std::end(data), std::back_inserter(bytes));
-        break;
-    case TWPublicKeyTypeED25519Extended:
-        bytes.reserve(ed25519ExtendedSize);
-        std::copy(std::begin(data), std::end(data), std::back_inserter(bytes));
+    if ((type == TWPublicKeyTypeED25519 || type == TWPublicKeyTypeCURVE25519) && size == ed25519Size + 1) {
+        // skip the 0x01 prefix
+        bytes.assign(data + 1, data + size);
+    } else {
+        bytes.assign(data, data + size);
     }
 }
 
@@ -83,7 +61,7 @@ PublicKey PublicKey::compressed() const {
         return *this;
     }
 
-    Data newBytes(secp256k1Size);
+    Bytes newBytes(secp256k1Size);
     assert(bytes.size() >= 65);
     newBytes[0] = 0x02 | (bytes[64] & 0x01);
 
@@ -101,7 +79,7 @@ PublicKey PublicKey::compressed() const {
 }
 
 PublicKey PublicKey::extended() const {
-    Data newBytes(secp256k1ExtendedSize);
+    Bytes newBytes(secp256k1ExtendedSize);
     switch (type) {
     case TWPublicKeyTypeSECP256k1:
         ecdsa_uncompress_pubkey(&secp256k1, bytes.data(), newBytes.data());
@@ -188,7 +166,7 @@ PublicKey PublicKey::recover(const Data& signature, const Data& message) {
     if (v >= 27) {
         v -= 27;
     }
-    TW::Data result(65);
+    Bytes result(secp256k1ExtendedSize);
     if (ecdsa_recover_pub_from_sig(&secp256k1, result.data(), signature.data(), message.data(), v) != 0) {
         throw std::invalid_argument("recover failed");
     }
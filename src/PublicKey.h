@@ -8,6 +8,7 @@
 
 #include "Data.h"
 #include "Hash.h"
+#include "InlineData.h"
 
 #include <TrustWalletCore/TWPublicKeyType.h>
 
@@ -29,8 +30,11 @@ class PublicKey {
     /// The number of bytes in a secp256k1 and nist256p1 extended public key.
     static const size_t secp256k1ExtendedSize = 65;
 
+    /// Inline storage for the public key bytes, large enough for all the key types.
+    using Bytes = InlineData<secp256k1ExtendedSize>;
+
     /// The public key bytes.
-    Data bytes;
+    Bytes bytes;
 
     /// The type of the public key.
     ///
@@ -40,12 +44,25 @@ class PublicKey {
 
     /// Determines if a collection of bytes makes a valid public key of the
     /// given type.
-    static bool isValid(const Data& data, enum TWPublicKeyType type);
+    static bool isValid(const Data& data, enum TWPublicKeyType type) { return isValid(data.data(), data.size(), type); }
+
+    /// Determines if a block of bytes makes a valid public key of the given type, without copying it.
+    static bool isValid(const byte* data, size_t size, enum TWPublicKeyType type);
 
     /// Initializes a public key with a collection of bytes.
     ///
     /// @throws std::invalid_argument if the data is not a valid public key.
-    explicit PublicKey(const Data& data, enum TWPublicKeyType type);
+    explicit PublicKey(const Data& data, enum TWPublicKeyType type) : PublicKey(data.data(), data.size(), type) {}
+
+    /// Initializes a public key with inline bytes, without a heap copy.
+    ///
+    /// @throws std::invalid_argument if the data is not a valid public key.
+    explicit PublicKey(const Bytes& data, enum TWPublicKeyType type) : PublicKey(data.data(), data.size(), type) {}
+
+    /// Initializes a public key with a block of bytes, without an intermediate copy.
+    ///
+    /// @throws std::invalid_argument if the data is not a valid public key.
+    PublicKey(const byte* data, size_t size, enum TWPublicKeyType type);
 
     /// Determines if this is a compressed public key.
     bool isCompressed() const {
@@ -70,6 +87,13 @@ class PublicKey {
     /// bytes and then prepending the prefix.
     Data hash(const Data& prefix, Hash::Hasher hasher = Hash::sha256ripemd, bool skipTypeByte = false) const;
 
+    /// Computes the public key hash with a hash function selected at compile time, without a prefix.
+    template <Hash::Algorithm A>
+    Hash::Digest<A> hash(bool skipTypeByte = false) const {
+        const auto offset = std::size_t(skipTypeByte ? 1 : 0);
+        return Hash::digest<A>(bytes.data() + offset, bytes.size() - offset);
+    }
+
     /// Recover public key from signature (SECP256k1Extended)
     static PublicKey recover(const Data& signature, const Data& message);
 
@@ -9,6 +9,7 @@
 #include <optional>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 namespace TW {
 
@@ -47,10 +48,10 @@ struct Result {
 
   public:
     /// Initializes a success result with a payload.
-    Result(Types::Success<T> payload) : success_(true) { new (&storage_) T(payload.val); }
+    Result(Types::Success<T> payload) : success_(true) { new (&storage_) T(std::move(payload.val)); }
 
     /// Initializes a failure result.
-    Result(Types::Failure<E> error) : success_(false) { new (&storage_) E(error.val); }
+    Result(Types::Failure<E> error) : success_(false) { new (&storage_) E(std::move(error.val)); }
 
     Result(const Result& other) : success_(other.success_) {
         if (success_) {
@@ -75,11 +76,11 @@ struct Result {
         }
     }
 
-    Result(Result&& other) {
+    Result(Result&& other) : success_(other.success_) {
         if (success_) {
-            new (&storage_) T(other.get<T>());
+            new (&storage_) T(std::move(other.get<T>()));
         } else {
-            new (&storage_) E(other.get<E>());
+            new (&storage_) E(std::move(other.get<E>()));
         }
     }
 
@@ -112,7 +113,12 @@ struct Result {
     /// Returns the contained payload.
     ///
     /// The behavior is undefined if this result is a failure.
-    T payload() const { return get<T>(); }
+    T payload() const& { return get<T>(); }
+
+    /// Moves the contained payload out of a result that is no longer needed.
+    ///
+    /// The behavior is undefined if this result is a failure.
+    T payload() && { return std::move(get<T>()); }
 
     /// Returns the contained error.
     ///
@@ -14,7 +14,7 @@ using namespace TW::Ripple;
 static const int64_t fullyCanonical = 0x80000000;
 
 Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
-    auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto key = PrivateKey(input.private_key());
     auto transaction = Transaction(
         /* amount */input.amount(),
         /* fee */input.fee(),
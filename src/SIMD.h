@@ -0,0 +1,52 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include <cstdint>
+
+// Multi-lane helpers for the batch hashing kernels.
+//
+// Lane vectors use the GCC/Clang vector extension, so the same kernel source
+// compiles to AVX2 (8 x 32-bit / 4 x 64-bit lanes), SSE2 or NEON (4 x 32-bit lanes),
+// or plain scalar code, depending on the target.  Kernels are written as
+// always-inline templates over the lane type; each entry point instantiates
+// them inside a function carrying the desired target attribute.
+
+namespace TW::SIMD {
+
+typedef uint32_t u32x4 __attribute__((vector_size(16)));
+typedef uint32_t u32x8 __attribute__((vector_size(32)));
+typedef uint64_t u64x2 __attribute__((vector_size(16)));
+typedef uint64_t u64x4 __attribute__((vector_size(32)));
+
+/// Number of lanes in a lane vector type.
+template <typename V>
+constexpr std::size_t lanes() {
+    return sizeof(V) / sizeof(V{}[0]);
+}
+
+/// Returns true if the running CPU supports AVX2.
+inline bool hasAVX2() {
+#if defined(__x86_64__) || defined(__i386__)
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+} // namespace TW::SIMD
+
+#define TW_SIMD_INLINE inline __attribute__((always_inline))
+
+#if defined(__x86_64__) || defined(__i386__)
+#define TW_SIMD_X86 1
+#define TW_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
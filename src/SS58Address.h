@@ -48,9 +48,7 @@ class SS58Address {
 
     template <typename T>
     static Data computeChecksum(const T& data) {
-        auto prefix = Data(SS58Prefix.begin(), SS58Prefix.end());
-        append(prefix, Data(data.begin(), data.end()));
-        auto hash = Hash::blake2b(prefix, 64);
+        auto hash = Hash::Blake2b(64).update(SS58Prefix).update(data).final();
         auto checksum = Data(checksumSize);
         std::copy(hash.begin(), hash.begin() + checksumSize, checksum.data());
         return checksum;
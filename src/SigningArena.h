@@ -0,0 +1,120 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+#include "Instrumentation.h"
+
+#include <google/protobuf/arena.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace TW {
+
+// Scoped access to the protobuf arena of the current thread, used for signing and planning inputs.
+// The arena is reset when the outermost scope ends; its first block is kept across resets,
+// so typical inputs are parsed without any heap allocation.
+class SigningArenaScope {
+public:
+    SigningArenaScope() { ++depth(); }
+    ~SigningArenaScope() {
+        if (--depth() == 0) {
+            arena().Reset();
+        }
+    }
+    SigningArenaScope(const SigningArenaScope&) = delete;
+    SigningArenaScope& operator=(const SigningArenaScope&) = delete;
+
+    google::protobuf::Arena* get() { return &arena(); }
+
+    /// The arena of the current thread while a scope is open, null otherwise.
+    static google::protobuf::Arena* current() { return depth() > 0 ? &arena() : nullptr; }
+
+private:
+    static constexpr size_t initialBlockSize = 32 * 1024;
+
+    static google::protobuf::Arena& arena() {
+        thread_local std::vector<char> initialBlock(initialBlockSize);
+        thread_local google::protobuf::Arena arena([] {
+            google::protobuf::ArenaOptions options;
+            options.initial_block = initialBlock.data();
+            options.initial_block_size = initialBlock.size();
+#ifdef TW_INSTRUMENTATION
+            options.block_alloc = allocateBlock;
+#endif
+            return options;
+        }());
+        return arena;
+    }
+
+#ifdef TW_INSTRUMENTATION
+    static void* allocateBlock(size_t size) {
+        TW_INSTRUMENT_COUNT(allocations, 1);
+        TW_INSTRUMENT_COUNT(allocatedBytes, size);
+        return ::operator new(size);
+    }
+#endif
+
+    static int& depth() {
+        thread_local int depth = 0;
+        return depth;
+    }
+};
+
+// Allocator taking memory from the signing arena that is current when it is constructed,
+// or from the heap when no SigningArenaScope is open.
+// Arena memory is released all at once when the outermost scope ends, so containers using it
+// must not outlive the scope; it suits scratch buffers of a single sign or plan call.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator() noexcept : arena(SigningArenaScope::current()) {}
+    explicit ArenaAllocator(google::protobuf::Arena* arena) noexcept : arena(arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(size_t count) {
+        static_assert(alignof(T) <= 8, "arena allocations are 8-byte aligned");
+        if (arena == nullptr) {
+            return std::allocator<T>().allocate(count);
+        }
+        return reinterpret_cast<T*>(google::protobuf::Arena::CreateArray<char>(arena, count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t count) noexcept {
+        if (arena == nullptr) {
+            std::allocator<T>().deallocate(pointer, count);
+        }
+    }
+
+    google::protobuf::Arena* arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept {
+    return lhs.arena == rhs.arena;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+/// Byte buffer for intermediate encodings, allocated from the signing arena, see ArenaAllocator.
+using ArenaData = std::vector<byte, ArenaAllocator<byte>>;
+
+/// Appends any contiguous byte container to an arena buffer.
+template <typename T>
+inline void append(ArenaData& data, const T& suffix) {
+    data.insert(data.end(), suffix.begin(), suffix.end());
+}
+
+} // namespace TW
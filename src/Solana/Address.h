@@ -9,6 +9,7 @@
 #include "../Base58Address.h"
 #include "../PublicKey.h"
 
+#include <cstring>
 #include <vector>
 #include <string>
 
@@ -41,6 +42,16 @@ class Address : public Base58Address<32> {
     Address defaultTokenAddress(const Address& tokenMintAddress);
 };
 
+/// Hash of an address, for unordered containers.  Keys are mostly public keys, so their bytes are
+/// uniformly distributed already; the four words are still folded together for program ids and sysvars.
+struct AddressHash {
+    size_t operator()(const Address& address) const {
+        uint64_t words[4];
+        std::memcpy(words, address.bytes.data(), sizeof(words));
+        return static_cast<size_t>(words[0] ^ words[1] ^ words[2] ^ words[3]);
+    }
+};
+
 } // namespace TW::Solana
 
 /// Wrapper for C interface
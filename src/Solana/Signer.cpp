@@ -16,10 +16,11 @@ using namespace TW;
 using namespace TW::Solana;
 
 void Signer::sign(const std::vector<PrivateKey>& privateKeys, Transaction& transaction) {
-    for (auto privateKey : privateKeys) {
+    // signatures are not part of the message, so it is serialized once for all signers
+    const auto message = transaction.messageData();
+    for (const auto& privateKey : privateKeys) {
         auto address = Address(privateKey.getPublicKey(TWPublicKeyTypeED25519));
         auto index = transaction.getAccountIndex(address);
-        auto message = transaction.messageData();
         auto signature = Signature(privateKey.sign(message, TWCurveED25519));
         transaction.signatures[index] = signature;
     }
@@ -27,7 +28,7 @@ void Signer::sign(const std::vector<PrivateKey>& privateKeys, Transaction& trans
 
 Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
     auto blockhash = Solana::Hash(input.recent_blockhash());
-    auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto key = PrivateKey(input.private_key());
     Message message;
     std::string stakePubkey;
     std::vector<PrivateKey> signerKeys;
@@ -136,6 +137,39 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
             }
             break;
 
+        case Proto::SigningInput::TransactionTypeCase::kBatchTransferTransaction:
+            {
+                auto protoMessage = input.batch_transfer_transaction();
+                std::vector<std::pair<Address, uint64_t>> transfers;
+                transfers.reserve(protoMessage.transfers_size());
+                for (const auto& transfer: protoMessage.transfers()) {
+                    transfers.emplace_back(Address(transfer.recipient()), transfer.value());
+                }
+                std::vector<AddressLookupTable> lookupTables;
+                for (const auto& table: protoMessage.address_lookup_tables()) {
+                    std::vector<Address> addresses;
+                    addresses.reserve(table.addresses_size());
+                    for (const auto& address: table.addresses()) {
+                        addresses.emplace_back(address);
+                    }
+                    lookupTables.emplace_back(Address(table.account()), addresses);
+                }
+                auto transactions = Transaction::batchTransfers(
+                    /* from */ Address(key.getPublicKey(TWPublicKeyTypeED25519)),
+                    transfers,
+                    /* recent_blockhash */ blockhash,
+                    lookupTables);
+                auto protoOutput = Proto::SigningOutput();
+                for (auto& transaction: transactions) {
+                    sign({key}, transaction);
+                    protoOutput.add_encoded_batch(transaction.serialize());
+                }
+                if (!transactions.empty()) {
+                    protoOutput.set_encoded(protoOutput.encoded_batch(0));
+                }
+                return protoOutput;
+            }
+
         default:
             assert(input.transaction_type_case() != Proto::SigningInput::TransactionTypeCase::TRANSACTION_TYPE_NOT_SET);
     }
@@ -11,120 +11,308 @@
 #include "../BinaryCoding.h"
 #include "../PublicKey.h"
 
+#include <algorithm>
+#include <numeric>
+#include <unordered_set>
 #include <vector>
 
 using namespace TW;
 using namespace TW::Solana;
 using namespace std;
 
-uint8_t CompiledInstruction::findAccount(const Address& address) {
-    auto it = std::find(addresses.begin(), addresses.end(), address);
-    if (it == addresses.end()) {
+AddressIndex CompiledInstruction::indexAddresses(const std::vector<Address>& addresses) {
+    if (addresses.size() > 256) {
+        throw std::invalid_argument("too many addresses");
+    }
+    AddressIndex index;
+    index.reserve(addresses.size());
+    for (size_t i = 0; i < addresses.size(); ++i) {
+        // the first occurrence wins
+        index.emplace(addresses[i], static_cast<uint8_t>(i));
+    }
+    return index;
+}
+
+uint8_t CompiledInstruction::findAccount(const AddressIndex& index, const Address& address) {
+    auto it = index.find(address);
+    if (it == index.end()) {
         throw std::invalid_argument("address not found");
     }
-    assert(it != addresses.end());
-    auto dist = std::distance(addresses.begin(), it);
-    assert(dist < 256);
-    return (uint8_t)dist;
+    return it->second;
 }
 
 void Message::addAccount(const AccountMeta& account) {
-    bool inSigned = (std::find(signedAccounts.begin(), signedAccounts.end(), account.account) != signedAccounts.end());
-    bool inUnsigned = (std::find(unsignedAccounts.begin(), unsignedAccounts.end(), account.account) != unsignedAccounts.end());
-    bool inReadOnly = (std::find(readOnlyAccounts.begin(), readOnlyAccounts.end(), account.account) != readOnlyAccounts.end());
-    if (account.isSigner) {
-        if (!inSigned) {
-            signedAccounts.push_back(account.account);
-        }
-    } else if (!account.isReadOnly) {
-        if (!inSigned && !inUnsigned) {
-            unsignedAccounts.push_back(account.account);
+    const auto [it, inserted] = accountPositions.emplace(account.account, accounts.size());
+    if (inserted) {
+        accounts.push_back(account);
+        return;
+    }
+    auto& existing = accounts[it->second];
+    existing.isSigner = existing.isSigner || account.isSigner;
+    existing.isReadOnly = existing.isReadOnly && account.isReadOnly;
+}
+
+namespace {
+
+/// Position of an address in the lookup tables: table index, and index in the table
+using LookupTableIndex = std::unordered_map<Address, std::pair<size_t, uint8_t>, AddressHash>;
+
+/// Indexes the addresses of the lookup tables; an address held by several tables is loaded from the first one.
+LookupTableIndex indexLookupTables(const std::vector<AddressLookupTable>& lookupTables) {
+    LookupTableIndex index;
+    for (size_t t = 0; t < lookupTables.size(); ++t) {
+        const auto& addresses = lookupTables[t].addresses;
+        if (addresses.size() > 256) {
+            throw std::invalid_argument("too many addresses in lookup table");
         }
-    } else {
-        if (!inSigned && !inUnsigned && !inReadOnly) {
-            readOnlyAccounts.push_back(account.account);
+        for (size_t i = 0; i < addresses.size(); ++i) {
+            index.emplace(addresses[i], std::make_pair(t, static_cast<uint8_t>(i)));
         }
     }
+    return index;
 }
 
-void Message::compileAccounts() {
+} // namespace
+
+void Message::compileAccounts(const std::vector<AddressLookupTable>& lookupTables) {
+    // only a versioned message can load accounts from lookup tables
+    if (!lookupTables.empty()) {
+        version = MessageVersion::V0;
+    }
+    accounts.clear();
+    accountPositions.clear();
     for (auto& instr: instructions) {
         for (auto& address: instr.accounts) {
             addAccount(address);
         }
     }
     // add programIds (read-only, at end)
+    std::unordered_set<Address, AddressHash> programIds;
     for (auto& instr: instructions) {
         addAccount(AccountMeta{instr.programId, false, true});
+        programIds.insert(instr.programId);
     }
 
-    header = MessageHeader{
-        (uint8_t)signedAccounts.size(),
-        0,
-        (uint8_t)readOnlyAccounts.size()
+    // signers and invoked programs have to be in the message itself
+    const auto tableIndex = indexLookupTables(lookupTables);
+    std::vector<const AccountMeta*> loaded;
+    const auto isLoaded = [&](const AccountMeta& a) {
+        return !a.isSigner && programIds.count(a.account) == 0 && tableIndex.count(a.account) != 0;
     };
 
-    // merge the three buckets
+    // signers (read-only or not), then writable, then read-only accounts;
+    // signers in order of their first signing use, so that the fee payer stays first
     accountKeys.clear();
-    for(auto& a: signedAccounts) {
-        accountKeys.push_back(a);
+    accountKeys.reserve(accounts.size());
+    std::unordered_set<Address, AddressHash> signers;
+    for (const auto& instr: instructions) {
+        for (const auto& a: instr.accounts) {
+            if (a.isSigner && signers.insert(a.account).second) {
+                accountKeys.push_back(a.account);
+            }
+        }
+    }
+    const auto numSigned = accountKeys.size();
+    for (const auto& a: accounts) {
+        if (!a.isSigner && !a.isReadOnly && !isLoaded(a)) {
+            accountKeys.push_back(a.account);
+        }
+    }
+    const auto numWritable = accountKeys.size();
+    for (const auto& a: accounts) {
+        if (!a.isSigner && a.isReadOnly && !isLoaded(a)) {
+            accountKeys.push_back(a.account);
+        }
     }
-    for(auto& a: unsignedAccounts) {
-        accountKeys.push_back(a);
+
+    header = MessageHeader{
+        (uint8_t)numSigned,
+        0,
+        (uint8_t)(accountKeys.size() - numWritable)
+    };
+
+    // loaded accounts: per table, the writable ones then the read-only ones, tables in order of first use
+    addressTableLookups.clear();
+    loadedAddresses.clear();
+    std::vector<size_t> lookupTable;
+    std::vector<size_t> lookupOfTable(lookupTables.size(), lookupTables.size());
+    for (const bool writable: {true, false}) {
+        for (const auto& a: accounts) {
+            if (!isLoaded(a) || a.isReadOnly == writable) {
+                continue;
+            }
+            const auto [table, position] = tableIndex.at(a.account);
+            if (lookupOfTable[table] == lookupTables.size()) {
+                lookupOfTable[table] = addressTableLookups.size();
+                addressTableLookups.emplace_back(lookupTables[table].account);
+                lookupTable.push_back(table);
+            }
+            auto& lookup = addressTableLookups[lookupOfTable[table]];
+            (writable ? lookup.writableIndexes : lookup.readonlyIndexes).push_back(position);
+        }
     }
-    for(auto& a: readOnlyAccounts) {
-        accountKeys.push_back(a);
+    // indexed after the keys: the writable accounts of all the lookups, then the read-only ones
+    for (const bool writable: {true, false}) {
+        for (size_t l = 0; l < addressTableLookups.size(); ++l) {
+            const auto& lookup = addressTableLookups[l];
+            for (auto position: writable ? lookup.writableIndexes : lookup.readonlyIndexes) {
+                loadedAddresses.push_back(lookupTables[lookupTable[l]].addresses[position]);
+            }
+        }
     }
 
     compileInstructions();
 }
 
 void Message::compileInstructions() {
+    auto keys = accountKeys;
+    keys.insert(keys.end(), loadedAddresses.begin(), loadedAddresses.end());
+    const auto index = CompiledInstruction::indexAddresses(keys);
     compiledInstructions.clear();
-    for (auto instruction: instructions) {
-        compiledInstructions.push_back(CompiledInstruction(instruction, accountKeys));
+    compiledInstructions.reserve(instructions.size());
+    for (const auto& instruction: instructions) {
+        compiledInstructions.emplace_back(instruction, index);
+    }
+}
+
+std::vector<Transaction> Transaction::batchTransfers(const Address& from,
+                                                     const std::vector<std::pair<Address, uint64_t>>& transfers,
+                                                     Hash recentBlockhash,
+                                                     const std::vector<AddressLookupTable>& lookupTables) {
+    const auto systemProgramId = Address(SYSTEM_PROGRAM_ID_ADDRESS);
+    const auto tableIndex = indexLookupTables(lookupTables);
+    const bool versioned = !lookupTables.empty();
+    // per instruction: program index, account count, 2 account indices, data length, 12 data bytes
+    const size_t instructionSize = 1 + 1 + 2 + 1 + 12;
+
+    std::vector<Transaction> transactions;
+    std::vector<std::pair<Address, uint64_t>> batch;
+    // the accounts of the batch: the sender, the system program, and the recipients;
+    // either as keys of the message, or loaded from the lookup tables
+    std::unordered_set<Address, AddressHash> accounts;
+    size_t keyCount = 0;
+    std::vector<size_t> loadedCount(lookupTables.size());
+
+    const auto transactionSize = [&](size_t keys, const std::vector<size_t>& loaded, size_t instructionCount) {
+        auto size = shortVecLengthSize(1) + Signature::size + (versioned ? 1 : 0) + 3 +
+            shortVecLengthSize(keys) + keys * Address::size + Hash::size +
+            shortVecLengthSize(instructionCount) + instructionCount * instructionSize;
+        if (versioned) {
+            // recipients are writable: table key, writable indices, no read-only index
+            const auto tableCount = static_cast<size_t>(loaded.size() - std::count(loaded.begin(), loaded.end(), 0));
+            size += shortVecLengthSize(tableCount);
+            for (auto count: loaded) {
+                if (count > 0) {
+                    size += Address::size + shortVecLengthSize(count) + count + shortVecLengthSize(0);
+                }
+            }
+        }
+        return size;
+    };
+    const auto startBatch = [&]() {
+        batch.clear();
+        accounts = {from, systemProgramId};
+        keyCount = 2;
+        std::fill(loadedCount.begin(), loadedCount.end(), 0);
+    };
+    const auto flushBatch = [&]() {
+        transactions.emplace_back(Message(from, batch, recentBlockhash, lookupTables));
+    };
+
+    // counts the recipient as a new key or loaded account, if it is not in the batch yet
+    const auto addRecipient = [&](const Address& recipient, size_t& keys, std::vector<size_t>& loaded) {
+        if (accounts.count(recipient) != 0) {
+            return;
+        }
+        const auto table = tableIndex.find(recipient);
+        if (table != tableIndex.end()) {
+            ++loaded[table->second.first];
+        } else {
+            ++keys;
+        }
+    };
+
+    startBatch();
+    for (const auto& transfer: transfers) {
+        auto newKeyCount = keyCount;
+        auto newLoadedCount = loadedCount;
+        addRecipient(transfer.first, newKeyCount, newLoadedCount);
+        // account indices are single bytes
+        const auto accountCount = newKeyCount + std::accumulate(newLoadedCount.begin(), newLoadedCount.end(), size_t(0));
+        if (!batch.empty() &&
+            (accountCount > 256 || transactionSize(newKeyCount, newLoadedCount, batch.size() + 1) > PACKET_DATA_SIZE)) {
+            flushBatch();
+            startBatch();
+            newKeyCount = keyCount;
+            newLoadedCount = loadedCount;
+            addRecipient(transfer.first, newKeyCount, newLoadedCount);
+        }
+        accounts.insert(transfer.first);
+        keyCount = newKeyCount;
+        loadedCount = std::move(newLoadedCount);
+        batch.push_back(transfer);
+    }
+    if (!batch.empty()) {
+        flushBatch();
     }
+    return transactions;
 }
 
 std::string Transaction::serialize() const {
     Data buffer;
+    buffer.reserve(3 + 64 * signatures.size() + 32 * (message.accountKeys.size() + 1) + 64 * message.compiledInstructions.size());
 
-    append(buffer, shortVecLength<Signature>(this->signatures));
-    for (auto signature : this->signatures) {
-        Data signature_vec(signature.bytes.begin(), signature.bytes.end());
-        append(buffer, signature_vec);
+    appendShortVecLength(buffer, signatures.size());
+    for (const auto& signature : signatures) {
+        buffer.insert(buffer.end(), signature.bytes.begin(), signature.bytes.end());
     }
-    append(buffer, this->messageData());
+    appendMessageData(buffer);
 
     return Base58::bitcoin.encode(buffer);
 }
 
 Data Transaction::messageData() const {
     Data buffer;
+    buffer.reserve(5 + 32 * (message.accountKeys.size() + 1) + 64 * message.compiledInstructions.size());
+    appendMessageData(buffer);
+    return buffer;
+}
 
+void Transaction::appendMessageData(Data& buffer) const {
+    if (message.version == MessageVersion::V0) {
+        // version prefix, with the high bit set to tell it from the legacy header
+        buffer.push_back(0x80);
+    }
     buffer.push_back(this->message.header.numRequiredSignatures);
     buffer.push_back(this->message.header.numCreditOnlySignedAccounts);
     buffer.push_back(this->message.header.numCreditOnlyUnsignedAccounts);
-    append(buffer, shortVecLength<Address>(this->message.accountKeys));
-    for (auto account_key : this->message.accountKeys) {
-        Data account_key_vec(account_key.bytes.begin(), account_key.bytes.end());
-        append(buffer, account_key_vec);
+    appendShortVecLength(buffer, message.accountKeys.size());
+    for (const auto& account_key : this->message.accountKeys) {
+        buffer.insert(buffer.end(), account_key.bytes.begin(), account_key.bytes.end());
     }
-    Data recentBlockhash(this->message.recentBlockhash.bytes.begin(),
-                         this->message.recentBlockhash.bytes.end());
-    append(buffer, recentBlockhash);
+    const auto& recentBlockhash = this->message.recentBlockhash.bytes;
+    buffer.insert(buffer.end(), recentBlockhash.begin(), recentBlockhash.end());
 
     // apppend compiled instructions
-    append(buffer, shortVecLength<CompiledInstruction>(message.compiledInstructions));
-    for (auto instruction : message.compiledInstructions) {
+    appendShortVecLength(buffer, message.compiledInstructions.size());
+    for (const auto& instruction : message.compiledInstructions) {
         buffer.push_back(instruction.programIdIndex);
-        append(buffer, shortVecLength<uint8_t>(instruction.accounts));
+        appendShortVecLength(buffer, instruction.accounts.size());
         append(buffer, instruction.accounts);
-        append(buffer, shortVecLength<uint8_t>(instruction.data));
+        appendShortVecLength(buffer, instruction.data.size());
         append(buffer, instruction.data);
     }
 
-    return buffer;
+    if (message.version == MessageVersion::V0) {
+        appendShortVecLength(buffer, message.addressTableLookups.size());
+        for (const auto& lookup : message.addressTableLookups) {
+            buffer.insert(buffer.end(), lookup.accountKey.bytes.begin(), lookup.accountKey.bytes.end());
+            appendShortVecLength(buffer, lookup.writableIndexes.size());
+            append(buffer, lookup.writableIndexes);
+            appendShortVecLength(buffer, lookup.readonlyIndexes.size());
+            append(buffer, lookup.readonlyIndexes);
+        }
+    }
 }
 
 uint8_t Transaction::getAccountIndex(Address publicKey) {
@@ -14,6 +14,8 @@
 #include <vector>
 #include <string>
 #include <cassert>
+#include <unordered_map>
+#include <utility>
 
 namespace TW::Solana {
 
@@ -29,21 +31,39 @@ const std::string STAKE_CONFIG_ID_ADDRESS = "StakeConfig111111111111111111111111
 const std::string NULL_ID_ADDRESS = "11111111111111111111111111111111";
 const std::string SYSVAR_STAKE_HISTORY_ID_ADDRESS = "SysvarStakeHistory1111111111111111111111111";
 
-template <typename T>
-Data shortVecLength(std::vector<T> vec) {
-    auto bytes = Data();
-    auto remLen = vec.size();
+/// Maximum size of a serialized transaction, the IPv6 MTU minus the headers
+const size_t PACKET_DATA_SIZE = 1232;
+
+/// Appends a length in the compact-u16 format.
+inline void appendShortVecLength(Data& buffer, size_t length) {
+    auto remLen = length;
     while (true) {
         uint8_t elem = remLen & 0x7f;
         remLen >>= 7;
         if (remLen == 0) {
-            bytes.push_back(elem);
+            buffer.push_back(elem);
             break;
         } else {
             elem |= 0x80;
-            bytes.push_back(elem);
+            buffer.push_back(elem);
         }
     }
+}
+
+/// Number of bytes of a length in the compact-u16 format.
+inline size_t shortVecLengthSize(size_t length) {
+    size_t size = 1;
+    while (length >= 0x80) {
+        length >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+template <typename T>
+Data shortVecLength(const std::vector<T>& vec) {
+    auto bytes = Data();
+    appendShortVecLength(bytes, vec.size());
     return bytes;
 }
 
@@ -187,6 +207,9 @@ struct Instruction {
     }
 };
 
+/// Index of each address in the transaction keys array
+using AddressIndex = std::unordered_map<Address, uint8_t, AddressHash>;
+
 // A compiled instruction
 struct CompiledInstruction {
     // Index into the transaction keys array indicating the program account that executes this instruction
@@ -197,19 +220,24 @@ struct CompiledInstruction {
     // The program input data
     Data data;
 
-    // Reference to the address vector
-    const std::vector<Address>& addresses;
-
-    /// Supplied address vector is expected to contain all addresses and programId from the instruction; they are replaced by index into the address vector.
-    CompiledInstruction(const Instruction& instruction, const std::vector<Address>& addresses): addresses(addresses) {
-        programIdIndex = findAccount(instruction.programId);
+    /// Supplied address index is expected to contain all addresses and programId from the instruction; they are replaced by index into the address vector.
+    CompiledInstruction(const Instruction& instruction, const AddressIndex& index) {
+        programIdIndex = findAccount(index, instruction.programId);
+        accounts.reserve(instruction.accounts.size());
         for (auto& account: instruction.accounts) {
-            accounts.push_back(findAccount(account.account));
+            accounts.push_back(findAccount(index, account.account));
         }
         data = instruction.data;
     }
 
-    uint8_t findAccount(const Address& address);
+    /// Same, with the address vector.
+    CompiledInstruction(const Instruction& instruction, const std::vector<Address>& addresses)
+        : CompiledInstruction(instruction, indexAddresses(addresses)) {}
+
+    /// Builds the index of an address vector; throws if there are more addresses than an index byte can address.
+    static AddressIndex indexAddresses(const std::vector<Address>& addresses);
+
+    static uint8_t findAccount(const AddressIndex& index, const Address& address);
 };
 
 class Hash {
@@ -253,11 +281,43 @@ struct MessageHeader {
     uint8_t numCreditOnlyUnsignedAccounts = 0;
 };
 
+// https://docs.solana.com/developing/lookup-tables
+enum class MessageVersion: uint8_t {
+    // Message with all the account keys inline
+    Legacy,
+    // Versioned message, which can load accounts from address lookup tables
+    V0,
+};
+
+// An on-chain address lookup table, with the addresses it holds
+struct AddressLookupTable {
+    // The account of the table
+    Address account;
+    // The addresses in the table, at most 256
+    std::vector<Address> addresses;
+
+    AddressLookupTable(const Address& account, const std::vector<Address>& addresses): account(account), addresses(addresses) {}
+};
+
+// The accounts a versioned message loads from an address lookup table
+struct MessageAddressTableLookup {
+    // The account of the table
+    Address accountKey;
+    // Indices in the table of the loaded writable accounts
+    std::vector<uint8_t> writableIndexes;
+    // Indices in the table of the loaded read-only accounts
+    std::vector<uint8_t> readonlyIndexes;
+
+    MessageAddressTableLookup(const Address& accountKey): accountKey(accountKey) {}
+};
+
 class Message {
   public:
+    // The format of the message
+    MessageVersion version = MessageVersion::Legacy;
     // The message header, identifying signed and credit-only `accountKeys`
     MessageHeader header;
-    // All the account keys used by this transaction
+    // All the account keys used by this transaction, except those loaded from lookup tables
     std::vector<Address> accountKeys;
     // The id of a recent ledger entry.
     Hash recentBlockhash;
@@ -265,11 +325,15 @@ class Message {
     // transaction if all succeed.
     std::vector<Instruction> instructions;
 
-    // three buckets of different account types
-    std::vector<Address> signedAccounts;
-    std::vector<Address> unsignedAccounts;
-    std::vector<Address> readOnlyAccounts;
+    // all the accounts used by the instructions, in order of first use, with their combined flags
+    std::vector<AccountMeta> accounts;
+    // position of each account in `accounts`
+    std::unordered_map<Address, size_t, AddressHash> accountPositions;
     std::vector<CompiledInstruction> compiledInstructions;
+    // V0 only: the lookup tables used, and the accounts loaded from them, writable first,
+    // indexed after `accountKeys` by the compiled instructions
+    std::vector<MessageAddressTableLookup> addressTableLookups;
+    std::vector<Address> loadedAddresses;
 
     Message() : recentBlockhash(NULL_ID_ADDRESS) {};
 
@@ -282,10 +346,14 @@ class Message {
             compileInstructions();
         }
 
-    // add an acount, to the corresponding bucket
+    // add an account, or combine its flags with those of an earlier use: signer if signer in any use,
+    // writable if writable in any use
     void addAccount(const AccountMeta& account);
-    // compile the single accounts lists from the buckets
-    void compileAccounts();
+    // compile the account keys from the accounts: signers in order of first signing use, so that the fee payer
+    // stays first, then writable, then read-only accounts, each in order of first use.
+    // Accounts found in one of the lookup tables are loaded from it instead, unless they are signers or programs;
+    // compiling with lookup tables makes the message a V0 message.
+    void compileAccounts(const std::vector<AddressLookupTable>& lookupTables = {});
     // compile the instructions; replace instruction accounts with indices
     void compileInstructions();
 
@@ -431,6 +499,22 @@ class Message {
         this->instructions.push_back(transferInstruction);
         compileAccounts();
     }
+
+    // This constructor creates a single-signer message with a System Transfer instruction per recipient.
+    // With lookup tables, it is a V0 message loading the recipients found in the tables.
+    Message(const Address& from, const std::vector<std::pair<Address, uint64_t>>& transfers, Hash recentBlockhash,
+            const std::vector<AddressLookupTable>& lookupTables = {})
+        : version(lookupTables.empty() ? MessageVersion::Legacy : MessageVersion::V0)
+        , recentBlockhash(recentBlockhash) {
+        instructions.reserve(transfers.size());
+        for (const auto& transfer: transfers) {
+            instructions.emplace_back(std::vector<AccountMeta>{
+                AccountMeta(from, true, false),
+                AccountMeta(transfer.first, false, false),
+            }, transfer.second);
+        }
+        compileAccounts(lookupTables);
+    }
 };
 
 class Transaction {
@@ -450,6 +534,15 @@ class Transaction {
         this->signatures.resize(1, Signature(defaultSignature));
     }
 
+    /// Splits transfers from a single sender into as few transfer transactions as possible,
+    /// each fitting in a packet, keeping the order of the transfers.
+    /// With lookup tables, the transactions are V0 and load the recipients found in the tables,
+    /// so each takes one byte instead of a 32-byte key.
+    static std::vector<Transaction> batchTransfers(const Address& from,
+                                                   const std::vector<std::pair<Address, uint64_t>>& transfers,
+                                                   Hash recentBlockhash,
+                                                   const std::vector<AddressLookupTable>& lookupTables = {});
+
   public:
     std::string serialize() const;
     std::vector<uint8_t> messageData() const;
@@ -457,6 +550,8 @@ class Transaction {
 
   private:
     TW::Data defaultSignature = TW::Data(64);
+
+    void appendMessageData(Data& buffer) const;
 };
 
 } // namespace TW::Solana
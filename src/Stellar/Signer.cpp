@@ -25,7 +25,7 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
 
 std::string Signer::sign() const noexcept {
 
-    auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto key = PrivateKey(input.private_key());
     auto account = Address(input.account());
     auto encoded = encode(input);
 
@@ -10,8 +10,10 @@
 
 #include <boost/crc.hpp>  // for boost::crc_32_type
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <sstream>
 
@@ -166,10 +168,11 @@ Data Slice::hash() const {
 }
 
 
-Cell::Cell(const Cell& from) : _cells(from._cells), _slice(from._slice) {}
+Cell::Cell(const Cell& from) : _cells(from._cells), _slice(from._slice), _hash(from._hash), _depth(from._depth) {}
 
 void Cell::setSlice(Slice const& slice) {
     _slice = slice;
+    resetHash();
 }
 
 void Cell::setSliceBytes(const Data& data) {
@@ -192,6 +195,12 @@ void Cell::addCell(std::shared_ptr<Cell> const& cell) {
         throw std::runtime_error("too many cells");
     }
     _cells.push_back(cell);
+    resetHash();
+}
+
+void Cell::resetHash() {
+    _hash.clear();
+    _depth = 0;
 }
 
 std::string Cell::toString() const {
@@ -215,8 +224,12 @@ std::string Cell::toString() const {
 }
 
 Data Cell::hash() const {
+    if (!_hash.empty()) {
+        return _hash;
+    }
     // Need to copy data together into a contiguous area
     Data hashData;
+    hashData.reserve(2 + _slice.size() + cellCount() * (2 + 32));
     // number of children
     hashData.push_back(static_cast<byte>(cellCount()));
     // number of hex digits
@@ -226,51 +239,135 @@ Data Cell::hash() const {
     if (_slice.size() > 0) {
         append(hashData, _slice.data());
     }
-    // children
-    if (cellCount() > 0) {
-        for (auto i = _cells.begin(), n = _cells.end(); i != n; ++i) {
-            hashData.push_back(0);
-            hashData.push_back(0);
-        }
-        for (auto i = _cells.begin(), n = _cells.end(); i != n; ++i) {
-            auto childHash = i->get()->hash();
-            append(hashData, childHash);
-        }
+    // children: depths, then hashes; each child is hashed only once, its hash is cached
+    uint16_t depth = 0;
+    for (const auto& c: _cells) {
+        const auto childDepth = c->depth();
+        hashData.push_back(static_cast<byte>(childDepth >> 8));
+        hashData.push_back(static_cast<byte>(childDepth));
+        depth = std::max(depth, static_cast<uint16_t>(childDepth + 1));
+    }
+    for (const auto& c: _cells) {
+        append(hashData, c->hash());
     }
     // compute hash
-    return Hash::sha256(hashData);
+    _hash = Hash::sha256(hashData);
+    _depth = depth;
+    return _hash;
+}
+
+uint16_t Cell::depth() const {
+    hash();
+    return _depth;
+}
+
+namespace {
+
+/// Cells of a bag of cells: deduplicated by hash, in topological order (root first)
+struct CellList {
+    std::vector<const Cell*> cells;
+    /// Indices of the references of each cell
+    std::vector<std::vector<size_t>> refs;
+    /// Cells referenced more than once
+    std::vector<bool> shouldCache;
+};
+
+/// Collects the distinct cells of the tree, in discovery order; returns the index of `cell`
+size_t collectCells(const Cell& cell, std::map<Data, size_t>& indices, CellList& list) {
+    const auto [entry, inserted] = indices.emplace(cell.hash(), list.cells.size());
+    if (!inserted) {
+        return entry->second;
+    }
+    const auto index = entry->second;
+    list.cells.push_back(&cell);
+    list.refs.emplace_back();
+    for (const auto& c: cell.getCells()) {
+        const auto ref = collectCells(*c, indices, list);
+        list.refs[index].push_back(ref);
+    }
+    return index;
+}
+
+CellList buildCellList(const Cell& root) {
+    std::map<Data, size_t> indices;
+    CellList discovered;
+    collectCells(root, indices, discovered);
+    const auto count = discovered.cells.size();
+
+    std::vector<size_t> refCount(count, 0);
+    for (const auto& refs: discovered.refs) {
+        for (auto r: refs) { ++refCount[r]; }
+    }
+
+    // Kahn's algorithm: a cell is placed once all the cells referencing it are placed
+    CellList list;
+    auto inDegree = refCount;
+    std::vector<size_t> order;
+    std::vector<size_t> position(count);
+    order.reserve(count);
+    order.push_back(0);
+    for (size_t i = 0; i < order.size(); ++i) {
+        const auto cell = order[i];
+        position[cell] = i;
+        for (auto r: discovered.refs[cell]) {
+            if (--inDegree[r] == 0) {
+                order.push_back(r);
+            }
+        }
+    }
+    assert(order.size() == count);
+
+    for (auto cell: order) {
+        list.cells.push_back(discovered.cells[cell]);
+        std::vector<size_t> refs;
+        refs.reserve(discovered.refs[cell].size());
+        for (auto r: discovered.refs[cell]) { refs.push_back(position[r]); }
+        list.refs.push_back(std::move(refs));
+        list.shouldCache.push_back(refCount[cell] > 1);
+    }
+    return list;
 }
 
-Cell::SerializationInfo Cell::getSerializationInfo(SerializationMode mode) const {
-    SerializationInfo info = SerializationInfo();
-    size_t rawDataSize = serializedOwnSize();
-    for (auto c: _cells) {
+Cell::SerializationInfo getSerializationInfo(const CellList& list, Cell::SerializationMode mode) {
+    if (mode & (Cell::SerializationMode::WithTopHash | Cell::SerializationMode::WithIntHashes)) {
+        throw std::invalid_argument("Cell::serialize: Mode " + std::to_string((int)mode) + " not supported");
+    }
+    Cell::SerializationInfo info = Cell::SerializationInfo();
+    const auto cellCount = list.cells.size();
+    size_t rawDataSize = 0;
+    size_t intRefs = 0;
+    for (const auto* c: list.cells) {
         rawDataSize += c->serializedOwnSize();
+        intRefs += c->cellCount();
     }
-    int intRefs = (int)cellCount();
-    uint8_t refSize = 1;
-    while (cellCount() >= ((size_t)1 << (refSize * 8))) { ++refSize; }
-    assert(refSize >= 1 && refSize <= 8);
-    size_t hashes = 0;
-    size_t dataBytesAdj = rawDataSize + (size_t)intRefs * refSize + hashes;
-    size_t maxOffset = (mode & SerializationMode::WithCacheBits) ? dataBytesAdj * 2 : dataBytesAdj;
+    int refSize = 1;
+    while (cellCount >= ((size_t)1 << (refSize * 8))) { ++refSize; }
+    size_t dataBytesAdj = rawDataSize + intRefs * refSize;
+    size_t maxOffset = (mode & Cell::SerializationMode::WithCacheBits) ? dataBytesAdj * 2 : dataBytesAdj;
     int offsetSize = 0;
     while (maxOffset >= (1ULL << (offsetSize * 8))) { ++offsetSize; }
-    if (refSize > 4 || offsetSize > 8) { return info; }
+    if (refSize > 4 || offsetSize > 8) {
+        throw std::invalid_argument("Cell::serialize: too many cells");
+    }
 
     info.refByteSize = refSize;
-    info.offsetByteSize = 1;
+    info.offsetByteSize = offsetSize;
     info.rootCount = 1;
-    info.cellCount = info.rootCount + (int)cellCount();  // including self/roots
-    info.hasCrc32c = mode & SerializationMode::WithCRC32C;
+    info.cellCount = (int)cellCount;  // including roots
+    info.absentCount = 0;
+    info.hasIndex = mode & Cell::SerializationMode::WithIndex;
+    info.hasCrc32c = mode & Cell::SerializationMode::WithCRC32C;
+    info.hasCacheBits = mode & Cell::SerializationMode::WithCacheBits;
+    if (info.hasCacheBits && !info.hasIndex) {
+        throw std::invalid_argument("Cell::serialize: WithCacheBits requires WithIndex");
+    }
     int crcSize = info.hasCrc32c ? 4 : 0;
-    int rootCount = 0;
     unsigned long rootsOffset = 4 + 1 + 1 + 3 * info.refByteSize + info.offsetByteSize;
-    unsigned long indexOffset = rootsOffset + rootCount * info.refByteSize;
+    unsigned long indexOffset = rootsOffset + info.rootCount * info.refByteSize;
     unsigned long dataOffset = indexOffset;
-    //if (info.has_index) {
-        //info.data_offset += (long long)cell_count * info.offset_byte_size;
-    //}
+    if (info.hasIndex) {
+        dataOffset += cellCount * info.offsetByteSize;
+    }
     // Magic num idx 68ff65f3  idxCrc32c acc3a728  generic b5ee9c72
     info.magic = parse_hex("b5ee9c72");
     info.dataSize = dataBytesAdj;
@@ -278,86 +375,75 @@ Cell::SerializationInfo Cell::getSerializationInfo(SerializationMode mode) const
     return info;
 }
 
+/// Append an unsigned value, big endian, on the given number of bytes
+void storeUint(Data& data_inout, uint64_t value, int bytes) {
+    for (int i = bytes - 1; i >= 0; --i) {
+        data_inout.push_back(static_cast<byte>(value >> (8 * i)));
+    }
+}
+
+} // namespace
+
 size_t Cell::serializedOwnSize(bool withHashes) const {
     if (withHashes) { throw std::invalid_argument("Cell::serializedOwnSize: WithHashes not supported"); }
     return _slice.size() + 2; // bits/8 rounded up + 2
 }
 
 size_t Cell::serializedSize(SerializationMode mode) const {
-    auto info = getSerializationInfo(mode);
-    size_t ss = 0;
-    ss += 4; // magic
-    ss += 5; // byte1, offsetByteSize, cellCount, rootCount, 
-    ss += info.offsetByteSize; // dataSize
-    ss += info.rootCount; // roots
-
-    ss += serializedOwnSize(false);
-    ss += cellCount(); // cell refs
-
-    // child cells
-    for(auto c: _cells) {
-        ss += c->serializedOwnSize(false);
-    }
-
-    if (mode & SerializationMode::WithCRC32C) {
-        ss += 4;
-    }
-    return ss;
+    return getSerializationInfo(buildCellList(*this), mode).totalSize;
 }
 
-void Cell::serializeOwn(TW::Data& data_inout, bool withHashes) {
+void Cell::serializeOwn(TW::Data& data_inout, bool withHashes) const {
     if (withHashes) { throw std::invalid_argument("Cell::serializedOwnSize: WithHashes not supported"); }
-    //auto info = getSerializationInfo(mode);
     // slice
     data_inout.push_back((byte)cellCount());
     data_inout.push_back(d2(_slice.sizeBits()));
     append(data_inout, _slice.data());
 }
 
-void Cell::serialize(TW::Data& data_inout, SerializationMode mode) {
-    if (mode != SerializationMode::None && mode != SerializationMode::WithCRC32C) {
-        throw std::invalid_argument("Cell::serialize: Mode " + std::to_string((int)mode) + " not supported");
-    }
+void Cell::serialize(TW::Data& data_inout, SerializationMode mode) const {
+    const auto list = buildCellList(*this);
+    const auto info = getSerializationInfo(list, mode);
     // save current start position
     size_t startIdx = data_inout.size();
-    auto info = getSerializationInfo(mode);
+    data_inout.reserve(startIdx + info.totalSize);
 
     // magic
     append(data_inout, info.magic);
 
     byte byte1 = 0;
-    //if (info.hasIndex) { byte |= 1 << 7; }
+    if (info.hasIndex) { byte1 |= 1 << 7; }
     if (info.hasCrc32c) { byte1 |= 1 << 6; }
-    //if (info.has_cache_bits) { byte |= 1 << 5; }
+    if (info.hasCacheBits) { byte1 |= 1 << 5; }
     // 3, 4 - flags
-    if (info.refByteSize < 1 || info.refByteSize > 7) {
-        //cerr << info.refByteSize << endl;
-        return;
-    }
     byte1 |= static_cast<byte>(info.refByteSize);
     data_inout.push_back(byte1);
     data_inout.push_back((byte)info.offsetByteSize);
-    data_inout.push_back((byte)info.cellCount);
-    data_inout.push_back((byte)info.rootCount);
-    data_inout.push_back(0);
-    data_inout.push_back((byte)info.dataSize); // offset
-    data_inout.push_back(0); // roots
-
-    // own cell (slice)
-    serializeOwn(data_inout, false);
-    // cell refs?
-    uint8_t cidx = 0;
-    for(auto c: _cells) {
-        ++cidx;
-        data_inout.push_back(cidx);
+    storeUint(data_inout, info.cellCount, info.refByteSize);
+    storeUint(data_inout, info.rootCount, info.refByteSize);
+    storeUint(data_inout, info.absentCount, info.refByteSize);
+    storeUint(data_inout, info.dataSize, info.offsetByteSize);
+    storeUint(data_inout, 0, info.refByteSize); // root, always first
+
+    if (info.hasIndex) {
+        // end offset of each cell, with the cache bit in the lowest bit
+        uint64_t offset = 0;
+        for (size_t i = 0; i < list.cells.size(); ++i) {
+            offset += list.cells[i]->serializedOwnSize() + list.refs[i].size() * info.refByteSize;
+            const auto entry = info.hasCacheBits ? offset * 2 + (list.shouldCache[i] ? 1 : 0) : offset;
+            storeUint(data_inout, entry, info.offsetByteSize);
+        }
     }
 
-    // child cells
-    for(auto c: _cells) {
-        c->serializeOwn(data_inout, false);
+    // cells, each followed by its references
+    for (size_t i = 0; i < list.cells.size(); ++i) {
+        list.cells[i]->serializeOwn(data_inout);
+        for (auto r: list.refs[i]) {
+            storeUint(data_inout, r, info.refByteSize);
+        }
     }
 
-    if (mode & SerializationMode::WithCRC32C) {
+    if (info.hasCrc32c) {
         // CRC32-C, of the serialized data so far
         uint32_t crc = computeCrc(data_inout.data() + startIdx, data_inout.size() - startIdx);
         data_inout.push_back(crc & 0x000000FF);
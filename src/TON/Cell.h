@@ -64,17 +64,14 @@ public:
         std::vector<uint8_t> magic;
         int rootCount;
         int cellCount;
-        //int absent_count;
+        int absentCount;
         int refByteSize;
         int offsetByteSize;
-        //bool valid;
-        //bool has_index;
-        //bool has_roots{false};
+        bool hasIndex;
         bool hasCrc32c;
-        //bool has_cache_bits;
+        bool hasCacheBits;
         unsigned long dataSize;
         unsigned long totalSize;
-        //unsigned long rootsOffset, dataOffset, indexOffset
     };
 
 public:
@@ -92,27 +89,36 @@ public:
     Slice const& getSlice() const { return _slice; }
     const std::vector<std::shared_ptr<Cell>>& getCells() const { return _cells; }
     std::string toString() const;
+    /// Representation hash.  Computed once and cached, like the hashes of the children, so a cell referenced
+    /// from several parents is hashed only once.  Children are expected to be complete before they are added.
     Data hash() const;
+    /// Depth of the tree below this cell: 0 without children, otherwise 1 + the largest child depth
+    uint16_t depth() const;
     /// Serialized size of this cell only, without children
     size_t serializedOwnSize(bool withHashes = false) const;
     /// Serialized size, including children
     size_t serializedSize(SerializationMode mode = SerializationMode::None) const;
     /// Serialize this cell only, without children
-    void serializeOwn(TW::Data& data_inout, bool withHashes = false);
-    /// Serialize this cell, including children
-    void serialize(TW::Data& data_inout, SerializationMode mode = SerializationMode::None);
+    void serializeOwn(TW::Data& data_inout, bool withHashes = false) const;
+    /// Serialize this cell, including children, as a bag of cells.  Identical subtrees are stored once,
+    /// and cells are ordered so that references always point forward.
+    /// WithIndex, WithCRC32C and WithCacheBits are supported.
+    void serialize(TW::Data& data_inout, SerializationMode mode = SerializationMode::None) const;
     static const size_t max_cells = 4;
     /// second byte in length
     static byte d2(size_t bits);
 private:
     /// Compute 4-byte CRC32-C checksum, used in serialization
     static uint32_t computeCrc(const byte* data, size_t len);
-    // Prepare serialization properties
-    SerializationInfo getSerializationInfo(SerializationMode mode = SerializationMode::None) const;
+    /// Forget the cached hash, after a change of this cell
+    void resetHash();
 
 private:
     std::vector<std::shared_ptr<Cell>> _cells;
     Slice _slice;
+    /// Cached representation hash (empty when not computed yet) and depth
+    mutable Data _hash;
+    mutable uint16_t _depth = 0;
 };
 
 } // namespace TW::TON
@@ -28,7 +28,7 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput &input) noexcept {
     // ...
 
     auto protoOutput = Proto::SigningOutput();
-    auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto key = PrivateKey(input.private_key());
     auto pubkey = key.getPublicKey(TWPublicKeyTypeED25519);
     auto from = Address(pubkey);
 
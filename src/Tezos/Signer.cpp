@@ -24,7 +24,7 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
     }
 
     auto signer = Signer();
-    PrivateKey key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    PrivateKey key = PrivateKey(input.private_key());
     Data encoded = signer.signOperationList(key, operationList);
 
     auto output = Proto::SigningOutput();
@@ -46,11 +46,8 @@ Data Signer::signOperationList(const PrivateKey& privateKey, const OperationList
 }
 
 Data Signer::signData(const PrivateKey& privateKey, const Data& data) {
-    Data watermarkedData = Data();
-    watermarkedData.push_back(0x03);
-    append(watermarkedData, data);
-
-    Data hash = Hash::blake2b(watermarkedData, 32);
+    const Data watermark = {0x03};
+    Data hash = Hash::Blake2b(32).update(watermark).update(data).final();
     Data signature = privateKey.sign(hash, TWCurve::TWCurveED25519);
 
     Data signedData = Data();
@@ -14,7 +14,7 @@ using namespace TW::Theta;
 using RLP = Ethereum::RLP;
 
 Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
-    auto pkFrom = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    auto pkFrom = PrivateKey(input.private_key());
     auto from = Ethereum::Address(pkFrom.getPublicKey(TWPublicKeyTypeSECP256k1Extended));
 
     auto transaction = Transaction(
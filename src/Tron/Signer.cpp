@@ -312,9 +312,9 @@ Proto::SigningOutput Signer::sign(const Proto::SigningInput& input) noexcept {
     output.set_ref_block_hash(internal.raw_data().ref_block_hash());
 
     const auto serialized = internal.raw_data().SerializeAsString();
-    const auto hash = Hash::sha256(Data(serialized.begin(), serialized.end()));
+    const auto hash = Hash::sha256(serialized);
 
-    const auto key = PrivateKey(Data(input.private_key().begin(), input.private_key().end()));
+    const auto key = PrivateKey(input.private_key());
     const auto signature = key.sign(hash, TWCurveSECP256k1);
 
     const auto json = transactionJSON(internal, hash, signature).dump();
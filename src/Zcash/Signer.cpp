@@ -15,13 +15,13 @@ using namespace TW;
 using namespace TW::Zcash;
 
 TransactionPlan Signer::plan(const SigningInput& input) noexcept {
-    auto signer = Bitcoin::TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = Bitcoin::TransactionSigner<Transaction, TransactionBuilder>(input);
     return signer.plan.proto();
 }
 
 SigningOutput Signer::sign(const SigningInput& input) noexcept {
     SigningOutput output;
-    auto signer = Bitcoin::TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = Bitcoin::TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
     if (!result) {
         output.set_error(result.error());
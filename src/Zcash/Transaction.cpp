@@ -31,109 +31,106 @@ const std::array<byte, 4> Zcash::BlossomBranchID = {0x60, 0x0e, 0xb4, 0x2b};
 
 Data Transaction::getPreImage(const Bitcoin::Script& scriptCode, size_t index, enum TWBitcoinSigHashType hashType,
                               uint64_t amount) const {
+    auto data = Data{};
+    auto sink = DataSink(data);
+    encodePreImage(scriptCode, index, hashType, amount, sink);
+    return data;
+}
+
+void Transaction::encodePreImage(const Bitcoin::Script& scriptCode, size_t index, enum TWBitcoinSigHashType hashType,
+                                 uint64_t amount, ByteSink& sink) const {
     assert(index < inputs.size());
 
-    auto data = Data{};
+    const auto zeroHash = std::array<byte, 32>{};
 
     // header
-    encode32LE(version, data);
+    encode32LE(version, sink);
 
     // nVersionGroupId
-    encode32LE(versionGroupId, data);
+    encode32LE(versionGroupId, sink);
 
     // Input prevouts (none/all, depending on flags)
     if ((hashType & TWBitcoinSigHashTypeAnyoneCanPay) == 0) {
-        auto hashPrevouts = getPrevoutHash();
-        std::copy(std::begin(hashPrevouts), std::end(hashPrevouts), std::back_inserter(data));
+        sink.write(getPrevoutHash());
     } else {
-        std::fill_n(back_inserter(data), 32, 0);
+        sink.write(zeroHash);
     }
 
     // Input nSequence (none/all, depending on flags)
     if ((hashType & TWBitcoinSigHashTypeAnyoneCanPay) == 0 &&
         !Bitcoin::hashTypeIsSingle(hashType) && !Bitcoin::hashTypeIsNone(hashType)) {
-        auto hashSequence = getSequenceHash();
-        std::copy(std::begin(hashSequence), std::end(hashSequence), std::back_inserter(data));
+        sink.write(getSequenceHash());
     } else {
-        std::fill_n(back_inserter(data), 32, 0);
+        sink.write(zeroHash);
     }
 
     // Outputs (none/one/all, depending on flags)
     if (!Bitcoin::hashTypeIsSingle(hashType) && !Bitcoin::hashTypeIsNone(hashType)) {
-        auto hashOutputs = getOutputsHash();
-        copy(begin(hashOutputs), end(hashOutputs), back_inserter(data));
+        sink.write(getOutputsHash());
     } else if (Bitcoin::hashTypeIsSingle(hashType) && index < outputs.size()) {
         auto outputData = Data{};
         outputs[index].encode(outputData);
-        auto hashOutputs =
-            TW::Hash::blake2b(outputData, outputData.size(), outputsHashPersonalization);
-        copy(begin(hashOutputs), end(hashOutputs), back_inserter(data));
+        sink.write(TW::Hash::blake2b(outputData, outputData.size(), outputsHashPersonalization));
     } else {
-        fill_n(back_inserter(data), 32, 0);
+        sink.write(zeroHash);
     }
 
     // JoinSplits
-    auto hashJoinSplits = getJoinSplitsHash();
-    data.insert(std::end(data), std::begin(hashJoinSplits), std::end(hashJoinSplits));
+    sink.write(getJoinSplitsHash());
 
     // ShieldedSpends
-    auto hashShieldedSpends = getShieldedSpendsHash();
-    data.insert(std::end(data), std::begin(hashShieldedSpends), std::end(hashShieldedSpends));
+    sink.write(getShieldedSpendsHash());
 
     // ShieldedOutputs
-    auto hashShieldedOutputs = getShieldedOutputsHash();
-    data.insert(std::end(data), std::begin(hashShieldedOutputs), std::end(hashShieldedOutputs));
+    sink.write(getShieldedOutputsHash());
 
     // Locktime
-    encode32LE(lockTime, data);
+    encode32LE(lockTime, sink);
 
     // ExpiryHeight
-    encode32LE(expiryHeight, data);
+    encode32LE(expiryHeight, sink);
 
     // ValueBalance
-    encode64LE(valueBalance, data);
+    encode64LE(valueBalance, sink);
 
     // Sighash type
-    encode32LE(hashType, data);
+    encode32LE(hashType, sink);
 
     // The input being signed (replacing the scriptSig with scriptCode + amount)
     // The prevout may already be contained in hashPrevout, and the nSequence
     // may already be contain in hashSequence.
-    reinterpret_cast<const Bitcoin::OutPoint&>(inputs[index].previousOutput).encode(data);
-    scriptCode.encode(data);
+    reinterpret_cast<const Bitcoin::OutPoint&>(inputs[index].previousOutput).encode(sink);
+    scriptCode.encode(sink);
 
-    encode64LE(amount, data);
-    encode32LE(inputs[index].sequence, data);
-
-    return data;
+    encode64LE(amount, sink);
+    encode32LE(inputs[index].sequence, sink);
 }
 
 Data Transaction::getPrevoutHash() const {
-    auto data = Data{};
+    auto hasher = Hash::Blake2b(32, prevoutsHashPersonalization);
+    auto sink = HashSink<Hash::Blake2b>(hasher);
     for (auto& input : inputs) {
-        auto& outpoint = input.previousOutput;
-        outpoint.encode(data);
+        input.previousOutput.encode(sink);
     }
-    auto hash = TW::Hash::blake2b(data, 32, prevoutsHashPersonalization);
-    return hash;
+    return hasher.final();
 }
 
 Data Transaction::getSequenceHash() const {
-    auto data = Data{};
+    auto hasher = Hash::Blake2b(32, sequenceHashPersonalization);
+    auto sink = HashSink<Hash::Blake2b>(hasher);
     for (auto& input : inputs) {
-        encode32LE(input.sequence, data);
+        encode32LE(input.sequence, sink);
     }
-    auto hash = TW::Hash::blake2b(data, 32, sequenceHashPersonalization);
-    return hash;
+    return hasher.final();
 }
 
 Data Transaction::getOutputsHash() const {
-    auto data = Data{};
+    auto hasher = Hash::Blake2b(32, outputsHashPersonalization);
+    auto sink = HashSink<Hash::Blake2b>(hasher);
     for (auto& output : outputs) {
-        output.encode(data);
+        output.encode(sink);
     }
-    auto hash = TW::Hash::blake2b(data, 32, outputsHashPersonalization);
-    return hash;
+    return hasher.final();
 }
 
 Data Transaction::getJoinSplitsHash() const {
@@ -187,9 +184,10 @@ Data Transaction::getSignatureHash(const Bitcoin::Script& scriptCode, size_t ind
     std::copy(sigHashPersonalization.begin(), sigHashPersonalization.begin() + 12,
               std::back_inserter(personalization));
     std::copy(branchId.begin(), branchId.end(), std::back_inserter(personalization));
-    auto preimage = getPreImage(scriptCode, index, hashType, amount);
-    auto hash = Hash::blake2b(preimage, 32, personalization);
-    return hash;
+    auto hasher = Hash::Blake2b(32, personalization);
+    auto sink = HashSink<Hash::Blake2b>(hasher);
+    encodePreImage(scriptCode, index, hashType, amount, sink);
+    return hasher.final();
 }
 
 Bitcoin::Proto::Transaction Transaction::proto() const {
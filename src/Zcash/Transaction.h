@@ -53,6 +53,9 @@ struct Transaction {
     /// Generates the signature pre-image.
     Data getPreImage(const Bitcoin::Script& scriptCode, size_t index,
                      enum TWBitcoinSigHashType hashType, uint64_t amount) const;
+    /// Writes the signature pre-image into the provided sink.
+    void encodePreImage(const Bitcoin::Script& scriptCode, size_t index,
+                        enum TWBitcoinSigHashType hashType, uint64_t amount, ByteSink& sink) const;
     Data getPrevoutHash() const;
     Data getSequenceHash() const;
     Data getOutputsHash() const;
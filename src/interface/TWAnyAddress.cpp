@@ -23,6 +23,7 @@
 #include "../Elrond/Address.h"
 #include "../NEAR/Address.h"
 
+#include "../BinaryCoding.h"
 #include "../Coin.h"
 #include "../HexCoding.h"
 
@@ -42,6 +43,39 @@ bool TWAnyAddressIsValid(TWString* _Nonnull string, enum TWCoinType coin) {
     return TW::validateAddress(coin, address);
 }
 
+TWData* _Nullable TWAnyAddressValidateBatch(TWData* _Nonnull addresses, enum TWCoinType coin, bool normalize, uint32_t threads) {
+    const auto& input = *reinterpret_cast<const Data*>(addresses);
+    // addresses are located in the input, and read from it by the validation
+    const auto ranges = decodeLengthPrefixedRanges(input);
+    if (!std::get<0>(ranges)) {
+        return nullptr;
+    }
+
+    const auto results = TW::validateAddresses(coin, input, std::get<1>(ranges), normalize, threads);
+
+    // validity bits, then the normalized forms
+    size_t outputSize = (results.size() + 7) / 8;
+    if (normalize) {
+        for (const auto& result : results) {
+            outputSize += 4 + result.normalized.size();
+        }
+    }
+    Data output;
+    output.reserve(outputSize);
+    output.resize((results.size() + 7) / 8);
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (results[i].valid) {
+            output[i / 8] |= static_cast<byte>(1 << (i % 8));
+        }
+    }
+    if (normalize) {
+        for (const auto& result : results) {
+            encodeLengthPrefixed(result.normalized, output);
+        }
+    }
+    return TWDataCreateWithBytes(output.data(), output.size());
+}
+
 struct TWAnyAddress* _Nullable TWAnyAddressCreateWithString(TWString* _Nonnull string,
                                                             enum TWCoinType coin) {
     const auto& address = *reinterpret_cast<const std::string*>(string);
@@ -6,6 +6,7 @@
 
 #include <TrustWalletCore/TWAnySigner.h>
 
+#include "BinaryCoding.h"
 #include "Coin.h"
 
 using namespace TW;
@@ -14,7 +15,29 @@ TWData* _Nonnull TWAnySignerSign(TWData* _Nonnull data, enum TWCoinType coin) {
     const Data& dataIn = *(reinterpret_cast<const Data*>(data));
     Data dataOut;
     TW::anyCoinSign(coin, dataIn, dataOut);
-    return TWDataCreateWithBytes(dataOut.data(), dataOut.size());
+    // TWData is a Data, the buffer is handed over instead of copied
+    return new Data(std::move(dataOut));
+}
+
+TWData* _Nullable TWAnySignerSignBatch(TWData* _Nonnull inputs, enum TWCoinType coin, uint32_t threads) {
+    const Data& dataIn = *(reinterpret_cast<const Data*>(inputs));
+    const auto decoded = decodeLengthPrefixed(dataIn);
+    if (!std::get<0>(decoded)) {
+        return nullptr;
+    }
+    std::vector<Data> outputs;
+    TW::anyCoinSignBatch(coin, std::get<1>(decoded), outputs, threads);
+
+    size_t size = 0;
+    for (const auto& output : outputs) {
+        size += 4 + output.size();
+    }
+    Data dataOut;
+    dataOut.reserve(size);
+    for (const auto& output : outputs) {
+        encodeLengthPrefixed(output, dataOut);
+    }
+    return new Data(std::move(dataOut));
 }
 
 TWString *_Nonnull TWAnySignerSignJSON(TWString *_Nonnull json, TWData *_Nonnull key, enum TWCoinType coin) {
@@ -31,5 +54,5 @@ TWData* _Nonnull TWAnySignerPlan(TWData* _Nonnull data, enum TWCoinType coin) {
     const Data& dataIn = *(reinterpret_cast<const Data*>(data));
     Data dataOut;
     TW::anyCoinPlan(coin, dataIn, dataOut);
-    return TWDataCreateWithBytes(dataOut.data(), dataOut.size());
+    return new Data(std::move(dataOut));
 }
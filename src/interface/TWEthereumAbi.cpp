@@ -40,7 +40,7 @@ bool TWEthereumAbiDecodeOutput(struct TWEthereumAbiFunction* _Nonnull func_in,
     assert(func_in != nullptr);
     Function& function = func_in->impl;
     assert(encoded != nullptr);
-    Data encData = data(TWDataBytes(encoded), TWDataSize(encoded));
+    const auto& encData = *reinterpret_cast<const Data*>(encoded);
 
     size_t offset = 0;
     return function.decodeOutput(encData, offset);
@@ -176,7 +176,7 @@ int TWEthereumAbiFunctionAddParamAddress(struct TWEthereumAbiFunction *_Nonnull
     Function& function = func_in->impl;
 
     assert(val != nullptr);
-    Data data = TW::data(TWDataBytes(val), TWDataSize(val));
+    const auto& data = *reinterpret_cast<const Data*>(val);
     auto param = std::make_shared<ParamAddress>(data);
     auto idx = function.addParam(param, isOutput);
     return idx;
@@ -186,7 +186,7 @@ int TWEthereumAbiFunctionAddParamBytes(struct TWEthereumAbiFunction *_Nonnull fu
     assert(func_in != nullptr);
     Function& function = func_in->impl;
 
-    Data data = TW::data(TWDataBytes(val), TWDataSize(val));
+    const auto& data = *reinterpret_cast<const Data*>(val);
     auto param = std::make_shared<ParamByteArray>(data);
     auto idx = function.addParam(param, isOutput);
     return idx;    
@@ -196,7 +196,7 @@ int TWEthereumAbiFunctionAddParamBytesFix(struct TWEthereumAbiFunction *_Nonnull
     assert(func_in != nullptr);
     Function& function = func_in->impl;
 
-    Data data = TW::data(TWDataBytes(val), TWDataSize(val));
+    const auto& data = *reinterpret_cast<const Data*>(val);
     auto param = std::make_shared<ParamByteArrayFix>(count, data);
     auto idx = function.addParam(param, isOutput);
     return idx;    
@@ -436,7 +436,7 @@ int TWEthereumAbiFunctionAddInArrayParamAddress(struct TWEthereumAbiFunction *_N
     Function& function = func_in->impl;
 
     assert(val != nullptr);
-    Data data = TW::data(TWDataBytes(val), TWDataSize(val));
+    const auto& data = *reinterpret_cast<const Data*>(val);
     return addInArrayParam(function, arrayIdx, std::make_shared<ParamAddress>(data));
 }
 
@@ -444,7 +444,7 @@ int TWEthereumAbiFunctionAddInArrayParamBytes(struct TWEthereumAbiFunction *_Non
     assert(func_in != nullptr);
     Function& function = func_in->impl;
 
-    Data data = TW::data(TWDataBytes(val), TWDataSize(val));
+    const auto& data = *reinterpret_cast<const Data*>(val);
     return addInArrayParam(function, arrayIdx, std::make_shared<ParamByteArray>(data));
 }
 
@@ -452,6 +452,6 @@ int TWEthereumAbiFunctionAddInArrayParamBytesFix(struct TWEthereumAbiFunction *_
     assert(func_in != nullptr);
     Function& function = func_in->impl;
 
-    Data data = TW::data(TWDataBytes(val), TWDataSize(val));
+    const auto& data = *reinterpret_cast<const Data*>(val);
     return addInArrayParam(function, arrayIdx, std::make_shared<ParamByteArrayFix>(count, data));
 }
@@ -0,0 +1,45 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include <TrustWalletCore/TWEthereumAbiTypedData.h>
+
+#include "Ethereum/ABI.h"
+#include "Data.h"
+
+#include <cassert>
+
+using namespace TW;
+using namespace TW::Ethereum::ABI;
+
+struct TWEthereumAbiTypedData* _Nullable TWEthereumAbiTypedDataCreate(TWString* _Nonnull typesJson, TWString* _Nonnull domainJson) {
+    try {
+        return new TWEthereumAbiTypedData{TypedData(TWStringUTF8Bytes(typesJson), TWStringUTF8Bytes(domainJson))};
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void TWEthereumAbiTypedDataDelete(struct TWEthereumAbiTypedData* _Nonnull typedData) {
+    assert(typedData != nullptr);
+    delete typedData;
+}
+
+TWData* _Nonnull TWEthereumAbiTypedDataDomainSeparator(struct TWEthereumAbiTypedData* _Nonnull typedData) {
+    assert(typedData != nullptr);
+    const auto& separator = typedData->impl.domainSeparator();
+    return TWDataCreateWithBytes(separator.data(), separator.size());
+}
+
+TWData* _Nonnull TWEthereumAbiTypedDataHashMessage(struct TWEthereumAbiTypedData* _Nonnull typedData, TWString* _Nonnull primaryType, TWString* _Nonnull messageJson) {
+    assert(typedData != nullptr);
+    Data data;
+    try {
+        data = typedData->impl.hashMessageJson(TWStringUTF8Bytes(primaryType), TWStringUTF8Bytes(messageJson));
+    } catch (...) {
+        // return empty
+    }
+    return TWDataCreateWithBytes(data.data(), data.size());
+}
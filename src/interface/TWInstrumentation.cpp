@@ -0,0 +1,27 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include <TrustWalletCore/TWInstrumentation.h>
+
+#include "Instrumentation.h"
+
+using namespace TW;
+
+bool TWInstrumentationEnabled() {
+    return Instrumentation::enabled();
+}
+
+void TWInstrumentationSetSink(TWInstrumentationSink _Nullable sink, void* _Nullable context) {
+    Instrumentation::setSink(sink, context);
+}
+
+TWString* _Nonnull TWInstrumentationStats() {
+    return TWStringCreateWithUTF8Bytes(Instrumentation::statsJSON().c_str());
+}
+
+void TWInstrumentationReset() {
+    Instrumentation::reset();
+}
@@ -31,13 +31,11 @@ struct TWPrivateKey *TWPrivateKeyCreate() {
 }
 
 struct TWPrivateKey *_Nullable TWPrivateKeyCreateWithData(TWData *_Nonnull data) {
-    auto dataSize = TWDataSize(data);
-    Data bytes(dataSize);
-    TWDataCopyBytes(data, 0, dataSize, bytes.data());
+    const auto& bytes = *reinterpret_cast<const Data*>(data);
     if (!PrivateKey::isValid(bytes)) {
         return nullptr;
     }
-   return new TWPrivateKey{ PrivateKey(std::move(bytes)) };
+   return new TWPrivateKey{ PrivateKey(bytes) };
 }
 
 struct TWPrivateKey *_Nullable TWPrivateKeyCreateCopy(struct TWPrivateKey *_Nonnull key) {
@@ -51,9 +49,7 @@ void TWPrivateKeyDelete(struct TWPrivateKey *_Nonnull pk) {
 }
 
 bool TWPrivateKeyIsValid(TWData *_Nonnull data, enum TWCurve curve) {
-    auto dataSize = TWDataSize(data);
-    std::vector<uint8_t> bytes(dataSize);
-    TWDataCopyBytes(data, 0, dataSize, bytes.data());
+    const auto& bytes = *reinterpret_cast<const Data*>(data);
     return PrivateKey::isValid(bytes, curve);
 }
 
@@ -27,7 +27,7 @@ struct TWStoredKey* _Nullable TWStoredKeyLoad(TWString* _Nonnull path) {
 
 struct TWStoredKey* _Nonnull TWStoredKeyCreate(TWString* _Nonnull name, TWData* _Nonnull password) {
     const auto& nameString = *reinterpret_cast<const std::string*>(name);
-    const auto passwordData = TW::data(TWDataBytes(password), TWDataSize(password));
+    const auto& passwordData = *reinterpret_cast<const TW::Data*>(password);
     return new TWStoredKey{ StoredKey::createWithMnemonicRandom(nameString, passwordData) };
 }
 
@@ -35,7 +35,7 @@ struct TWStoredKey* _Nullable TWStoredKeyImportPrivateKey(TWData* _Nonnull priva
     try {
         const auto& privateKeyData = *reinterpret_cast<const TW::Data*>(privateKey);
         const auto& nameString = *reinterpret_cast<const std::string*>(name);
-        const auto passwordData = TW::data(TWDataBytes(password), TWDataSize(password));
+        const auto& passwordData = *reinterpret_cast<const TW::Data*>(password);
         return new TWStoredKey{ StoredKey::createWithPrivateKeyAddDefaultAddress(nameString, passwordData, coin, privateKeyData) };
     } catch (...) {
         return nullptr;
@@ -46,7 +46,7 @@ struct TWStoredKey* _Nullable TWStoredKeyImportHDWallet(TWString* _Nonnull mnemo
     try {
         const auto& mnemonicString = *reinterpret_cast<const std::string*>(mnemonic);
         const auto& nameString = *reinterpret_cast<const std::string*>(name);
-        const auto passwordData = TW::data(TWDataBytes(password), TWDataSize(password));
+        const auto& passwordData = *reinterpret_cast<const TW::Data*>(password);
         return new TWStoredKey{ StoredKey::createWithMnemonicAddDefaultAddress(nameString, passwordData, mnemonicString, coin) };
     } catch (...) {
         return nullptr;
@@ -127,7 +127,7 @@ bool TWStoredKeyStore(struct TWStoredKey* _Nonnull key, TWString* _Nonnull path)
 
 TWData* _Nullable TWStoredKeyDecryptPrivateKey(struct TWStoredKey* _Nonnull key, TWData* _Nonnull password) {
     try {
-        const auto passwordData = TW::data(TWDataBytes(password), TWDataSize(password));
+        const auto& passwordData = *reinterpret_cast<const TW::Data*>(password);
         const auto data = key->impl.payload.decrypt(passwordData);
         return TWDataCreateWithBytes(data.data(), data.size());
     } catch (...) {
@@ -137,7 +137,7 @@ TWData* _Nullable TWStoredKeyDecryptPrivateKey(struct TWStoredKey* _Nonnull key,
 
 TWString* _Nullable TWStoredKeyDecryptMnemonic(struct TWStoredKey* _Nonnull key, TWData* _Nonnull password) {
     try {
-        const auto passwordData = TW::data(TWDataBytes(password), TWDataSize(password));
+        const auto& passwordData = *reinterpret_cast<const TW::Data*>(password);
         const auto data = key->impl.payload.decrypt(passwordData);
         const auto string = std::string(data.begin(), data.end());
         return TWStringCreateWithUTF8Bytes(string.c_str());
@@ -148,7 +148,7 @@ TWString* _Nullable TWStoredKeyDecryptMnemonic(struct TWStoredKey* _Nonnull key,
 
 struct TWPrivateKey* _Nullable TWStoredKeyPrivateKey(struct TWStoredKey* _Nonnull key, enum TWCoinType coin, TWData* _Nonnull password) {
     try {
-        const auto passwordData = TW::data(TWDataBytes(password), TWDataSize(password));
+        const auto& passwordData = *reinterpret_cast<const TW::Data*>(password);
         return new TWPrivateKey{ key->impl.privateKey(coin, passwordData) };
     } catch (...) {
         return nullptr;
@@ -157,7 +157,7 @@ struct TWPrivateKey* _Nullable TWStoredKeyPrivateKey(struct TWStoredKey* _Nonnul
 
 struct TWHDWallet* _Nullable TWStoredKeyWallet(struct TWStoredKey* _Nonnull key, TWData* _Nonnull password) {
     try {
-        const auto passwordData = TW::data(TWDataBytes(password), TWDataSize(password));
+        const auto& passwordData = *reinterpret_cast<const TW::Data*>(password);
         return new TWHDWallet{ key->impl.wallet(passwordData) };
     } catch (...) {
         return nullptr;
@@ -171,7 +171,7 @@ TWData* _Nullable TWStoredKeyExportJSON(struct TWStoredKey* _Nonnull key) {
 
 bool TWStoredKeyFixAddresses(struct TWStoredKey* _Nonnull key, TWData* _Nonnull password) {
     try {
-        const auto passwordData = TW::data(TWDataBytes(password), TWDataSize(password));
+        const auto& passwordData = *reinterpret_cast<const TW::Data*>(password);
         key->impl.fixAddresses(passwordData);
         return true;
     } catch (...) {
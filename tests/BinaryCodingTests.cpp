@@ -156,3 +156,33 @@ TEST(BinaryCodingTests, decodeStringTooShort) {
         EXPECT_EQ(get<0>(result), true);
     }
 }
+
+TEST(BinaryCodingTests, encodeAndDecodeLengthPrefixed) {
+    Data encoded;
+    encodeLengthPrefixed(parse_hex("abcd"), encoded);
+    encodeLengthPrefixed(Data(), encoded);
+    encodeLengthPrefixed(string("ef"), encoded);
+    EXPECT_EQ(hex(encoded), "02000000abcd" "00000000" "020000006566");
+
+    const auto decoded = decodeLengthPrefixed(encoded);
+    EXPECT_EQ(get<0>(decoded), true);
+    ASSERT_EQ(get<1>(decoded).size(), 3);
+    EXPECT_EQ(hex(get<1>(decoded)[0]), "abcd");
+    EXPECT_EQ(hex(get<1>(decoded)[1]), "");
+    EXPECT_EQ(hex(get<1>(decoded)[2]), "6566");
+
+    EXPECT_EQ(get<0>(decodeLengthPrefixed(Data())), true);
+    EXPECT_EQ(get<0>(decodeLengthPrefixed(parse_hex("02000000ab"))), false);
+    EXPECT_EQ(get<0>(decodeLengthPrefixed(parse_hex("020000"))), false);
+
+    const auto strings = decodeLengthPrefixed<string>(encoded);
+    EXPECT_EQ(get<0>(strings), true);
+    ASSERT_EQ(get<1>(strings).size(), 3);
+    EXPECT_EQ(get<1>(strings)[2], "ef");
+    EXPECT_EQ(get<0>(decodeLengthPrefixed<string>(parse_hex("020000"))), false);
+
+    const auto ranges = decodeLengthPrefixedRanges(encoded);
+    EXPECT_EQ(get<0>(ranges), true);
+    EXPECT_EQ(get<1>(ranges), (vector<pair<size_t, size_t>>{{4, 2}, {10, 0}, {14, 2}}));
+    EXPECT_EQ(get<0>(decodeLengthPrefixedRanges(parse_hex("02000000ab"))), false);
+}
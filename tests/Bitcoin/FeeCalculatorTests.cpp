@@ -12,7 +12,7 @@ using namespace TW;
 using namespace TW::Bitcoin;
 
 TEST(BitcoinFeeCalculator, BitcoinCalculate) {
-    FeeCalculator& feeCalculator = getFeeCalculator(TWCoinTypeBitcoin);
+    const FeeCalculator& feeCalculator = getFeeCalculator(TWCoinTypeBitcoin);
     EXPECT_EQ(feeCalculator.calculate(1, 2, 1), 174);
     EXPECT_EQ(feeCalculator.calculate(1, 1, 1), 143);
     EXPECT_EQ(feeCalculator.calculate(0, 2, 1), 72);
@@ -22,7 +22,7 @@ TEST(BitcoinFeeCalculator, BitcoinCalculate) {
 }
 
 TEST(BitcoinFeeCalculator, SegwitCalculate) {
-    FeeCalculator& feeCalculator = getFeeCalculator(TWCoinTypeBitcoin);
+    const FeeCalculator& feeCalculator = getFeeCalculator(TWCoinTypeBitcoin);
     EXPECT_EQ(feeCalculator.calculate(1, 2, 1), 174);
     EXPECT_EQ(feeCalculator.calculate(1, 1, 1), 143);
     EXPECT_EQ(feeCalculator.calculate(0, 2, 1), 72);
@@ -49,7 +49,7 @@ TEST(BitcoinFeeCalculator, DefaultCalculateSingleInput) {
 }
 
 TEST(BitcoinFeeCalculator, DecredCalculate) {
-    FeeCalculator& feeCalculator = getFeeCalculator(TWCoinTypeDecred);
+    const FeeCalculator& feeCalculator = getFeeCalculator(TWCoinTypeDecred);
     EXPECT_EQ(feeCalculator.calculate(1, 2, 1), 254);
     EXPECT_EQ(feeCalculator.calculate(0, 0, 1), 12);
     EXPECT_EQ(feeCalculator.calculate(1, 2, 10), 2540);
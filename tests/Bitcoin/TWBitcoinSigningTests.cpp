@@ -93,7 +93,7 @@ TEST(BitcoinSigning, SignP2PKH) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -124,7 +124,7 @@ TEST(BitcoinSigning, SignP2PKH_NegativeMissingKey) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_FALSE(result);
@@ -230,7 +230,7 @@ TEST(BitcoinSigning, SignP2WPKH) {
     }
 
     // Signs
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -279,7 +279,7 @@ TEST(BitcoinSigning, SignP2WPKH_HashSingle_TwoInput) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -315,7 +315,7 @@ TEST(BitcoinSigning, SignP2WPKH_HashAnyoneCanPay_TwoInput) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -351,7 +351,7 @@ TEST(BitcoinSigning, SignP2WPKH_MaxAmount) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -442,7 +442,7 @@ TEST(BitcoinSigning, SignP2WSH) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -477,7 +477,7 @@ TEST(BitcoinSigning, SignP2WSH_HashNone) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -512,7 +512,7 @@ TEST(BitcoinSigning, SignP2WSH_HashSingle) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -547,7 +547,7 @@ TEST(BitcoinSigning, SignP2WSH_HashAnyoneCanPay) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -582,7 +582,7 @@ TEST(BitcoinSigning, SignP2WSH_NegativeMissingScript) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_FALSE(result);
@@ -599,7 +599,7 @@ TEST(BitcoinSigning, SignP2WSH_NegativeMissingKeys) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_FALSE(result);
@@ -613,7 +613,7 @@ TEST(BitcoinSigning, SignP2WSH_NegativePlanWithError) {
     input.mutable_plan()->set_error(Common::Proto::Error_missing_input_utxos);
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_FALSE(result);
@@ -627,7 +627,7 @@ TEST(BitcoinSigning, SignP2WSH_NegativeNoUTXOs) {
     input.mutable_plan()->clear_utxos();
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_FALSE(result);
@@ -640,7 +640,7 @@ TEST(BitcoinSigning, SignP2WSH_NegativePlanWithNoUTXOs) {
     input.mutable_plan()->clear_utxos();
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_FALSE(result);
@@ -726,7 +726,7 @@ TEST(BitcoinSigning, SignP2SH_P2WPKH) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -759,7 +759,7 @@ TEST(BitcoinSigning, SignP2SH_P2WPKH_NegativeOmitScript) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_FALSE(result);
@@ -775,7 +775,7 @@ TEST(BitcoinSigning, SignP2SH_P2WPKH_NegativeInvalidOutputScript) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_FALSE(result);
@@ -791,7 +791,7 @@ TEST(BitcoinSigning, SignP2SH_P2WPKH_NegativeInvalidRedeemScript) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_FALSE(result);
@@ -807,7 +807,7 @@ TEST(BitcoinSigning, SignP2SH_P2WPKH_NegativeOmitKeys) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_FALSE(result);
@@ -898,7 +898,7 @@ TEST(BitcoinSigning, SignP2SH_P2WSH) {
     utxo->set_amount(987654321);
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     signer.transaction = unsignedTx;
     signer.plan.utxos = {*utxo};
     auto result = signer.sign();
@@ -954,7 +954,7 @@ TEST(BitcoinSigning, Sign_NegativeNoUtxos) {
     }
 
     // Invoke Sign nonetheless
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     // Fails as there are 0 utxos
@@ -1013,7 +1013,7 @@ TEST(BitcoinSigning, Sign_NegativeInvalidAddress) {
     }
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_FALSE(result);
@@ -1066,7 +1066,7 @@ TEST(BitcoinSigning, Plan_10input_MaxAmount) {
     *input.mutable_plan() = plan.proto();
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -1126,7 +1126,7 @@ TEST(BitcoinSigning, Sign_LitecoinReal_a85f) {
     EXPECT_TRUE(verifyPlan(input.plan(), {3'900'000}, 3'899'774, 226));
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -1194,7 +1194,7 @@ TEST(BitcoinSigning, PlanAndSign_LitecoinReal_8435) {
     *input.mutable_plan() = plan.proto();
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
@@ -1358,7 +1358,7 @@ TEST(BitcoinSigning, RedeemExtendedPubkeyUTXO) {
     input.add_private_key(key.bytes.data(), key.bytes.size());
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
 
     ASSERT_TRUE(result) << std::to_string(result.error());
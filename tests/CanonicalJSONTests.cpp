@@ -0,0 +1,102 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "CanonicalJSON.h"
+
+#include "HexCoding.h"
+#include "IncrementalHash.h"
+
+#include <gtest/gtest.h>
+#include <functional>
+#include <nlohmann/json.hpp>
+
+using namespace TW;
+using json = nlohmann::json;
+
+static std::string written(const std::function<void(CanonicalJSONWriter&)>& write) {
+    Data data;
+    DataSink sink(data);
+    CanonicalJSONWriter writer(sink);
+    write(writer);
+    return std::string(data.begin(), data.end());
+}
+
+TEST(CanonicalJSON, Document) {
+    const auto expected = json{
+        {"account_number", "1037"},
+        {"data", nullptr},
+        {"fee", {{"amount", json::array({{{"amount", 200}, {"denom", "muon"}}})}, {"gas", "200000"}}},
+        {"flags", json::array({true, false})},
+        {"height", -42},
+        {"msgs", json::array()},
+        {"value", json::object()},
+    };
+
+    const auto actual = written([](CanonicalJSONWriter& w) {
+        w.beginObject()
+            .key("account_number").value("1037")
+            .key("data").null()
+            .key("fee").beginObject()
+                .key("amount").beginArray()
+                    .beginObject().key("amount").value(200).key("denom").value("muon").endObject()
+                .endArray()
+                .key("gas").value(std::string("200000"))
+            .endObject()
+            .key("flags").beginArray().value(true).value(false).endArray()
+            .key("height").value(int64_t(-42))
+            .key("msgs").beginArray().endArray()
+            .key("value").beginObject().endObject()
+            .endObject();
+    });
+
+    EXPECT_EQ(actual, expected.dump());
+}
+
+TEST(CanonicalJSON, Escaping) {
+    const auto text = std::string("quote\" backslash\\ /\b\f\n\r\t\x01\x1f \xc3\xa9");
+    const auto actual = written([&](CanonicalJSONWriter& w) {
+        w.beginArray().value(text).endArray();
+    });
+
+    EXPECT_EQ(actual, json::array({text}).dump());
+    EXPECT_EQ(actual, "[\"quote\\\" backslash\\\\ /\\b\\f\\n\\r\\t\\u0001\\u001f \xc3\xa9\"]");
+}
+
+TEST(CanonicalJSON, Integers) {
+    const auto actual = written([](CanonicalJSONWriter& w) {
+        w.beginArray()
+            .value(0)
+            .value(INT64_MIN)
+            .value(UINT64_MAX)
+            .value(uint8_t(255))
+            .endArray();
+    });
+
+    EXPECT_EQ(actual, "[0,-9223372036854775808,18446744073709551615,255]");
+}
+
+TEST(CanonicalJSON, Raw) {
+    const auto actual = written([](CanonicalJSONWriter& w) {
+        w.beginObject()
+            .key("type").value("raw")
+            .key("value").raw(json::parse(R"({"b": 1, "a": [2]})").dump())
+            .endObject();
+    });
+
+    EXPECT_EQ(actual, R"({"type":"raw","value":{"a":[2],"b":1}})");
+}
+
+TEST(CanonicalJSON, HashSink) {
+    const auto document = json{{"a", "b"}, {"c", 1}};
+
+    auto hasher = Hash::Sha256();
+    auto sink = HashSink<Hash::Sha256>(hasher);
+    CanonicalJSONWriter writer(sink);
+    writer.beginObject().key("a").value("b").key("c").value(1).endObject();
+    const auto digest = hasher.final();
+
+    EXPECT_EQ(hex(digest), hex(Hash::sha256(document.dump())));
+}
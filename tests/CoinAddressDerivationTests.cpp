@@ -79,6 +79,27 @@ TEST(Coin, DeriveAddress) {
     EXPECT_EQ(TW::deriveAddress(TWCoinTypeTHORChain, privateKey), "thor1hkfq3zahaqkkzx5mjnamwjsfpq2jk7z0luxce7");
 }
 
+TEST(Coin, DeriveAddresses) {
+    std::vector<PrivateKey> privateKeys;
+    for (int i = 1; i <= 11; ++i) {
+        auto keyData = Data(32, 0);
+        keyData[31] = static_cast<TW::byte>(i);
+        privateKeys.push_back(PrivateKey(keyData));
+    }
+    for (auto coin : {TWCoinTypeBitcoin, TWCoinTypeLitecoin, TWCoinTypeBitcoinCash, TWCoinTypeDogecoin, TWCoinTypeEthereum}) {
+        std::vector<PublicKey> publicKeys;
+        for (const auto& privateKey : privateKeys) {
+            publicKeys.push_back(privateKey.getPublicKey(TW::publicKeyType(coin)));
+        }
+        const auto addresses = TW::deriveAddresses(coin, publicKeys);
+        ASSERT_EQ(addresses.size(), publicKeys.size());
+        for (size_t i = 0; i < publicKeys.size(); ++i) {
+            EXPECT_EQ(addresses[i], TW::deriveAddress(coin, publicKeys[i]));
+        }
+    }
+    EXPECT_TRUE(TW::deriveAddresses(TWCoinTypeBitcoin, {}).empty());
+}
+
 int countThreadReady = 0;
 std::mutex countThreadReadyMutex;
 
@@ -120,4 +141,22 @@ TEST(Coin, SupportedCoins) {
     }
 }
 
+TEST(Coin, CoinInfoTable) {
+    EXPECT_EQ(TW::derivationPath(TWCoinTypeBitcoin).string(), "m/84'/0'/0'/0/0");
+    EXPECT_EQ(TW::derivationPath(TWCoinTypeSolana).string(), "m/44'/501'/0'");
+    EXPECT_EQ(&TW::derivationPath(TWCoinTypeEthereum), &TW::derivationPath(TWCoinTypeEthereum));
+    EXPECT_TRUE(TW::derivationPath(static_cast<TWCoinType>(0x7fffffff)).indices.empty());
+
+    EXPECT_EQ(TW::publicKeyHasher(TWCoinTypeDecred), Hash::Algorithm::blake256ripemd);
+    EXPECT_EQ(TW::base58Hasher(TWCoinTypeDecred), Hash::Algorithm::blake256d);
+    EXPECT_EQ(TW::base58Hasher(TWCoinTypeGroestlcoin), Hash::Algorithm::groestl512d);
+    EXPECT_EQ(TW::base58Hasher(TWCoinTypeBitcoin), Hash::Algorithm::sha256d);
+
+    for (auto coin : TW::getCoinTypes()) {
+        const auto& path = TW::derivationPath(coin);
+        EXPECT_EQ(path.purpose(), TW::purpose(coin)) << coin;
+        EXPECT_EQ(DerivationPath(path.string()).indices.size(), path.indices.size()) << coin;
+    }
+}
+
 } // namespace TW
@@ -408,4 +408,59 @@ TEST(Coin, ValidateAddresTHORChain) {
     EXPECT_FALSE(validateAddress(TWCoinTypeTHORChain, "thor1z53wwe7md6cewz9sqwqzn0aavpaun0gw0exn2s"));
 }
 
+TEST(Coin, ValidateAddresses) {
+    const std::vector<std::string> addresses = {
+        "0x5aaeb6053f3e94c9b9a09f33669435e7ef1beaed",
+        "0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAe",
+        "0x5AAEB6053F3E94C9B9A09F33669435E7EF1BEAED",
+    };
+    for (const size_t threads : {1, 2, 8}) {
+        const auto results = validateAddresses(TWCoinTypeEthereum, addresses, true, threads);
+        ASSERT_EQ(results.size(), 3);
+        EXPECT_TRUE(results[0].valid);
+        EXPECT_EQ(results[0].normalized, "0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed");
+        EXPECT_FALSE(results[1].valid);
+        EXPECT_EQ(results[1].normalized, "");
+        EXPECT_TRUE(results[2].valid);
+        EXPECT_EQ(results[2].normalized, "0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed");
+    }
+
+    // the same addresses, read from a buffer
+    Data buffer;
+    std::vector<std::pair<size_t, size_t>> ranges;
+    for (const auto& address : addresses) {
+        buffer.push_back(0xff);
+        ranges.emplace_back(buffer.size(), address.size());
+        append(buffer, data(address));
+    }
+    for (const size_t threads : {1, 2}) {
+        const auto results = validateAddresses(TWCoinTypeEthereum, buffer, ranges, true, threads);
+        ASSERT_EQ(results.size(), 3);
+        EXPECT_TRUE(results[0].valid);
+        EXPECT_EQ(results[0].normalized, "0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed");
+        EXPECT_FALSE(results[1].valid);
+        EXPECT_TRUE(results[2].valid);
+    }
+
+    const auto unnormalized = validateAddresses(TWCoinTypeEthereum, addresses, false);
+    EXPECT_TRUE(unnormalized[0].valid);
+    EXPECT_EQ(unnormalized[0].normalized, "");
+
+    const auto mixed = validateAddresses({
+        {TWCoinTypeBitcoin, "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4"},
+        {TWCoinTypeEthereum, "bc1qw508d6qejxtdg4y5r3zarvary0c5xw7kv8f3t4"},
+        {TWCoinTypeBinance, "bnb1hlly02l6ahjsgxw9wlcswnlwdhg4xhx38yxpd5"},
+        {TWCoinTypeBitcoinCash, "qzxf0wl63ahx6jsxu8uuldcw7n5aatwppvnteraqaw"},
+    }, true, 3);
+    ASSERT_EQ(mixed.size(), 4);
+    EXPECT_TRUE(mixed[0].valid);
+    EXPECT_FALSE(mixed[1].valid);
+    EXPECT_TRUE(mixed[2].valid);
+    EXPECT_EQ(mixed[2].normalized, "bnb1hlly02l6ahjsgxw9wlcswnlwdhg4xhx38yxpd5");
+    EXPECT_TRUE(mixed[3].valid);
+    EXPECT_EQ(mixed[3].normalized, "bitcoincash:qzxf0wl63ahx6jsxu8uuldcw7n5aatwppvnteraqaw");
+
+    EXPECT_TRUE(validateAddresses(TWCoinTypeBitcoin, {}, true, 4).empty());
+}
+
 } // namespace TW
@@ -0,0 +1,61 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "CoinEntry.h"
+#include "HexCoding.h"
+#include "proto/Ethereum.pb.h"
+
+#include <gtest/gtest.h>
+
+using namespace TW;
+
+namespace {
+
+struct EchoSigner {
+    static Ethereum::Proto::SigningOutput sign(const Ethereum::Proto::SigningInput& input) noexcept {
+        EXPECT_NE(input.GetArena(), nullptr);
+        auto output = Ethereum::Proto::SigningOutput();
+        output.set_encoded(input.to_address());
+        return output;
+    }
+};
+
+} // namespace
+
+TEST(CoinEntry, SerializeTo) {
+    auto output = Ethereum::Proto::SigningOutput();
+    output.set_encoded("abc");
+    output.set_v("\x1b");
+
+    Data data = {0xff};
+    serializeTo(output, data);
+    EXPECT_EQ(hex(data), "ff" + hex(output.SerializeAsString()));
+}
+
+TEST(CoinEntry, SignTemplate) {
+    auto input = Ethereum::Proto::SigningInput();
+    input.set_to_address("0x5322b34c88ed0691971bf52a7047448f0f4efc84");
+    const auto serialized = input.SerializeAsString();
+
+    Data dataOut;
+    signTemplate<EchoSigner, Ethereum::Proto::SigningInput>(Data(serialized.begin(), serialized.end()), dataOut);
+
+    auto output = Ethereum::Proto::SigningOutput();
+    ASSERT_TRUE(output.ParseFromArray(dataOut.data(), (int)dataOut.size()));
+    EXPECT_EQ(output.encoded(), "0x5322b34c88ed0691971bf52a7047448f0f4efc84");
+}
+
+TEST(CoinEntry, SigningArenaScopeNested) {
+    SigningArenaScope outer;
+    auto message = google::protobuf::Arena::CreateMessage<Ethereum::Proto::SigningInput>(outer.get());
+    message->set_to_address("0x5322b34c88ed0691971bf52a7047448f0f4efc84");
+    {
+        SigningArenaScope inner;
+        EXPECT_EQ(inner.get(), outer.get());
+    }
+    // the arena is only reset when the outermost scope ends
+    EXPECT_EQ(message->to_address(), "0x5322b34c88ed0691971bf52a7047448f0f4efc84");
+}
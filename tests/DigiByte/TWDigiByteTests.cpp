@@ -61,7 +61,7 @@ TEST(DigiByteTransaction, SignTransaction) {
     protoPlan = plan.proto();
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
     auto signedTx = result.payload();
 
@@ -119,7 +119,7 @@ TEST(DigiByteTransaction, SignP2WPKH) {
     utxo0->mutable_out_point()->set_index(1);
     utxo0->mutable_out_point()->set_sequence(UINT32_MAX);
 
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
     ASSERT_TRUE(result) << std::to_string(result.error());
     auto signedTx = result.payload();
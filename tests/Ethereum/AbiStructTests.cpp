@@ -487,6 +487,131 @@ TEST(EthereumAbiStruct, hashStructJson) {
     }
 }
 
+TEST(EthereumAbiStruct, TypedData) {
+    const auto types = R"({
+        "EIP712Domain": [
+            {"name": "name", "type": "string"},
+            {"name": "version", "type": "string"},
+            {"name": "chainId", "type": "uint256"},
+            {"name": "verifyingContract", "type": "address"}
+        ],
+        "Person": [
+            {"name": "name", "type": "string"},
+            {"name": "wallets", "type": "address[]"}
+        ],
+        "Mail": [
+            {"name": "from", "type": "Person"},
+            {"name": "to", "type": "Person[]"},
+            {"name": "contents", "type": "string"}
+        ]
+    })";
+    const auto domain = R"({
+        "name": "Ether Mail",
+        "version": "1",
+        "chainId": 1,
+        "verifyingContract": "0xCcCCccccCCCCcCCCCCCcCcCccCcCCCcCcccccccC"
+    })";
+    const auto typedData = TypedData(types, domain);
+
+    EXPECT_EQ(typedData.encodeType("Mail"), "Mail(Person from,Person[] to,string contents)Person(string name,address[] wallets)");
+    EXPECT_EQ(hex(typedData.typeHash("Mail")), hex(Hash::keccak256(TW::data(typedData.encodeType("Mail")))));
+    EXPECT_EQ(hex(typedData.domainSeparator()), "f2cee375fa42b42143804025fc449deafd50cc031ca257e0b194a650a912090f");
+
+    const auto message = R"({
+        "from": {
+            "name": "Cow",
+            "wallets": [
+                "CD2a3d9F938E13CD947Ec05AbC7FE734Df8DD826",
+                "DeaDbeefdEAdbeefdEadbEEFdeadbeEFdEaDbeeF"
+            ]
+        },
+        "to": [
+            {
+                "name": "Bob",
+                "wallets": [
+                    "bBbBBBBbbBBBbbbBbbBbbbbBBbBbbbbBbBbbBBbB",
+                    "B0BdaBea57B0BDABeA57b0bdABEA57b0BDabEa57",
+                    "B0B0b0b0b0b0B000000000000000000000000000"
+                ]
+            }
+        ],
+        "contents": "Hello, Bob!"
+    })";
+    // same as encodeTypes_v4_Json
+    EXPECT_EQ(hex(typedData.hashMessageJson("Mail", message)), "a85c2e2b118698e88db68a8105b794a8cc7cec074e89ef991cb4f5f533819cc2");
+
+    // other messages with the same types, against the full message hash
+    for (const auto* other: {
+        R"({"from": {"name": "Cow", "wallets": []}, "to": [{"name": "Bob", "wallets": []}], "contents": "Hello"})",
+        R"({"from": {"name": "Cow", "wallets": ["CD2a3d9F938E13CD947Ec05AbC7FE734Df8DD826"]}, "to": [{"name": "Bob", "wallets": []}, {"name": "Dan", "wallets": ["DeaDbeefdEAdbeefdEadbEEFdeadbeEFdEaDbeeF"]}], "contents": ""})",
+    }) {
+        const auto full = std::string(R"({"types": )") + types + R"(, "primaryType": "Mail", "domain": )" + domain + R"(, "message": )" + other + "}";
+        EXPECT_EQ(hex(typedData.hashMessageJson("Mail", other)), hex(ParamStruct::hashStructJson(full)));
+    }
+    // the type hash does not depend on the values: an empty struct array hashes to zero
+    {
+        const auto from = nlohmann::json::parse(R"({"name": "Cow", "wallets": []})");
+        Data encoded = typedData.typeHash("Mail");
+        append(encoded, typedData.hashStruct("Person", from));
+        append(encoded, Data(32));
+        append(encoded, Hash::keccak256(TW::data("Hello")));
+        EXPECT_EQ(hex(typedData.hashStruct("Mail", nlohmann::json{{"from", from}, {"to", nlohmann::json::array()}, {"contents", "Hello"}})),
+            hex(Hash::keccak256(encoded)));
+    }
+    // sub-struct only
+    EXPECT_EQ(hex(typedData.hashStruct("Person", nlohmann::json::parse(R"({"name": "Cow", "wallets": []})"))),
+        hex(ParamStruct::makeStruct("Person", R"({"name": "Cow", "wallets": []})", types)->hashStruct()));
+}
+
+TEST(EthereumAbiStruct, TypedDataRecursive) {
+    const auto typedData = TypedData(R"({
+        "EIP712Domain": [
+            {"name": "name", "type": "string"},
+            {"name": "version", "type": "string"},
+            {"name": "chainId", "type": "uint256"},
+            {"name": "verifyingContract", "type": "address"}
+        ],
+        "Person": [
+            {"name": "name", "type": "string"},
+            {"name": "mother", "type": "Person"},
+            {"name": "father", "type": "Person"}
+        ]
+    })", R"({
+        "name": "Family Tree",
+        "version": "1",
+        "chainId": 1,
+        "verifyingContract": "0xCcCCccccCCCCcCCCCCCcCcCccCcCCCcCcccccccC"
+    })");
+    EXPECT_EQ(typedData.encodeType("Person"), "Person(string name,Person mother,Person father)");
+    const auto hash = typedData.hashMessageJson("Person", R"({
+        "name": "Jon",
+        "mother": {"name": "Lyanna", "father": {"name": "Rickard"}},
+        "father": {"name": "Rhaegar", "father": {"name": "Aeris II"}}
+    })");
+    EXPECT_EQ(hex(hash), "807773b9faa9879d4971b43856c4d60c2da15c6f8c062bd9d33afefb756de19c");
+}
+
+TEST(EthereumAbiStruct, TypedDataErrors) {
+    const auto types = R"({
+        "EIP712Domain": [{"name": "name", "type": "string"}],
+        "Person": [{"name": "name", "type": "string"}, {"name": "wallets", "type": "address[]"}]
+    })";
+    EXPECT_EXCEPTION(TypedData("NOT_A_JSON", "{}"), "Could not parse types Json");
+    EXPECT_EXCEPTION(TypedData("[]", "{}"), "Expecting object");
+    EXPECT_EXCEPTION(TypedData("{}", "{}"), "Type not found, EIP712Domain");
+    EXPECT_EXCEPTION(TypedData(R"({"EIP712Domain": []})", "{}"), "No valid params found");
+    EXPECT_EXCEPTION(TypedData(R"({"EIP712Domain": [{"name": "param", "type": "type"}]})", "{}"), "Unknown type type");
+    EXPECT_EXCEPTION(TypedData(R"({"EIP712Domain": [{"name": "param"}]})", "{}"), "Expecting 'name' and 'type', in EIP712Domain");
+    EXPECT_EXCEPTION(TypedData(types, "NOT_A_JSON"), "Could not parse domain Json");
+    EXPECT_EXCEPTION(TypedData(types, "[]"), "Expecting object");
+
+    const auto typedData = TypedData(types, R"({"name": "Ether Person"})");
+    EXPECT_EXCEPTION(typedData.typeHash("Mail"), "Type not found, Mail");
+    EXPECT_EXCEPTION(typedData.hashMessageJson("Mail", "{}"), "Type not found, Mail");
+    EXPECT_EXCEPTION(typedData.hashMessageJson("Person", "NOT_A_JSON"), "Could not parse Json");
+    EXPECT_EXCEPTION(typedData.hashMessageJson("Person", R"({"name": "Cow", "wallets": "NOT_AN_ARRAY"})"), "Could not set type for param wallets");
+}
+
 TEST(EthereumAbiStruct, ParamFactoryMakeNamed) {
     std::shared_ptr<ParamNamed> p = ParamFactory::makeNamed("firstparam", "uint256");
     EXPECT_EQ(p->getName(), "firstparam");
@@ -5,6 +5,7 @@
 // file LICENSE at the root of the source code distribution tree.
 
 #include "Ethereum/Address.h"
+#include "Ethereum/AddressChecksum.h"
 #include "HexCoding.h"
 #include "PrivateKey.h"
 
@@ -42,6 +43,22 @@ TEST(EthereumAddress, EIP55) {
     );
 }
 
+TEST(EthereumAddress, EIP55Batch) {
+    const auto strings = checksumed({
+        Address(parse_hex("5aaeb6053f3e94c9b9a09f33669435e7ef1beaed")),
+        Address(parse_hex("fb6916095ca1df60bb79ce92ce3ea74c37c5d359")),
+        Address(parse_hex("dbf03b407c01e7cd3cbea99509d93f8dddc8c6fb")),
+        Address(parse_hex("d1220a0cf47c7b9be7a2e6ba89f429762e7b9adb")),
+        Address(parse_hex("5aaeb6053f3e94c9b9a09f33669435e7ef1beaed")),
+    }, ChecksumType::eip55);
+    ASSERT_EQ(strings.size(), 5u);
+    EXPECT_EQ(strings[0], "0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed");
+    EXPECT_EQ(strings[1], "0xfB6916095ca1df60bB79Ce92cE3Ea74c37c5d359");
+    EXPECT_EQ(strings[2], "0xdbF03B407c01E7cD3CBea99509d93f8DDDC8C6FB");
+    EXPECT_EQ(strings[3], "0xD1220A0cf47c7B9Be7A2E6BA89F429762e7b9aDb");
+    EXPECT_EQ(strings[4], "0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed");
+}
+
 TEST(EthereumAddress, String) {
     const auto address = Address("0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed");
     ASSERT_EQ(address.string(), "0x5aAeb6053F3E94C9b9A09f33669435E7Ef1BeAed");
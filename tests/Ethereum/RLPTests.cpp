@@ -6,6 +6,7 @@
 
 #include "Ethereum/RLP.h"
 #include "HexCoding.h"
+#include "SigningArena.h"
 
 #include <gtest/gtest.h>
 
@@ -76,6 +77,27 @@ TEST(RLP, Lists) {
     ASSERT_TRUE(std::equal(prefix.begin(), prefix.end(), hex(encoded).begin()));
 }
 
+TEST(RLP, AppendEncoded) {
+    ArenaData encoded;
+    RLP::appendEncoded(encoded, uint256_t(0));
+    RLP::appendEncoded(encoded, uint256_t(0x7f));
+    RLP::appendEncoded(encoded, uint256_t(1024));
+    const auto dog = std::string("dog");
+    RLP::appendEncoded(encoded, reinterpret_cast<const uint8_t*>(dog.data()), dog.size());
+    EXPECT_EQ(hex(encoded), "807f82040083646f67");
+
+    Data header;
+    RLP::appendHeader(header, 1024, 0xc0, 0xf7);
+    EXPECT_EQ(hex(header), "f90400");
+    EXPECT_EQ(hex(header), hex(RLP::encodeHeader(1024, 0xc0, 0xf7)));
+
+    const auto long_string = Data(56, 0xab);
+    Data encodedString;
+    RLP::appendEncoded(encodedString, long_string.data(), long_string.size());
+    EXPECT_EQ(hex(encodedString), hex(RLP::encode(long_string)));
+    EXPECT_EQ(hex(encodedString).substr(0, 4), "b838");
+}
+
 TEST(RLP, Invalid) {
     ASSERT_TRUE(RLP::encode(-1).empty());
     ASSERT_TRUE(RLP::encodeList(std::vector<int>{0, -1}).empty());
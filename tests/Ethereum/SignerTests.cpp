@@ -7,6 +7,7 @@
 #include "Ethereum/Address.h"
 #include "Ethereum/RLP.h"
 #include "Ethereum/Signer.h"
+#include "BinaryCoding.h"
 #include "HexCoding.h"
 
 #include <gtest/gtest.h>
@@ -85,4 +86,73 @@ TEST(EthereumSigner, SignERC20Transfer) {
     ASSERT_EQ(hex(TW::store(signature.s)), "032131cae15da7ddcda66963e8bef51ca0d9962bfef0547d3f02597a4a58c931");
 }
 
+TEST(EthereumSigner, BatchSignERC20Transfer) {
+    const auto chainId = store(uint256_t(1));
+    const auto gasPrice = store(uint256_t(42000000000));
+    const auto gasLimit = store(uint256_t(78009));
+    const auto key = parse_hex("0x608dcb1742bb3fb7aec002074e3420e4fab7d00cced79ccdac53ed5b27138151");
+    Proto::SigningInput input;
+    input.set_chain_id(chainId.data(), chainId.size());
+    input.set_gas_price(gasPrice.data(), gasPrice.size());
+    input.set_gas_limit(gasLimit.data(), gasLimit.size());
+    input.set_to_address("0x6b175474e89094c44da98b954eedeac495271d0f");
+    input.set_private_key(key.data(), key.size());
+    input.mutable_transaction()->mutable_erc20_transfer();
+    const auto signer = BatchSigner(input);
+
+    std::vector<BatchTransfer> transfers;
+    for (auto i = 0; i < 10; ++i) {
+        transfers.push_back(BatchTransfer{parse_hex("0x5322b34c88ed0691971bf52a7047448f0f4efc84"), uint256_t(2000000000000000000) + i, i});
+    }
+    // https://etherscan.io/tx/0x199a7829fc5149e49b452c2cab76d8fa5a9682fee6e4891b8acb697ac142513e
+    EXPECT_EQ(hex(signer.sign(transfers[0])), "f8aa808509c7652400830130b9946b175474e89094c44da98b954eedeac495271d0f80b844a9059cbb0000000000000000000000005322b34c88ed0691971bf52a7047448f0f4efc840000000000000000000000000000000000000000000000001bc16d674ec8000025a0724c62ad4fbf47346b02de06e603e013f26f26b56fdc0be7ba3d6273401d98cea0032131cae15da7ddcda66963e8bef51ca0d9962bfef0547d3f02597a4a58c931");
+
+    for (const auto threads : {1u, 3u}) {
+        const auto result = signer.sign(transfers, threads);
+        size_t offset = 0;
+        for (const auto& transfer : transfers) {
+            ASSERT_LE(offset + 4, result.size());
+            const auto size = decode32LE(result.data() + offset);
+            ASSERT_LE(offset + 4 + size + 32, result.size());
+            const auto encoded = Data(result.begin() + offset + 4, result.begin() + offset + 4 + size);
+            const auto hash = Data(result.begin() + offset + 4 + size, result.begin() + offset + 4 + size + 32);
+            offset += 4 + size + 32;
+
+            // same as a single transaction
+            const auto transaction = TransactionNonTyped::buildERC20Transfer(transfer.nonce, 42000000000, 78009,
+                parse_hex("0x6b175474e89094c44da98b954eedeac495271d0f"), transfer.to, transfer.amount);
+            const auto signature = Signer::sign(PrivateKey(key), 1, transaction);
+            EXPECT_EQ(hex(encoded), hex(transaction->encoded(signature, 1)));
+            EXPECT_EQ(hex(hash), hex(Hash::keccak256(encoded)));
+        }
+        EXPECT_EQ(offset, result.size());
+        EXPECT_EQ(hex(Data(result.begin() + 4 + 172, result.begin() + 4 + 172 + 32)), "199a7829fc5149e49b452c2cab76d8fa5a9682fee6e4891b8acb697ac142513e");
+    }
+    EXPECT_TRUE(signer.sign({}, 3).empty());
+}
+
+TEST(EthereumSigner, BatchSignNativeTransfer) {
+    const auto chainId = store(uint256_t(1));
+    const auto gasPrice = store(uint256_t(20000000000));
+    const auto gasLimit = store(uint256_t(21000));
+    const auto key = parse_hex("0x4646464646464646464646464646464646464646464646464646464646464646");
+    Proto::SigningInput input;
+    input.set_chain_id(chainId.data(), chainId.size());
+    input.set_gas_price(gasPrice.data(), gasPrice.size());
+    input.set_gas_limit(gasLimit.data(), gasLimit.size());
+    input.set_private_key(key.data(), key.size());
+    input.mutable_transaction()->mutable_transfer();
+    const auto signer = BatchSigner(input);
+
+    // EIP-155 example
+    const auto encoded = signer.sign(BatchTransfer{parse_hex("0x3535353535353535353535353535353535353535"), uint256_t(1000000000000000000), 9});
+    EXPECT_EQ(hex(encoded), "f86c098504a817c800825208943535353535353535353535353535353535353535880de0b6b3a76400008025a028ef61340bd939bc2195fe537567866003e1a15d3c71ff63e1590620aa636276a067cbe9d8997f761aecb703304b3800ccf555c9f3dc64214b297fb1966a3b6d83");
+
+    EXPECT_THROW(signer.sign(BatchTransfer{parse_hex("0x3535"), 1, 10}), std::invalid_argument);
+    EXPECT_THROW(signer.sign({BatchTransfer{parse_hex("0x3535"), 1, 10}}, 2), std::invalid_argument);
+
+    input.mutable_transaction()->mutable_erc20_approve();
+    EXPECT_THROW(BatchSigner{input}, std::invalid_argument);
+}
+
 } // namespace TW::Ethereum
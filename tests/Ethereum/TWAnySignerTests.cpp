@@ -6,6 +6,7 @@
 
 #include "../interface/TWTestUtilities.h"
 #include <TrustWalletCore/TWAnySigner.h>
+#include "BinaryCoding.h"
 #include "HexCoding.h"
 #include "uint256.h"
 #include "proto/Ethereum.pb.h"
@@ -119,6 +120,60 @@ TEST(TWAnySignerEthereum, SignERC20TransferAsERC20) {
     ASSERT_EQ(hex(output.data()), "a9059cbb0000000000000000000000005322b34c88ed0691971bf52a7047448f0f4efc840000000000000000000000000000000000000000000000001bc16d674ec80000");
 }
 
+TEST(TWAnySignerEthereum, SignBatch) {
+    auto chainId = store(uint256_t(1));
+    auto gasPrice = store(uint256_t(42000000000));
+    auto gasLimit = store(uint256_t(78009));
+    auto amountData = store(uint256_t(2000000000000000000));
+    auto key = parse_hex("0x608dcb1742bb3fb7aec002074e3420e4fab7d00cced79ccdac53ed5b27138151");
+
+    std::vector<std::string> inputs;
+    Data batch;
+    for (auto i = 0; i < 10; ++i) {
+        auto nonce = store(uint256_t(i));
+        Proto::SigningInput input;
+        input.set_chain_id(chainId.data(), chainId.size());
+        input.set_nonce(nonce.data(), nonce.size());
+        input.set_gas_price(gasPrice.data(), gasPrice.size());
+        input.set_gas_limit(gasLimit.data(), gasLimit.size());
+        input.set_to_address("0x6b175474e89094c44da98b954eedeac495271d0f");
+        input.set_private_key(key.data(), key.size());
+        auto& erc20 = *input.mutable_transaction()->mutable_erc20_transfer();
+        erc20.set_to("0x5322b34c88ed0691971bf52a7047448f0f4efc84");
+        erc20.set_amount(amountData.data(), amountData.size());
+        inputs.push_back(input.SerializeAsString());
+        encodeLengthPrefixed(inputs.back(), batch);
+    }
+    auto batchData = WRAPD(TWDataCreateWithBytes(batch.data(), batch.size()));
+
+    // an excessive thread count is capped
+    for (const auto threads : {1u, 3u, 100000u}) {
+        auto result = WRAPD(TWAnySignerSignBatch(batchData.get(), TWCoinTypeEthereum, threads));
+        ASSERT_NE(result.get(), nullptr);
+        const auto decoded = decodeLengthPrefixed(*reinterpret_cast<const Data*>(result.get()));
+        ASSERT_TRUE(std::get<0>(decoded));
+        const auto& outputs = std::get<1>(decoded);
+        ASSERT_EQ(outputs.size(), inputs.size());
+
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            auto single = WRAPD(TWAnySignerSign(WRAPD(TWDataCreateWithBytes((const uint8_t*)inputs[i].data(), inputs[i].size())).get(), TWCoinTypeEthereum));
+            EXPECT_EQ(hex(outputs[i]), hex(*reinterpret_cast<const Data*>(single.get())));
+        }
+
+        Proto::SigningOutput output;
+        ASSERT_TRUE(output.ParseFromArray(outputs[0].data(), (int)outputs[0].size()));
+        // https://etherscan.io/tx/0x199a7829fc5149e49b452c2cab76d8fa5a9682fee6e4891b8acb697ac142513e
+        EXPECT_EQ(hex(output.encoded()), "f8aa808509c7652400830130b9946b175474e89094c44da98b954eedeac495271d0f80b844a9059cbb0000000000000000000000005322b34c88ed0691971bf52a7047448f0f4efc840000000000000000000000000000000000000000000000001bc16d674ec8000025a0724c62ad4fbf47346b02de06e603e013f26f26b56fdc0be7ba3d6273401d98cea0032131cae15da7ddcda66963e8bef51ca0d9962bfef0547d3f02597a4a58c931");
+    }
+
+    auto empty = WRAPD(TWAnySignerSignBatch(WRAPD(TWDataCreateWithBytes(nullptr, 0)).get(), TWCoinTypeEthereum, 2));
+    EXPECT_EQ(TWDataSize(empty.get()), 0);
+
+    batch.pop_back();
+    auto truncated = WRAPD(TWDataCreateWithBytes(batch.data(), batch.size()));
+    EXPECT_EQ(TWAnySignerSignBatch(truncated.get(), TWCoinTypeEthereum, 2), nullptr);
+}
+
 TEST(TWAnySignerEthereum, SignERC20TransferAsGenericContract) {
     auto chainId = store(uint256_t(1));
     auto nonce = store(uint256_t(0));
@@ -6,6 +6,7 @@
 
 #include <TrustWalletCore/TWEthereumAbi.h>
 #include <TrustWalletCore/TWEthereumAbiFunction.h>
+#include <TrustWalletCore/TWEthereumAbiTypedData.h>
 #include <TrustWalletCore/TWString.h>
 
 #include "Ethereum/ABI.h"
@@ -337,4 +338,42 @@ TEST(TWEthereumAbi, encodeTyped) {
     );
 }
 
+TEST(TWEthereumAbi, TypedData) {
+    const auto types = STRING(R"({
+        "EIP712Domain": [
+            {"name": "name", "type": "string"},
+            {"name": "version", "type": "string"},
+            {"name": "chainId", "type": "uint256"},
+            {"name": "verifyingContract", "type": "address"}
+        ],
+        "Person": [
+            {"name": "name", "type": "string"},
+            {"name": "wallet", "type": "address"}
+        ]
+    })");
+    const auto domain = STRING(R"({
+        "name": "Ether Person",
+        "version": "1",
+        "chainId": 1,
+        "verifyingContract": "0xCcCCccccCCCCcCCCCCCcCcCccCcCCCcCcccccccC"
+    })");
+    EXPECT_EQ(TWEthereumAbiTypedDataCreate(STRING("{}").get(), domain.get()), nullptr);
+
+    auto typedData = TWEthereumAbiTypedDataCreate(types.get(), domain.get());
+    ASSERT_NE(typedData, nullptr);
+    auto separator = WRAPD(TWEthereumAbiTypedDataDomainSeparator(typedData));
+    EXPECT_EQ(TWDataSize(separator.get()), 32ul);
+
+    auto hash = WRAPD(TWEthereumAbiTypedDataHashMessage(typedData, STRING("Person").get(),
+        STRING(R"({"name": "Cow", "wallet": "CD2a3d9F938E13CD947Ec05AbC7FE734Df8DD826"})").get()));
+    EXPECT_EQ(
+        hex(TW::data(TWDataBytes(hash.get()), TWDataSize(hash.get()))),
+        "0b4bb85394b9ebb1c2425e283c9e734a9a7a832622e97c998f77e1c7a3f01a20"
+    );
+    auto invalid = WRAPD(TWEthereumAbiTypedDataHashMessage(typedData, STRING("Mail").get(), STRING("{}").get()));
+    EXPECT_EQ(TWDataSize(invalid.get()), 0ul);
+
+    TWEthereumAbiTypedDataDelete(typedData);
+}
+
 } // namespace TW::Ethereum
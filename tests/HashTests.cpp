@@ -4,8 +4,13 @@
 // terms governing use, modification, and redistribution, is contained in the
 // file LICENSE at the root of the source code distribution tree.
 
+#include "Base58.h"
+#include "BinaryCoding.h"
+#include "ByteSink.h"
 #include "Hash.h"
 #include "HexCoding.h"
+#include "IncrementalHash.h"
+#include "Keccak.h"
 
 #include <gtest/gtest.h>
 
@@ -33,6 +38,32 @@ TEST(HashTests, Blake2bPersonal) {
     ASSERT_EQ(result, string("20d9cd024d4fb086aae819a1432dd2466de12947831b75c5a30cf2676095d3b4"));
 }
 
+TEST(HashTests, Blake2bStreaming) {
+    auto personal_string = string("MyApp Files Hash");
+    auto personal_data = Data(personal_string.begin(), personal_string.end());
+    auto hashed = Hash::Blake2b(32, personal_data).update(string("the same ")).update(string("content")).final();
+    EXPECT_EQ(hex(hashed), "20d9cd024d4fb086aae819a1432dd2466de12947831b75c5a30cf2676095d3b4");
+
+    // pieces straddling block boundaries give the same hash as the whole message
+    Data message(1000);
+    for (size_t i = 0; i < message.size(); ++i) {
+        message[i] = static_cast<TW::byte>(i * 7);
+    }
+    for (size_t size : {0, 1, 127, 128, 129, 256, 257, 1000}) {
+        for (size_t piece : {1, 63, 128, 200}) {
+            auto hasher = Hash::Blake2b(64);
+            for (size_t offset = 0; offset < size; offset += piece) {
+                hasher.update(message.data() + offset, std::min(piece, size - offset));
+            }
+            EXPECT_EQ(hex(hasher.final()), hex(Hash::blake2b(message.data(), size, 64))) << size << " " << piece;
+        }
+    }
+
+    EXPECT_THROW(Hash::Blake2b(0), std::invalid_argument);
+    EXPECT_THROW(Hash::Blake2b(65), std::invalid_argument);
+    EXPECT_THROW(Hash::Blake2b(32, parse_hex("0102")), std::invalid_argument);
+}
+
 TEST(HashTests, Sha512_256) {
     auto tests = {
         make_tuple(string(""), string("c672b8d1ef56ed28ab87c3622c5114069bdd3ad7b8f9737498d0c01ecef0967a")),
@@ -65,4 +96,157 @@ TEST(HashTests, hmac256) {
     EXPECT_EQ(hex(hmac), expectedHmac);
 }
 
+TEST(HashTests, Hash160Batch) {
+    const auto pubKey = parse_hex("0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798");
+    EXPECT_EQ(hex(Hash::sha256ripemd(pubKey.data(), pubKey.size())), "751e76e8199196d454941c45d1b3a323f1433bd6");
+
+    // mix of compressed, extended and other sizes, more than one full group of lanes
+    std::vector<Data> inputs;
+    for (int i = 0; i < 21; ++i) {
+        const size_t size = (i % 3 == 0) ? 33 : (i % 3 == 1) ? 65 : static_cast<size_t>(i);
+        Data input(size);
+        for (size_t j = 0; j < size; ++j) {
+            input[j] = static_cast<TW::byte>(i * 31 + j);
+        }
+        inputs.push_back(input);
+    }
+    inputs.push_back(pubKey);
+
+    std::vector<Data> outputs;
+    Hash::hash160Batch(inputs, outputs);
+    ASSERT_EQ(outputs.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(hex(outputs[i]), hex(Hash::sha256ripemd(inputs[i].data(), inputs[i].size()))) << i;
+    }
+    EXPECT_EQ(hex(outputs.back()), "751e76e8199196d454941c45d1b3a323f1433bd6");
+}
+
+TEST(HashTests, Keccak256Batch) {
+    EXPECT_EQ(hex(Hash::keccak256(TW::data(brownFox))), "4d741b6f1eb29cb2a9b9911c82f56fa8d73b04959d3d9d222895df6c0b28aa15");
+
+    // sizes around the 136-byte rate, several messages per block count
+    std::vector<Data> inputs;
+    for (size_t size : {0, 1, 32, 64, 135, 136, 137, 200, 271, 272, 273, 0, 32, 32, 32, 500}) {
+        Data input(size);
+        for (size_t j = 0; j < size; ++j) {
+            input[j] = static_cast<TW::byte>(inputs.size() * 17 + j);
+        }
+        inputs.push_back(input);
+    }
+    inputs.push_back(TW::data(brownFox));
+
+    std::vector<Data> outputs;
+    Hash::keccak256Batch(inputs, outputs);
+    ASSERT_EQ(outputs.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(hex(outputs[i]), hex(Hash::keccak256(inputs[i]))) << i;
+    }
+    EXPECT_EQ(hex(outputs.back()), "4d741b6f1eb29cb2a9b9911c82f56fa8d73b04959d3d9d222895df6c0b28aa15");
+}
+
+TEST(HashTests, KeccakSpongeBatchLongOutput) {
+    // three messages of one block: a multi-lane run with unused lanes, outputs longer than 64 bytes
+    const std::vector<Data> inputs = {TW::data(brownFox), TW::data(brownFoxDot), Data(100, 0x42)};
+    for (const size_t outSize : {size_t(32), size_t(100), Keccak::rate256}) {
+        std::vector<Data> outputs;
+        Keccak::spongeBatch(inputs, Keccak::rate256, Keccak::padKeccak, outSize, outputs);
+        ASSERT_EQ(outputs.size(), inputs.size());
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            Data expected(outSize);
+            Keccak::sponge(inputs[i].data(), inputs[i].size(), Keccak::rate256, Keccak::padKeccak, expected.data(), outSize);
+            EXPECT_EQ(hex(outputs[i]), hex(expected)) << outSize << " " << i;
+        }
+    }
+    std::vector<Data> outputs;
+    EXPECT_THROW(Keccak::spongeBatch(inputs, Keccak::rate256, Keccak::padKeccak, Keccak::rate256 + 1, outputs), std::invalid_argument);
+}
+
+template <typename Hasher, typename OneShot>
+void checkIncremental(OneShot oneShot) {
+    Data message(700);
+    for (size_t i = 0; i < message.size(); ++i) {
+        message[i] = static_cast<TW::byte>(i * 13);
+    }
+    for (size_t size : {0, 1, 63, 64, 65, 135, 136, 137, 272, 700}) {
+        for (size_t piece : {1, 55, 136, 300}) {
+            Hasher hasher;
+            for (size_t offset = 0; offset < size; offset += piece) {
+                hasher.update(message.data() + offset, std::min(piece, size - offset));
+                hasher.update(message.data(), 0);
+            }
+            const auto digest = hasher.final();
+            EXPECT_EQ(hex(digest), hex(oneShot(message.data(), size))) << size << " " << piece;
+        }
+    }
+}
+
+TEST(HashTests, IncrementalHashers) {
+    checkIncremental<Hash::Sha256>([](const TW::byte* p, size_t n) { return Hash::sha256(p, n); });
+    checkIncremental<Hash::Sha256d>([](const TW::byte* p, size_t n) { return Hash::sha256d(p, n); });
+    checkIncremental<Hash::Keccak256>([](const TW::byte* p, size_t n) { return Hash::keccak256(p, n); });
+    checkIncremental<Hash::Blake256>([](const TW::byte* p, size_t n) { return Hash::blake256(p, n); });
+    checkIncremental<Hash::Groestl512>([](const TW::byte* p, size_t n) { return Hash::groestl512(p, n); });
+
+    EXPECT_EQ(hex(Hash::Keccak256().update(string("The quick brown ")).update(string("fox jumps over the lazy dog")).final()),
+              "4d741b6f1eb29cb2a9b9911c82f56fa8d73b04959d3d9d222895df6c0b28aa15");
+}
+
+TEST(HashTests, ByteSink) {
+    Data data;
+    DataSink dataSink(data);
+    Hash::Sha256 hasher;
+    HashSink<Hash::Sha256> hashSink(hasher);
+    for (ByteSink* sink : std::initializer_list<ByteSink*>{&dataSink, &hashSink}) {
+        encode16LE(0x0102, *sink);
+        encode32LE(0x03040506, *sink);
+        encode64LE(0x0708090a0b0c0d0e, *sink);
+        encodeVarInt(0x10000, *sink);
+        sink->write(TW::byte(0xff));
+        sink->write(parse_hex("abcd"));
+    }
+    EXPECT_EQ(hex(data), "020106050403"
+                         "0e0d0c0b0a090807"
+                         "fe00000100"
+                         "ff"
+                         "abcd");
+    EXPECT_EQ(hex(hasher.final()), hex(Hash::sha256(data)));
+}
+
+TEST(HashTests, Digest) {
+    const auto data = TW::data(brownFox);
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::sha1>(data)), hex(Hash::sha1(data)));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::sha256>(data)), hex(Hash::sha256(data)));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::sha512>(data)), hex(Hash::sha512(data)));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::sha512_256>(data)), hex(Hash::sha512_256(data)));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::keccak256>(data)), hex(Hash::keccak256(data)));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::keccak512>(data)), hex(Hash::keccak512(data)));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::sha3_256>(data)), hex(Hash::sha3_256(data)));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::sha3_512>(data)), hex(Hash::sha3_512(data)));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::ripemd>(data)), hex(Hash::ripemd(data)));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::blake256>(data)), hex(Hash::blake256(data)));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::groestl512>(data)), hex(Hash::groestl512(data)));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::sha256d>(data)), hex(Hash::sha256(Hash::sha256(data))));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::sha256ripemd>(data)), hex(Hash::ripemd(Hash::sha256(data))));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::sha3_256ripemd>(data)), hex(Hash::ripemd(Hash::sha3_256(data))));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::blake256d>(data)), hex(Hash::blake256(Hash::blake256(data))));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::blake256ripemd>(data)), hex(Hash::ripemd(Hash::blake256(data))));
+    EXPECT_EQ(hex(Hash::digest<Hash::Algorithm::groestl512d>(data)), hex(Hash::groestl512(Hash::groestl512(data))));
+
+    static_assert(Hash::digestSize(Hash::Algorithm::sha256ripemd) == Hash::ripemdSize);
+    static_assert(std::tuple_size<Hash::Digest<Hash::Algorithm::groestl512d>>::value == Hash::sha512Size);
+}
+
+TEST(HashTests, Base58CheckDigest) {
+    const auto data = parse_hex("00f54a5851e9372b87810a8e60cdd2e7cfd80b6e31");
+    const auto encoded = Base58::bitcoin.encodeCheck(data);
+    EXPECT_EQ(encoded, "1PMycacnJaSqwwJqjawXBErnLsZ7RkXUAs");
+    EXPECT_EQ(encoded, Base58::bitcoin.encodeCheck(data, Hash::sha256d));
+    EXPECT_EQ(hex(Base58::bitcoin.decodeCheck(encoded)), hex(data));
+
+    const auto groestl = Base58::bitcoin.encodeCheck<Hash::Algorithm::groestl512d>(data);
+    EXPECT_EQ(groestl, Base58::bitcoin.encodeCheck(data, Hash::groestl512d));
+    EXPECT_EQ(hex(Base58::bitcoin.decodeCheck<Hash::Algorithm::groestl512d>(groestl)), hex(data));
+    EXPECT_TRUE(Base58::bitcoin.decodeCheck(groestl).empty());
+}
+
 // More tests in TWHashTests
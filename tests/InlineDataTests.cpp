@@ -0,0 +1,76 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "InlineData.h"
+
+#include "HexCoding.h"
+#include "PrivateKey.h"
+
+#include <gtest/gtest.h>
+
+using namespace TW;
+
+TEST(InlineData, Construct) {
+    const auto data = parse_hex("0102030405");
+    const auto buffer = InlineData<8>(data);
+    EXPECT_EQ(buffer.size(), 5);
+    EXPECT_EQ(buffer.capacity(), 8);
+    EXPECT_EQ(hex(buffer), "0102030405");
+    EXPECT_TRUE(buffer == data);
+    EXPECT_TRUE(data == buffer);
+    EXPECT_EQ(Data(buffer), data);
+
+    EXPECT_TRUE(InlineData<8>().empty());
+    EXPECT_EQ(hex(InlineData<8>(3, 0xff)), "ffffff");
+    EXPECT_EQ(hex(InlineData<4>(data.begin() + 1, data.begin() + 3)), "0203");
+}
+
+TEST(InlineData, Modify) {
+    auto buffer = InlineData<6>(parse_hex("0203"));
+    buffer.push_back(0x04);
+    buffer.insert(buffer.begin(), 0x01);
+    EXPECT_EQ(hex(buffer), "01020304");
+
+    const auto suffix = parse_hex("0506");
+    buffer.insert(buffer.end(), suffix.begin(), suffix.end());
+    EXPECT_EQ(hex(buffer), "010203040506");
+    EXPECT_EQ(buffer.front(), 0x01);
+    EXPECT_EQ(buffer.back(), 0x06);
+
+    buffer.resize(2);
+    EXPECT_EQ(hex(buffer), "0102");
+    buffer.resize(4);
+    EXPECT_EQ(hex(buffer), "01020000");
+
+    Data data = parse_hex("ff");
+    append(data, buffer);
+    EXPECT_EQ(hex(data), "ff01020000");
+
+    buffer.clear();
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(InlineData, Capacity) {
+    auto buffer = InlineData<2>(parse_hex("0102"));
+    EXPECT_THROW(buffer.push_back(0x03), std::invalid_argument);
+    EXPECT_THROW(buffer.resize(3), std::invalid_argument);
+    EXPECT_THROW(InlineData<2>(parse_hex("010203")), std::invalid_argument);
+    EXPECT_EQ(hex(buffer), "0102");
+}
+
+TEST(InlineData, Keys) {
+    const auto privateKey = PrivateKey(parse_hex("afeefca74d9a325cf1d6b6911d61a65c32afa8e02bd5e78e2e4ac2910bab45f5"));
+    const auto publicKey = privateKey.getPublicKey(TWPublicKeyTypeSECP256k1Extended);
+    EXPECT_EQ(publicKey.bytes.size(), 65);
+
+    const auto copy = PublicKey(publicKey.bytes, publicKey.type);
+    EXPECT_EQ(copy, publicKey);
+    EXPECT_EQ(hex(copy.compressed().bytes), "0399c6f51ad6f98c9c583f8e92bb7758ab2ca9a04110c0a1126ec43e5453d196c1");
+
+    const auto digest = parse_hex("0000000000000000000000000000000000000000000000000000000000000000");
+    const auto signature = privateKey.signAsDER(digest, TWCurveSECP256k1);
+    EXPECT_LT(signature.size(), signature.capacity());
+}
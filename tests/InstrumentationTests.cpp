@@ -0,0 +1,151 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Bitcoin/SigHashType.h"
+#include "Coin.h"
+#include "Hash.h"
+#include "HexCoding.h"
+#include "Instrumentation.h"
+#include "PrivateKey.h"
+#include "uint256.h"
+#include "proto/Bitcoin.pb.h"
+#include "interface/TWTestUtilities.h"
+
+#include <TrustWalletCore/TWInstrumentation.h>
+#include <nlohmann/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace TW;
+using namespace TW::Instrumentation;
+
+namespace {
+
+Data bitcoinInput() {
+    const auto key = parse_hex("bbc27228ddcb9209d7fd6f36b02f7dfa6252af40bb2f1cbc7a557da8027ff866");
+    const auto keyHash = Hash::sha256ripemd(PrivateKey(key).getPublicKey(TWPublicKeyTypeSECP256k1).bytes.data(), 33);
+    auto script = parse_hex("0014");
+    append(script, keyHash);
+
+    Bitcoin::Proto::SigningInput input;
+    input.set_hash_type(Bitcoin::hashTypeForCoin(TWCoinTypeBitcoin));
+    input.set_amount(150'000);
+    input.set_byte_fee(1);
+    input.set_to_address("1Bp9U1ogV3A14FMvKbRJms7ctyso4Z4Tcx");
+    input.set_change_address("1FQc5LdgGHMHEN9nwkjmz6tWkxhPpxBvBU");
+    input.set_coin_type(TWCoinTypeBitcoin);
+    input.add_private_key(key.data(), key.size());
+    for (auto i = 0; i < 2; ++i) {
+        const auto hash = Hash::sha256(store(uint256_t(i)));
+        auto utxo = input.add_utxo();
+        utxo->set_script(script.data(), script.size());
+        utxo->set_amount(100'000);
+        utxo->mutable_out_point()->set_hash(hash.data(), hash.size());
+        utxo->mutable_out_point()->set_index(0);
+        utxo->mutable_out_point()->set_sequence(UINT32_MAX);
+    }
+    const auto serialized = input.SerializeAsString();
+    return Data(serialized.begin(), serialized.end());
+}
+
+void collectStage(void* context, const char* stage, uint64_t) {
+    static_cast<std::set<std::string>*>(context)->insert(stage);
+}
+
+} // namespace
+
+TEST(Instrumentation, Record) {
+    reset();
+    record(Stage::sighash, 30);
+    record(Stage::sighash, 50);
+    count(Counter::hashes, 3);
+
+    const auto sighash = stats(Stage::sighash);
+    EXPECT_EQ(sighash.calls, 2);
+    EXPECT_EQ(sighash.totalNanoseconds, 80);
+    EXPECT_EQ(sighash.maxNanoseconds, 50);
+    EXPECT_EQ(value(Counter::hashes), 3);
+
+    reset();
+    EXPECT_EQ(stats(Stage::sighash).calls, 0);
+    EXPECT_EQ(value(Counter::hashes), 0);
+}
+
+TEST(Instrumentation, MergedThreads) {
+    reset();
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 4; ++t) {
+        threads.emplace_back([t] {
+            for (auto i = 0; i < 100; ++i) {
+                record(Stage::ecSign, 10 + t);
+                count(Counter::ecOperations, 1);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    record(Stage::ecSign, 1);
+
+    // exited threads are included
+    const auto ecSign = stats(Stage::ecSign);
+    EXPECT_EQ(ecSign.calls, 401);
+    EXPECT_EQ(ecSign.totalNanoseconds, 100 * (10 + 11 + 12 + 13) + 1);
+    EXPECT_EQ(ecSign.maxNanoseconds, 13);
+    EXPECT_EQ(value(Counter::ecOperations), 400);
+
+    reset();
+    EXPECT_EQ(stats(Stage::ecSign).calls, 0);
+    EXPECT_EQ(value(Counter::ecOperations), 0);
+}
+
+TEST(Instrumentation, BitcoinSignStages) {
+    const auto input = bitcoinInput();
+    std::set<std::string> stages;
+    reset();
+    TWInstrumentationSetSink(collectStage, &stages);
+    Data output;
+    anyCoinSign(TWCoinTypeBitcoin, input, output);
+    TWInstrumentationSetSink(nullptr, nullptr);
+    ASSERT_FALSE(output.empty());
+
+    if (!enabled()) {
+        EXPECT_TRUE(stages.empty());
+        EXPECT_EQ(stats(Stage::anySign).calls, 0);
+        return;
+    }
+    const auto expected = std::set<std::string>{"anySign", "parse", "bitcoinPlan", "utxoSelection", "feeEstimation",
+                                                "bitcoinSign", "sighash", "ecSign", "serialize"};
+    EXPECT_EQ(stages, expected);
+    EXPECT_EQ(stats(Stage::anySign).calls, 1);
+    EXPECT_EQ(stats(Stage::ecSign).calls, 2);
+    EXPECT_GE(stats(Stage::anySign).totalNanoseconds, stats(Stage::bitcoinSign).totalNanoseconds);
+    EXPECT_GT(value(Counter::hashes), 0);
+    EXPECT_GE(value(Counter::ecOperations), 2);
+}
+
+TEST(Instrumentation, Stats) {
+    reset();
+    record(Stage::decrypt, 1000);
+    const auto stats = WRAPS(TWInstrumentationStats());
+    const auto json = nlohmann::json::parse(TWStringUTF8Bytes(stats.get()));
+
+    EXPECT_EQ(json["enabled"].get<bool>(), TWInstrumentationEnabled());
+    EXPECT_EQ(json["stages"]["decrypt"]["calls"].get<uint64_t>(), 1);
+    EXPECT_EQ(json["stages"]["decrypt"]["totalNanoseconds"].get<uint64_t>(), 1000);
+    EXPECT_EQ(json["stages"]["anySign"]["calls"].get<uint64_t>(), 0);
+    EXPECT_EQ(json["counters"]["hashes"].get<uint64_t>(), 0);
+    EXPECT_EQ(json["stages"].size(), stageCount);
+    EXPECT_EQ(json["counters"].size(), counterCount);
+
+    TWInstrumentationReset();
+    EXPECT_EQ(Instrumentation::stats(Stage::decrypt).calls, 0);
+}
@@ -0,0 +1,88 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Nano/Signer.h"
+#include "Nano/Work.h"
+#include "BinaryCoding.h"
+#include "HexCoding.h"
+
+#include <nlohmann/json.hpp>
+#include <gtest/gtest.h>
+
+using namespace TW;
+using namespace TW::Nano;
+
+namespace {
+
+WorkRoot workRoot(const std::string& string) {
+    const auto data = parse_hex(string);
+    WorkRoot root;
+    std::copy(data.begin(), data.end(), root.begin());
+    return root;
+}
+
+} // namespace
+
+TEST(NanoWork, Value) {
+    // https://docs.nano.org/commands/rpc-protocol/#work_validate
+    const auto root = workRoot("718CC2121C3E641059BC1C2CFC45666C99E8AE922F7A807B7D07B62C995D79E2");
+    EXPECT_EQ(workValue(root, 0x2bf29ef00786a6bc), 0xffffffd21c3933f4);
+    EXPECT_TRUE(validateWork(root, 0x2bf29ef00786a6bc, workThresholdReceive));
+    EXPECT_FALSE(validateWork(root, 0x2bf29ef00786a6bc, workThresholdSend));
+    EXPECT_FALSE(validateWork(root, 0x2bf29ef00786a6bd, workThresholdReceive));
+    EXPECT_EQ(workString(0x2bf29ef00786a6bc), "2bf29ef00786a6bc");
+    EXPECT_EQ(workString(0x1e3), "00000000000001e3");
+}
+
+TEST(NanoWork, Generate) {
+    const auto root = workRoot("718CC2121C3E641059BC1C2CFC45666C99E8AE922F7A807B7D07B62C995D79E2");
+    const uint64_t threshold = 0xfff0000000000000;
+
+    // a single thread tries the nonces in order
+    const auto work = generateWork(root, threshold, 1);
+    ASSERT_TRUE(work.has_value());
+    EXPECT_EQ(*work, 0x1e3);
+    EXPECT_EQ(workValue(root, *work), 0xfff12b40906d2f19);
+
+    const auto parallelWork = generateWork(root, threshold, 4);
+    ASSERT_TRUE(parallelWork.has_value());
+    EXPECT_TRUE(validateWork(root, *parallelWork, threshold));
+}
+
+TEST(NanoWork, Cancel) {
+    const auto root = workRoot("718CC2121C3E641059BC1C2CFC45666C99E8AE922F7A807B7D07B62C995D79E2");
+    const std::atomic<bool> cancel{true};
+    EXPECT_FALSE(generateWork(root, workThresholdSend, 2, &cancel).has_value());
+}
+
+TEST(NanoWork, Sign) {
+    const auto privateKey = PrivateKey(parse_hex("173c40e97fe2afcd24187e74f6b603cb949a5365e72fbdd065a6b165e2189e34"));
+    const auto linkBlock = parse_hex("491fca2c69a84607d374aaf1f6acd3ce70744c5be0721b5ed394653e85233507");
+    const uint64_t threshold = 0xfff0000000000000;
+
+    auto input = Proto::SigningInput();
+    input.set_private_key(privateKey.bytes.data(), privateKey.bytes.size());
+    input.set_link_block(linkBlock.data(), linkBlock.size());
+    input.set_representative("xrb_3arg3asgtigae3xckabaaewkx3bzsh7nwz7jkmjos79ihyaxwphhm6qgjps4");
+    input.set_balance("96242336390000000000000000000");
+    input.set_generate_work(true);
+    input.set_work_difficulty(threshold);
+
+    const auto output = Signer::sign(input);
+    const auto json = nlohmann::json::parse(output.json());
+    const auto work = parse_hex(json["work"].get<std::string>());
+    ASSERT_EQ(work.size(), 8);
+
+    // first block of the account, so the root is the public key
+    const auto publicKey = privateKey.getPublicKey(TWPublicKeyTypeED25519Blake2b);
+    WorkRoot root;
+    std::copy(publicKey.bytes.begin(), publicKey.bytes.end(), root.begin());
+    EXPECT_TRUE(validateWork(root, decode64BE(work.data()), threshold));
+
+    // given work is kept as is
+    input.set_work("0000000000000000");
+    EXPECT_EQ(nlohmann::json::parse(Signer::sign(input).json())["work"], "0000000000000000");
+}
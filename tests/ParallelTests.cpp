@@ -0,0 +1,49 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "Parallel.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace TW;
+
+TEST(Parallel, CoversAllIndices) {
+    for (const size_t threads : {0, 1, 3, 10000}) {
+        std::vector<int> calls(100);
+        parallelFor(calls.size(), threads, [&](size_t i) { ++calls[i]; });
+        EXPECT_EQ(calls, std::vector<int>(100, 1)) << threads;
+    }
+}
+
+TEST(Parallel, ThreadsCapped) {
+    // more threads than the hardware concurrency are not started
+    std::mutex mutex;
+    std::set<std::thread::id> ids;
+    parallelFor(10000, 10000, [&](size_t) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ids.insert(std::this_thread::get_id());
+    });
+    EXPECT_GE(ids.size(), 1ul);
+    EXPECT_LE(ids.size(), maxThreads());
+}
+
+TEST(Parallel, RethrowsException) {
+    std::atomic<size_t> calls{0};
+    EXPECT_THROW(parallelFor(100, 4, [&](size_t i) {
+        ++calls;
+        if (i == 50) {
+            throw std::invalid_argument("failed");
+        }
+    }), std::invalid_argument);
+    EXPECT_GE(calls.load(), 1ul);
+}
@@ -40,6 +40,23 @@ TEST(PolkadotCodec, EncodeCompact) {
     ASSERT_EQ(hex(encodeCompact(18446744073709551615u)), "13ffffffffffffffff");
 }
 
+TEST(PolkadotCodec, EncodeCompactNative) {
+    for (uint64_t value : {uint64_t(0), uint64_t(63), uint64_t(64), uint64_t(16383), uint64_t(16384),
+                           uint64_t(1073741823), uint64_t(1073741824), uint64_t(4294967296),
+                           uint64_t(72057594037927936), std::numeric_limits<uint64_t>::max()}) {
+        const auto big = encodeCompact(CompactInteger(value));
+        ASSERT_EQ(hex(encodeCompact(value)), hex(big));
+        ASSERT_EQ(compactSize(value), big.size());
+    }
+
+    // beyond 64 bits
+    ASSERT_EQ(hex(encodeCompact(CompactInteger(1) << 64)), "17000000000000000001");
+
+    auto data = parse_hex("ff");
+    encodeCompact(uint64_t(16384), data);
+    ASSERT_EQ(hex(data), "ff02000100");
+}
+
 TEST(PolkadotCodec, EncodeBool) {
     ASSERT_EQ(hex(encodeBool(true)), "01");    
     ASSERT_EQ(hex(encodeBool(false)), "00");
@@ -8,6 +8,7 @@
 #include "Polkadot/Extrinsic.h"
 #include "Polkadot/Address.h"
 #include "SS58Address.h"
+#include "Hash.h"
 #include "HexCoding.h"
 #include "PrivateKey.h"
 #include "PublicKey.h"
@@ -309,4 +310,104 @@ TEST(PolkadotSigner, SignUnbond_070957) {
     ASSERT_EQ(hex(output.encoded()), "b501849dca538b7a925b8ea979cc546464a3c5f81d2398a3a272f6f93bdf4803f2f783003a762d9dc3f2aba8922c4babf7e6622ca1d74da17ab3f152d8f29b0ffee53c7e5e150915912a9dfd98ef115d272e096543eef9f513207dd606eea97d023a64087503080007020300286bee");
 }
 
+TEST(PolkadotSigner, SignBatchTransfer) {
+    auto toAddress = Address("13ZLCqJNPsRZYEbwjtZZFpWt9GyFzg5WahXCVWKpWdUJqrQ5");
+
+    auto input = Proto::SigningInput();
+    input.set_genesis_hash(genesisHash.data(), genesisHash.size());
+    auto blockHash = parse_hex("0x5d2143bb808626d63ad7e1cda70fa8697059d670a992e82cd440fbb95ea40351");
+    input.set_block_hash(blockHash.data(), blockHash.size());
+    input.set_nonce(3);
+    input.set_spec_version(26);
+    input.set_private_key(privateKeyThrow2.bytes.data(), privateKeyThrow2.bytes.size());
+    input.set_network(Proto::Network::POLKADOT);
+    input.set_transaction_version(5);
+
+    auto era = input.mutable_era();
+    era->set_block_number(3541050);
+    era->set_period(64);
+
+    auto batch = input.mutable_balance_call()->mutable_batch_transfer();
+    auto value = store(uint256_t(2000000000)); // 0.2
+    for (auto i = 0; i < 5; ++i) {
+        auto transfer = batch->add_transfers();
+        transfer->set_to_address(toAddress.string());
+        transfer->set_value(value.data(), value.size());
+    }
+    // transfer call: 39 bytes; signed extrinsic of 2 transfers: 185 bytes, of 3 transfers: 224 bytes
+    const auto transferCall = "05007120f76076bcb0efdf94c7219e116899d0163ea61cb428183d71324eb33b2bce0300943577";
+    batch->set_max_length(200);
+
+    {
+        auto extrinsics = Extrinsic::batchTransfers(input);
+        ASSERT_EQ(extrinsics.size(), 3ul);
+        EXPECT_EQ(hex(extrinsics[0].call), std::string("1a0208") + transferCall + transferCall);
+        EXPECT_EQ(hex(extrinsics[2].call), std::string("1a0204") + transferCall);
+        EXPECT_EQ(extrinsics[0].nonce, 3ul);
+        EXPECT_EQ(extrinsics[2].nonce, 5ul);
+    }
+
+    auto output = Signer::sign(input);
+    ASSERT_EQ(output.encoded_batch_size(), 3);
+    EXPECT_EQ(output.encoded(), output.encoded_batch(0));
+    const size_t sizes[] = {185, 185, 146};
+    const char* nonces[] = {"0c", "10", "14"};
+    for (auto i = 0; i < 3; ++i) {
+        const auto& encoded = output.encoded_batch(i);
+        EXPECT_EQ(encoded.size(), sizes[i]);
+        // length prefix, version, signer, signature type, signature, era: the nonce follows
+        EXPECT_EQ(hex(encoded.substr(2 + 1 + 32 + 1 + 64 + 2, 1)), nonces[i]);
+    }
+
+    // weight limit: 4 transfers of weight 1000 in an extrinsic
+    batch->set_max_length(0);
+    batch->set_transfer_weight(1000);
+    batch->set_max_weight(4500);
+    auto extrinsics = Extrinsic::batchTransfers(input);
+    ASSERT_EQ(extrinsics.size(), 2ul);
+    EXPECT_EQ(hex(extrinsics[1].call), std::string("1a0204") + transferCall);
+
+    // a single transfer beyond the length limit
+    batch->set_max_length(140);
+    EXPECT_THROW(Extrinsic::batchTransfers(input), std::invalid_argument);
+    output = Signer::sign(input);
+    EXPECT_TRUE(output.encoded().empty());
+    EXPECT_EQ(output.encoded_batch_size(), 0);
+}
+
+TEST(PolkadotSigner, SigningSessionHashesLargePayload) {
+    auto toAddress = Address("13ZLCqJNPsRZYEbwjtZZFpWt9GyFzg5WahXCVWKpWdUJqrQ5");
+
+    auto input = Proto::SigningInput();
+    input.set_genesis_hash(genesisHash.data(), genesisHash.size());
+    auto blockHash = parse_hex("0x5d2143bb808626d63ad7e1cda70fa8697059d670a992e82cd440fbb95ea40351");
+    input.set_block_hash(blockHash.data(), blockHash.size());
+    input.set_nonce(3);
+    input.set_spec_version(26);
+    input.set_private_key(privateKeyThrow2.bytes.data(), privateKeyThrow2.bytes.size());
+    input.set_network(Proto::Network::POLKADOT);
+    input.set_transaction_version(5);
+
+    auto batch = input.mutable_balance_call()->mutable_batch_transfer();
+    auto value = store(uint256_t(2000000000));
+    for (auto i = 0; i < 10; ++i) {
+        auto transfer = batch->add_transfers();
+        transfer->set_to_address(toAddress.string());
+        transfer->set_value(value.data(), value.size());
+    }
+
+    // all the transfers in one extrinsic: a 468-byte payload, hashed before signing
+    const auto extrinsic = Extrinsic(input);
+    const auto payload = extrinsic.encodePayload();
+    ASSERT_EQ(payload.size(), 468ul);
+    EXPECT_EQ(extrinsic.payloadSize(extrinsic.encodePayloadSuffix()), payload.size());
+
+    const auto signature = privateKeyThrow2.sign(Hash::blake2b(payload, 32), TWCurveED25519);
+    const auto publicKey = privateKeyThrow2.getPublicKey(TWPublicKeyTypeED25519);
+    const auto expected = extrinsic.encodeSignature(publicKey, signature);
+
+    const auto session = SigningSession(input);
+    EXPECT_EQ(hex(session.sign(extrinsic)), hex(expected));
+}
+
 } // namespace
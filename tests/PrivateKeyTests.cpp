@@ -22,6 +22,19 @@ TEST(PrivateKey, CreateValid) {
     EXPECT_EQ(hex(privKeyData), hex(privateKey.bytes));
 }
 
+TEST(PrivateKey, CreateFromBytes) {
+    const auto privKeyData = parse_hex("afeefca74d9a325cf1d6b6911d61a65c32afa8e02bd5e78e2e4ac2910bab45f5");
+    const auto privKeyString = std::string(privKeyData.begin(), privKeyData.end());
+    const auto* privKeyBytes = reinterpret_cast<const uint8_t*>(privKeyString.data());
+    EXPECT_TRUE(PrivateKey::isValid(privKeyBytes, privKeyString.size()));
+    EXPECT_TRUE(PrivateKey::isValid(privKeyBytes, privKeyString.size(), TWCurveSECP256k1));
+    EXPECT_FALSE(PrivateKey::isValid(privKeyBytes, privKeyString.size() - 1));
+
+    EXPECT_EQ(hex(PrivateKey(privKeyBytes, privKeyString.size()).bytes), "afeefca74d9a325cf1d6b6911d61a65c32afa8e02bd5e78e2e4ac2910bab45f5");
+    EXPECT_EQ(hex(PrivateKey(privKeyString).bytes), "afeefca74d9a325cf1d6b6911d61a65c32afa8e02bd5e78e2e4ac2910bab45f5");
+    EXPECT_THROW(PrivateKey(privKeyBytes, 31), std::invalid_argument);
+}
+
 string TestInvalid(const Data& privKeyData) {
     try {
         auto privateKey = PrivateKey(privKeyData);
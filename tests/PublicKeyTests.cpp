@@ -31,6 +31,17 @@ TEST(PublicKeyTests, CreateFromDataSecp256k1) {
     EXPECT_EQ(hex(publicKey.bytes), hex(key));
 }
 
+TEST(PublicKeyTests, CreateFromBytes) {
+    const Data key = parse_hex("010bc3d7d2c7ac19c9de63a1a37bb6a8e3d1b6c4d5f4e6a3f3d0b3b5c2a1b0c4d5");
+    EXPECT_TRUE(PublicKey::isValid(key.data(), key.size(), TWPublicKeyTypeED25519));
+    EXPECT_FALSE(PublicKey::isValid(key.data(), key.size(), TWPublicKeyTypeSECP256k1));
+
+    // the 0x01 prefix of ed25519 keys is dropped
+    const auto publicKey = PublicKey(key.data(), key.size(), TWPublicKeyTypeED25519);
+    EXPECT_EQ(hex(publicKey.bytes), "0bc3d7d2c7ac19c9de63a1a37bb6a8e3d1b6c4d5f4e6a3f3d0b3b5c2a1b0c4d5");
+    EXPECT_THROW(PublicKey(key.data(), key.size() - 1, TWPublicKeyTypeSECP256k1), std::invalid_argument);
+}
+
 TEST(PublicKeyTests, CreateInvalid) {
     const Data keyInvalid = parse_hex("afeefca74d9a325cf1d6b6911d61a65c32af"); // too short
     try {
@@ -65,7 +65,7 @@ TEST(RavencoinTransaction, SignTransaction) {
     protoPlan = plan.proto();
 
     // Sign
-    auto signer = TransactionSigner<Transaction, TransactionBuilder>(std::move(input));
+    auto signer = TransactionSigner<Transaction, TransactionBuilder>(input);
     auto result = signer.sign();
     auto signedTx = result.payload();
 
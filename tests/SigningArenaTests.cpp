@@ -0,0 +1,47 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "SigningArena.h"
+#include "HexCoding.h"
+
+#include <gtest/gtest.h>
+
+using namespace TW;
+
+TEST(SigningArena, CurrentArena) {
+    EXPECT_EQ(SigningArenaScope::current(), nullptr);
+    {
+        SigningArenaScope scope;
+        EXPECT_EQ(SigningArenaScope::current(), scope.get());
+    }
+    EXPECT_EQ(SigningArenaScope::current(), nullptr);
+}
+
+TEST(SigningArena, ArenaDataInScope) {
+    SigningArenaScope scope;
+    const auto usedBefore = scope.get()->SpaceUsed();
+
+    ArenaData data;
+    EXPECT_EQ(data.get_allocator().arena, scope.get());
+    for (auto i = 0; i < 100; ++i) {
+        data.push_back(static_cast<byte>(i));
+    }
+    append(data, Data{0xaa, 0xbb});
+    EXPECT_EQ(data.size(), 102);
+    EXPECT_EQ(hex(Data(data.end() - 3, data.end())), "63aabb");
+    EXPECT_GT(scope.get()->SpaceUsed(), usedBefore);
+
+    // copies keep the arena of the original
+    const auto copy = data;
+    EXPECT_EQ(copy.get_allocator(), data.get_allocator());
+}
+
+TEST(SigningArena, ArenaDataOutOfScope) {
+    ArenaData data = {1, 2, 3};
+    EXPECT_EQ(data.get_allocator().arena, nullptr);
+    data.resize(1000);
+    EXPECT_EQ(data[2], 3);
+}
@@ -0,0 +1,797 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "SigningInputs.h"
+
+#include "Base58.h"
+#include "Base64.h"
+#include "Bitcoin/Script.h"
+#include "Bitcoin/SigHashType.h"
+#include "Coin.h"
+#include "Cosmos/Address.h"
+#include "Hash.h"
+#include "HexCoding.h"
+#include "PrivateKey.h"
+#include "uint256.h"
+#include "proto/Aeternity.pb.h"
+#include "proto/Aion.pb.h"
+#include "proto/Algorand.pb.h"
+#include "proto/Binance.pb.h"
+#include "proto/Cosmos.pb.h"
+#include "proto/EOS.pb.h"
+#include "proto/Elrond.pb.h"
+#include "proto/Ethereum.pb.h"
+#include "proto/FIO.pb.h"
+#include "proto/Filecoin.pb.h"
+#include "proto/Harmony.pb.h"
+#include "proto/Icon.pb.h"
+#include "proto/IoTeX.pb.h"
+#include "proto/NEAR.pb.h"
+#include "proto/NEO.pb.h"
+#include "proto/NULS.pb.h"
+#include "proto/Nano.pb.h"
+#include "proto/Nebulas.pb.h"
+#include "proto/Nimiq.pb.h"
+#include "proto/Oasis.pb.h"
+#include "proto/Ontology.pb.h"
+#include "proto/Polkadot.pb.h"
+#include "proto/Ripple.pb.h"
+#include "proto/Solana.pb.h"
+#include "proto/Stellar.pb.h"
+#include "proto/Tezos.pb.h"
+#include "proto/Theta.pb.h"
+#include "proto/Tron.pb.h"
+#include "proto/VeChain.pb.h"
+#include "proto/Waves.pb.h"
+#include "proto/Zilliqa.pb.h"
+
+#include <TrustWalletCore/TWHRP.h>
+#include <TrustWalletCore/TWStellarPassphrase.h>
+
+#include <string>
+
+using namespace TW;
+
+namespace TW::SigningInputs {
+
+namespace {
+
+Data aeternity() {
+    auto key = parse_hex("4646464646464646464646464646464646464646464646464646464646464646");
+    auto amount = store(uint256_t(10));
+    auto fee = store(uint256_t(20000000000000));
+    Aeternity::Proto::SigningInput input;
+    input.set_from_address("ak_2p5878zbFhxnrm7meL7TmqwtvBaqcBddyp5eGzZbovZ5FeVfcw");
+    input.set_to_address("ak_Egp9yVdpxmvAfQ7vsXGvpnyfNq71msbdUpkMNYGTeTe8kPL3v");
+    input.set_amount(amount.data(), amount.size());
+    input.set_fee(fee.data(), fee.size());
+    input.set_payload("Hello World");
+    input.set_ttl(82757);
+    input.set_nonce(49);
+    input.set_private_key(key.data(), key.size());
+    return serialize(input);
+}
+
+Data aion() {
+    auto key = parse_hex("db33ffdf82c7ba903daf68d961d3c23c20471a8ce6b408e52d579fd8add80cc9");
+    auto amount = store(uint256_t(10000));
+    auto gasPrice = store(uint256_t(20000000000));
+    auto gasLimit = store(uint256_t(21000));
+    auto nonce = store(uint256_t(9));
+    Aion::Proto::SigningInput input;
+    input.set_to_address("0xa082c3de528b7807dc27ad66debb16d4cfe4054209398cee619dd95955063d1e");
+    input.set_amount(amount.data(), amount.size());
+    input.set_gas_price(gasPrice.data(), gasPrice.size());
+    input.set_gas_limit(gasLimit.data(), gasLimit.size());
+    input.set_nonce(nonce.data(), nonce.size());
+    input.set_timestamp(155157377101);
+    input.set_private_key(key.data(), key.size());
+    return serialize(input);
+}
+
+Data algorand() {
+    auto key = parse_hex("d5b43d706ef0cb641081d45a2ec213b5d8281f439f2425d1af54e2afdaabf55b");
+    auto note = parse_hex("68656c6c6f");
+    auto genesisHash = Base64::decode("wGHE2Pwdvd7S12BL5FaOP20EGYesN73ktiC1qzkkit8=");
+    Algorand::Proto::SigningInput input;
+    auto& transaction = *input.mutable_transaction_pay();
+    transaction.set_to_address("CRLADAHJZEW2GFY2UPEHENLOGCUOU74WYSTUXQLVLJUJFHEUZOHYZNWYR4");
+    transaction.set_fee(263000ull);
+    transaction.set_amount(1000000000000ull);
+    transaction.set_first_round(1937767ull);
+    transaction.set_last_round(1938767ull);
+    input.set_genesis_id("mainnet-v1.0");
+    input.set_genesis_hash(genesisHash.data(), genesisHash.size());
+    input.set_note(note.data(), note.size());
+    input.set_private_key(key.data(), key.size());
+    return serialize(input);
+}
+
+Data binance() {
+    auto key = parse_hex("95949f757db1f57ca94a5dff23314accbe7abee89597bf6a3c7382c84d7eb832");
+    auto fromKeyhash = parse_hex("40c2979694bbc961023d1d27be6fc4d21a9febe6");
+    auto toKeyhash = parse_hex("bffe47abfaede50419c577f1074fee6dd1535cd1");
+    Binance::Proto::SigningInput input;
+    input.set_chain_id("Binance-Chain-Nile");
+    input.set_private_key(key.data(), key.size());
+    auto& order = *input.mutable_send_order();
+    auto& orderInput = *order.add_inputs();
+    orderInput.set_address(fromKeyhash.data(), fromKeyhash.size());
+    auto& inputCoin = *orderInput.add_coins();
+    inputCoin.set_denom("BNB");
+    inputCoin.set_amount(1);
+    auto& orderOutput = *order.add_outputs();
+    orderOutput.set_address(toKeyhash.data(), toKeyhash.size());
+    auto& outputCoin = *orderOutput.add_coins();
+    outputCoin.set_denom("BNB");
+    outputCoin.set_amount(1);
+    return serialize(input);
+}
+
+/// Transfer from the key of the Bitcoin input, spending two of its P2PKH outputs, to its own address on the coin.
+Data bitcoinFamily(TWCoinType coin) {
+    const auto key = PrivateKey(parse_hex("bbc27228ddcb9209d7fd6f36b02f7dfa6252af40bb2f1cbc7a557da8027ff866"));
+    const auto publicKey = key.getPublicKey(TWPublicKeyTypeSECP256k1);
+    const auto script = Bitcoin::Script::buildPayToPublicKeyHash(Hash::sha256ripemd(publicKey.bytes.data(), publicKey.bytes.size()));
+    const auto address = deriveAddress(coin, key);
+
+    Bitcoin::Proto::SigningInput input;
+    input.set_hash_type(Bitcoin::hashTypeForCoin(coin));
+    input.set_amount(150'000);
+    input.set_byte_fee(1);
+    input.set_to_address(address);
+    input.set_change_address(address);
+    input.set_coin_type(coin);
+    input.add_private_key(key.bytes.data(), key.bytes.size());
+    for (auto i = 0; i < 2; ++i) {
+        const auto hash = Hash::sha256(store(uint256_t(i)));
+        auto& utxo = *input.add_utxo();
+        utxo.set_script(script.bytes.data(), script.bytes.size());
+        utxo.set_amount(100'000);
+        utxo.mutable_out_point()->set_hash(hash.data(), hash.size());
+        utxo.mutable_out_point()->set_index(0);
+        utxo.mutable_out_point()->set_sequence(UINT32_MAX);
+    }
+    return serialize(input);
+}
+
+/// Cosmos transfer; other chains of the Cosmos SDK get the same addresses with their own prefix.
+Data cosmos(TWCoinType coin) {
+    auto key = parse_hex("80e81ea269e66a0a05b11236df7919fb7fbeedba87452d667489d7403a02f005");
+    const auto prefix = stringForHRP(TW::hrp(coin));
+    Cosmos::Proto::SigningInput input;
+    input.set_account_number(1037);
+    input.set_chain_id("gaia-13003");
+    input.set_sequence(8);
+    input.set_private_key(key.data(), key.size());
+
+    auto& message = *input.add_messages()->mutable_send_coins_message();
+    message.set_from_address(Cosmos::Address(prefix, parse_hex("BC2DA90C84049370D1B7C528BC164BC588833F21")).string());
+    message.set_to_address(Cosmos::Address(prefix, parse_hex("12E8FE8B81ECC1F4F774EA6EC8DF267138B9F2D9")).string());
+    auto& amount = *message.add_amounts();
+    amount.set_denom("muon");
+    amount.set_amount(1);
+
+    auto& fee = *input.mutable_fee();
+    fee.set_gas(200000);
+    auto& feeAmount = *fee.add_amounts();
+    feeAmount.set_denom("muon");
+    feeAmount.set_amount(200);
+    return serialize(input);
+}
+
+Data decred() {
+    auto key = parse_hex("ba005cd605d8a02e3d5dfd04234cef3a3ee4f76bfbad2722d1fb5af8e12e6764");
+    auto hash = parse_hex("fdbfe9dd703f306794a467f175be5bd9748a7925033ea1cf9889d7cf4dd11550");
+    auto script = parse_hex("76a914b75fdec70b2e731795dd123ab40f918bf099fee088ac");
+    Bitcoin::Proto::SigningInput input;
+    input.set_hash_type(TWBitcoinSigHashTypeAll);
+    input.set_amount(10000000);
+    input.set_byte_fee(1);
+    input.set_to_address("Dsesp1V6DZDEtcq2behmBVKdYqKMdkh96hL");
+    input.set_change_address("DsUoWCAxprdGNtKQqambFbTcSBgH1SHn9Gp");
+    input.set_coin_type(TWCoinTypeDecred);
+    auto& utxo = *input.add_utxo();
+    utxo.set_amount(39900000);
+    utxo.set_script(script.data(), script.size());
+    utxo.mutable_out_point()->set_hash(hash.data(), hash.size());
+    utxo.mutable_out_point()->set_index(0);
+    input.add_private_key(key.data(), key.size());
+    return serialize(input);
+}
+
+Data eos() {
+    auto chainId = parse_hex("cf057bbfb72640471fd910bcb67639c22df9f92470936cddc1ade0e2f2e7dc4f");
+    auto refBlock = parse_hex("000067d6f6a7e7799a1f3d487439a679f8cf95f1c986f35c0d2fa320f51a7144");
+    auto key = parse_hex("559aead08264d5795d3909718cdd05abd49572e84fe55590eef31a88a08fdffd");
+    EOS::Proto::SigningInput input;
+    auto& asset = *input.mutable_asset();
+    asset.set_amount(300000);
+    asset.set_decimals(4);
+    asset.set_symbol("TKN");
+    input.set_chain_id(chainId.data(), chainId.size());
+    input.set_reference_block_id(refBlock.data(), refBlock.size());
+    input.set_reference_block_time(1554209118);
+    input.set_currency("token");
+    input.set_sender("token");
+    input.set_recipient("eosio");
+    input.set_memo("my second transfer");
+    input.set_private_key(key.data(), key.size());
+    input.set_private_key_type(EOS::Proto::KeyType::MODERNK1);
+    return serialize(input);
+}
+
+Data elrond() {
+    auto key = parse_hex("1a927e2af5306a9bb2ea777f73e06ecc0ac9aaa72fb4ea3fecf659451394cccf");
+    Elrond::Proto::SigningInput input;
+    input.set_private_key(key.data(), key.size());
+    auto& transaction = *input.mutable_transaction();
+    transaction.set_nonce(0);
+    transaction.set_value("0");
+    transaction.set_sender("erd1l453hd0gt5gzdp7czpuall8ggt2dcv5zwmfdf3sd3lguxseux2fsmsgldz");
+    transaction.set_receiver("erd1cux02zersde0l7hhklzhywcxk4u9n4py5tdxyx7vrvhnza2r4gmq4vw35r");
+    transaction.set_gas_price(1000000000);
+    transaction.set_gas_limit(50000);
+    transaction.set_data("foo");
+    transaction.set_chain_id("1");
+    transaction.set_version(1);
+    return serialize(input);
+}
+
+Data ethereum() {
+    auto chainId = store(uint256_t(1));
+    auto gasPrice = store(uint256_t(42000000000));
+    auto gasLimit = store(uint256_t(78009));
+    auto amount = store(uint256_t(2000000000000000000));
+    auto key = parse_hex("608dcb1742bb3fb7aec002074e3420e4fab7d00cced79ccdac53ed5b27138151");
+    Ethereum::Proto::SigningInput input;
+    input.set_chain_id(chainId.data(), chainId.size());
+    input.set_gas_price(gasPrice.data(), gasPrice.size());
+    input.set_gas_limit(gasLimit.data(), gasLimit.size());
+    input.set_to_address("0x6b175474e89094c44da98b954eedeac495271d0f");
+    input.set_private_key(key.data(), key.size());
+    auto& erc20 = *input.mutable_transaction()->mutable_erc20_transfer();
+    erc20.set_to("0x5322b34c88ed0691971bf52a7047448f0f4efc84");
+    erc20.set_amount(amount.data(), amount.size());
+    return serialize(input);
+}
+
+Data fio() {
+    auto key = parse_hex("ba0828d5734b65e3bcc2c51c93dfc26dd71bd666cc0273adee77d73d9a322035");
+    auto chainId = parse_hex("4e46572250454b796d7296eec9e8896327ea82dd40f2cd74cf1b1d8ba90bcd77");
+    FIO::Proto::SigningInput input;
+    input.set_expiry(1579784511);
+    input.mutable_chain_params()->set_chain_id(chainId.data(), chainId.size());
+    input.mutable_chain_params()->set_head_block_number(39881);
+    input.mutable_chain_params()->set_ref_block_prefix(4279583376);
+    input.set_private_key(key.data(), key.size());
+    input.set_tpid("rewards@wallet");
+    auto& message = *input.mutable_action()->mutable_register_fio_address_message();
+    message.set_fio_address("adam@fiotestnet");
+    message.set_owner_fio_public_key("FIO6m1fMdTpRkRBnedvYshXCxLFiC5suRU8KDfx8xxtXp2hntxpnf");
+    message.set_fee(5000000000);
+    return serialize(input);
+}
+
+Data filecoin() {
+    auto key = parse_hex("1d969865e189957b9824bd34f26d5cbf357fda1a6d844cbf0c9ab1ed93fa7dbe");
+    auto value = store(uint256_t(600) * uint256_t(1'000'000'000) * uint256_t(1'000'000'000));
+    auto gasFeeCap = store(uint256_t(700) * uint256_t(1'000'000'000) * uint256_t(1'000'000'000));
+    auto gasPremium = store(uint256_t(800) * uint256_t(1'000'000'000) * uint256_t(1'000'000'000));
+    Filecoin::Proto::SigningInput input;
+    input.set_private_key(key.data(), key.size());
+    input.set_to("f3um6uo3qt5of54xjbx3hsxbw5mbsc6auxzrvfxekn5bv3duewqyn2tg5rhrlx73qahzzpkhuj7a34iq7oifsq");
+    input.set_nonce(2);
+    input.set_value(value.data(), value.size());
+    input.set_gas_limit(1000);
+    input.set_gas_fee_cap(gasFeeCap.data(), gasFeeCap.size());
+    input.set_gas_premium(gasPremium.data(), gasPremium.size());
+    return serialize(input);
+}
+
+Data groestlcoin() {
+    auto key = parse_hex("dc334e7347f2f9f72fce789b11832bdf78adf0158bc6617e6d2d2a530a0d4bc6");
+    auto script = parse_hex("00147557920fbc32a1ef4ef26bae5e8ce3f95abf09ce");
+    auto hash = parse_hex("9568b09e6c6d940302ec555a877c9e5f799de8ee473e18d3a19ae14478cc4e8f");
+    Bitcoin::Proto::SigningInput input;
+    input.set_hash_type(TWBitcoinSigHashTypeAll);
+    input.set_amount(2500);
+    input.set_byte_fee(1);
+    input.set_to_address("31inaRqambLsd9D7Ke4USZmGEVd3PHkh7P");
+    input.set_change_address("Fj62rBJi8LvbmWu2jzkaUX1NFXLEqDLoZM");
+    input.add_private_key(key.data(), key.size());
+    auto& utxo = *input.add_utxo();
+    utxo.set_script(script.data(), script.size());
+    utxo.set_amount(4774);
+    utxo.mutable_out_point()->set_hash(hash.data(), hash.size());
+    utxo.mutable_out_point()->set_index(1);
+    utxo.mutable_out_point()->set_sequence(UINT32_MAX);
+    return serialize(input);
+}
+
+Data harmony() {
+    auto key = parse_hex("4edef2c24995d15b0e25cbd152fb0e2c05d3b79b9c2afd134e6f59f91bf99e48");
+    Harmony::Proto::SigningInput input;
+    input.set_private_key(key.data(), key.size());
+    auto chainId = store(uint256_t(2));
+    input.set_chain_id(chainId.data(), chainId.size());
+    auto& message = *input.mutable_transaction_message();
+    message.set_to_address("one129r9pj3sk0re76f7zs3qz92rggmdgjhtwge62k");
+    auto nonce = store(uint256_t(1));
+    message.set_nonce(nonce.data(), nonce.size());
+    auto gasPrice = store(uint256_t(0));
+    message.set_gas_price(gasPrice.data(), gasPrice.size());
+    auto gasLimit = store(uint256_t(0x5208));
+    message.set_gas_limit(gasLimit.data(), gasLimit.size());
+    auto fromShard = store(uint256_t(1));
+    message.set_from_shard_id(fromShard.data(), fromShard.size());
+    auto toShard = store(uint256_t(0));
+    message.set_to_shard_id(toShard.data(), toShard.size());
+    auto amount = store(uint256_t("0x6bfc8da5ee8220000"));
+    message.set_amount(amount.data(), amount.size());
+    return serialize(input);
+}
+
+Data icon() {
+    auto key = parse_hex("2d42994b2f7735bbc93a3e64381864d06747e574aa94655c516f9ad0a74eed79");
+    auto value = store(uint256_t(1000000000000000000));
+    auto stepLimit = store(uint256_t("74565"));
+    auto one = store(uint256_t(1));
+    Icon::Proto::SigningInput input;
+    input.set_from_address("hxbe258ceb872e08851f1f59694dac2558708ece11");
+    input.set_to_address("hx5bfdb090f43a808005ffc27c25b213145e80b7cd");
+    input.set_value(value.data(), value.size());
+    input.set_step_limit(stepLimit.data(), stepLimit.size());
+    input.set_network_id(one.data(), one.size());
+    input.set_nonce(one.data(), one.size());
+    input.set_timestamp(1516942975500598);
+    input.set_private_key(key.data(), key.size());
+    return serialize(input);
+}
+
+Data iotex() {
+    auto key = parse_hex("68ffa8ec149ce50da647166036555f73d57f662eb420e154621e5f24f6cf9748");
+    IoTeX::Proto::SigningInput input;
+    input.set_version(1);
+    input.set_nonce(1);
+    input.set_gaslimit(1);
+    input.set_gasprice("1");
+    input.set_privatekey(key.data(), key.size());
+    auto& transfer = *input.mutable_transfer();
+    transfer.set_amount("1");
+    transfer.set_recipient("io1e2nqsyt7fkpzs5x7zf2uk0jj72teu5n6aku3tr");
+    return serialize(input);
+}
+
+Data kusama() {
+    auto key = parse_hex("8cdc538e96f460da9d639afc5c226f477ce98684d77fb31e88db74c1f1dd86b2");
+    auto genesisHash = parse_hex("b0a8d493285c2df73290dfb7e61f870f17b41801197a149ca93654499ea3dafe");
+    auto value = store(uint256_t(10000000000));
+    Polkadot::Proto::SigningInput input;
+    input.set_block_hash(genesisHash.data(), genesisHash.size());
+    input.set_genesis_hash(genesisHash.data(), genesisHash.size());
+    input.set_nonce(1);
+    input.set_spec_version(2019);
+    input.set_private_key(key.data(), key.size());
+    input.set_network(Polkadot::Proto::Network::KUSAMA);
+    input.set_transaction_version(2);
+    auto& transfer = *input.mutable_balance_call()->mutable_transfer();
+    transfer.set_to_address("CtwdfrhECFs3FpvCGoiE4hwRC4UsSiM8WL899HjRdQbfYZY");
+    transfer.set_value(value.data(), value.size());
+    return serialize(input);
+}
+
+Data nano() {
+    auto key = parse_hex("173c40e97fe2afcd24187e74f6b603cb949a5365e72fbdd065a6b165e2189e34");
+    auto linkBlock = parse_hex("491fca2c69a84607d374aaf1f6acd3ce70744c5be0721b5ed394653e85233507");
+    Nano::Proto::SigningInput input;
+    input.set_private_key(key.data(), key.size());
+    input.set_link_block(linkBlock.data(), linkBlock.size());
+    input.set_representative("xrb_3arg3asgtigae3xckabaaewkx3bzsh7nwz7jkmjos79ihyaxwphhm6qgjps4");
+    input.set_balance("96242336390000000000000000000");
+    return serialize(input);
+}
+
+Data near() {
+    auto key = parse_hex("8737b99bf16fba78e1e753e23ba00c4b5423ac9c45d9b9caae9a519434786568");
+    auto blockHash = parse_hex("0fa473fd26901df296be6adc4cc4df34d040efa2435224b6986910e630c2fef6");
+    auto deposit = parse_hex("01000000000000000000000000000000");
+    NEAR::Proto::SigningInput input;
+    input.set_signer_id("test.near");
+    input.set_nonce(1);
+    input.set_receiver_id("whatever.near");
+    input.set_private_key(key.data(), key.size());
+    input.set_block_hash(blockHash.data(), blockHash.size());
+    input.add_actions()->mutable_transfer()->set_deposit(deposit.data(), deposit.size());
+    return serialize(input);
+}
+
+Data nebulas() {
+    auto key = parse_hex("d2fd0ec9f6268fc8d1f563e3e976436936708bdf0dc60c66f35890f5967a8d2b");
+    auto nonce = store(uint256_t(7));
+    auto gasPrice = store(uint256_t(1000000));
+    auto gasLimit = store(uint256_t(200000));
+    auto amount = store(uint256_t(11000000000000000000ULL));
+    auto timestamp = store(uint256_t(1560052938));
+    auto chainId = store(uint256_t(1));
+    Nebulas::Proto::SigningInput input;
+    input.set_from_address("n1V5bB2tbaM3FUiL4eRwpBLgEredS5C2wLY");
+    input.set_to_address("n1SAeQRVn33bamxN4ehWUT7JGdxipwn8b17");
+    input.set_nonce(nonce.data(), nonce.size());
+    input.set_gas_price(gasPrice.data(), gasPrice.size());
+    input.set_gas_limit(gasLimit.data(), gasLimit.size());
+    input.set_amount(amount.data(), amount.size());
+    input.set_timestamp(timestamp.data(), timestamp.size());
+    input.set_chain_id(chainId.data(), chainId.size());
+    input.set_private_key(key.data(), key.size());
+    return serialize(input);
+}
+
+Data neo() {
+    const auto neoAssetId = "9b7cffdaa674beae0f930ebe6085af9093e5fe56b34a5c220ccdcf6efc336fc5";
+    const auto gasAssetId = "e72d286979ee6cb1b7e65dfddfb2e384100b8d148e7758de42e4168b71792c60";
+    auto key = parse_hex("F18B2F726000E86B4950EBEA7BFF151F69635951BC4A31C44F28EE6AF7AEC128");
+    NEO::Proto::SigningInput input;
+    input.set_private_key(key.data(), key.size());
+    input.set_fee(12345);
+    input.set_gas_asset_id(gasAssetId);
+    input.set_gas_change_address("AdtSLMBqACP4jv8tRWwyweXGpyGG46eMXV");
+    const auto addInput = [&](const char* hash, uint32_t index, int64_t value, const char* assetId) {
+        const auto prevHash = parse_hex(hash);
+        auto& utxo = *input.add_inputs();
+        utxo.set_prev_hash(prevHash.data(), prevHash.size());
+        utxo.set_prev_index(index);
+        utxo.set_asset_id(assetId);
+        utxo.set_value(value);
+    };
+    // the gas and the largest NEO inputs of the NEO signing test
+    addInput("c61508268c5d0343af1875c60e569493100824dbdba108b31789e0e33bcb50fb", 1, 98899890000, gasAssetId);
+    addInput("048f73d6cc82d9d92b08044eccef66c78a0c22e836988ed25d6f7ffe24fb5b38", 10, 34000000000, neoAssetId);
+    auto& output = *input.add_outputs();
+    output.set_asset_id(neoAssetId);
+    output.set_to_address("Ad9A1xPbuA5YBFr1XPznDwBwQzdckAjCev");
+    output.set_change_address("AdtSLMBqACP4jv8tRWwyweXGpyGG46eMXV");
+    output.set_amount(25000000000);
+    return serialize(input);
+}
+
+Data nimiq() {
+    auto key = parse_hex("e3cc33575834add098f8487123cd4bca543ee859b3e8cfe624e7e6a97202b756");
+    Nimiq::Proto::SigningInput input;
+    input.set_destination("NQ86 2H8F YGU5 RM77 QSN9 LYLH C56A CYYR 0MLA");
+    input.set_fee(1000);
+    input.set_value(42042042);
+    input.set_validity_start_height(314159);
+    input.set_private_key(key.data(), key.size());
+    return serialize(input);
+}
+
+Data nuls() {
+    auto key = parse_hex("9ce21dad67e0f0af2599b41b515a7f7018059418bab892a7b68f283d489abc4b");
+    auto amount = store(uint256_t(10000000));
+    auto balance = store(uint256_t(100000000));
+    const std::string nonce = "0000000000000000";
+    NULS::Proto::SigningInput input;
+    input.set_from("NULSd6Hgj7ZoVgsPN9ybB4C1N2TbvkgLc8Z9H");
+    input.set_to("NULSd6Hgied7ym6qMEfVzZanMaa9qeqA6TZSe");
+    input.set_amount(amount.data(), amount.size());
+    input.set_chain_id(1);
+    input.set_idassets_id(1);
+    input.set_private_key(key.data(), key.size());
+    input.set_balance(balance.data(), balance.size());
+    input.set_timestamp(1569228280);
+    input.set_nonce(nonce.data(), nonce.size());
+    return serialize(input);
+}
+
+Data oasis() {
+    auto key = parse_hex("4f8b5676990b00e23d9904a92deb8d8f428ff289c8939926358f1d20537c21a0");
+    Oasis::Proto::SigningInput input;
+    auto& transfer = *input.mutable_transfer();
+    transfer.set_gas_price(0);
+    transfer.set_gas_amount("0");
+    transfer.set_nonce(0);
+    transfer.set_to("oasis1qrrnesqpgc6rfy2m50eew5d7klqfqk69avhv4ak5");
+    transfer.set_amount("10000000");
+    transfer.set_context("oasis-core/consensus: tx for chain a245619497e580dd3bc1aa3256c07f68b8dcc13f92da115eadc3b231b083d3c4");
+    input.set_private_key(key.data(), key.size());
+    return serialize(input);
+}
+
+Data ontology() {
+    auto ownerKey = parse_hex("4646464646464646464646464646464646464646464646464646464646464646");
+    auto payerKey = parse_hex("4646464646464646464646464646464646464646464646464646464646464652");
+    Ontology::Proto::SigningInput input;
+    input.set_contract("ONT");
+    input.set_method("transfer");
+    input.set_nonce(2338116610);
+    input.set_owner_private_key(ownerKey.data(), ownerKey.size());
+    input.set_payer_private_key(payerKey.data(), payerKey.size());
+    input.set_to_address("Af1n2cZHhMZumNqKgw9sfCNoTWu9de4NDn");
+    input.set_amount(1);
+    input.set_gas_price(500);
+    input.set_gas_limit(20000);
+    return serialize(input);
+}
+
+Data polkadot() {
+    auto key = parse_hex("abf8e5bdbe30c65656c0a3cbd181ff8a56294a69dfedd27982aace4a76909115");
+    auto genesisHash = parse_hex("91b171bb158e2d3848fa23a9f1c25182fb8e20313b2c1eb49219da7a70ce90c3");
+    auto blockHash = parse_hex("343a3f4258fd92f5ca6ca5abdf473d86a78b0bcd0dc09c568ca594245cc8c642");
+    auto value = store(uint256_t(12345));
+    Polkadot::Proto::SigningInput input;
+    input.set_genesis_hash(genesisHash.data(), genesisHash.size());
+    input.set_block_hash(blockHash.data(), blockHash.size());
+    input.set_nonce(0);
+    input.set_spec_version(17);
+    input.set_private_key(key.data(), key.size());
+    input.set_network(Polkadot::Proto::Network::POLKADOT);
+    input.set_transaction_version(3);
+    auto& era = *input.mutable_era();
+    era.set_block_number(927699);
+    era.set_period(8);
+    auto& transfer = *input.mutable_balance_call()->mutable_transfer();
+    transfer.set_to_address("14E5nqKAp3oAJcmzgZhUD2RcptBeUBScxKHgJKU4HPNcKVf3");
+    transfer.set_value(value.data(), value.size());
+    return serialize(input);
+}
+
+Data ripple() {
+    auto key = parse_hex("ba005cd605d8a02e3d5dfd04234cef3a3ee4f76bfbad2722d1fb5af8e12e6764");
+    Ripple::Proto::SigningInput input;
+    input.set_amount(29000000);
+    input.set_fee(200000);
+    input.set_sequence(1);
+    input.set_account("rDpysuumkweqeC7XdNgYNtzL5GxbdsmrtF");
+    input.set_destination("rU893viamSnsfP3zjzM2KPxjqZjXSXK6VF");
+    input.set_private_key(key.data(), key.size());
+    return serialize(input);
+}
+
+Data solana() {
+    auto key = Base58::bitcoin.decode("A7psj2GW7ZMdY4E5hJq14KMeYg7HFjULSsWSrTXZLvYr");
+    Solana::Proto::SigningInput input;
+    auto& message = *input.mutable_transfer_transaction();
+    message.set_recipient("EN2sCsJ1WDV8UFqsiTXHcUPUxQ4juE71eCknHYYMifkd");
+    message.set_value(42);
+    input.set_private_key(key.data(), key.size());
+    input.set_recent_blockhash("11111111111111111111111111111111");
+    return serialize(input);
+}
+
+/// Stellar payment; Kin signs the same payment with its own passphrase.
+Data stellar(const char* passphrase) {
+    auto key = parse_hex("59a313f46ef1c23a9e4f71cea10fc0c56a2a6bb8a4b9ea3d5348823e5a478722");
+    Stellar::Proto::SigningInput input;
+    input.set_passphrase(passphrase);
+    input.set_account("GAE2SZV4VLGBAPRYRFV2VY7YYLYGYIP5I7OU7BSP6DJT7GAZ35OKFDYI");
+    input.set_fee(1000);
+    input.set_sequence(2);
+    input.mutable_op_payment()->set_destination("GDCYBNRRPIHLHG7X7TKPUPAZ7WVUXCN3VO7WCCK64RIFV5XM5V5K4A52");
+    input.mutable_op_payment()->set_amount(10000000);
+    input.set_private_key(key.data(), key.size());
+    input.mutable_memo_text()->set_text("Hello, world!");
+    return serialize(input);
+}
+
+Data tezos() {
+    auto key = parse_hex("2e8905819b8723fe2c1d161860e5ee1830318dbf49a83bd451cfb8440c28bd6f");
+    auto revealKey = parse_hex("311f002e899cdd9a52d96cb8be18ea2bbab867c505da2b44ce10906f511cff95");
+    Tezos::Proto::SigningInput input;
+    input.set_private_key(key.data(), key.size());
+    auto& operations = *input.mutable_operation_list();
+    operations.set_branch("BL8euoCWqNCny9AR3AKjnpi38haYMxjei1ZqNHuXMn19JSQnoWp");
+
+    auto& reveal = *operations.add_operations();
+    reveal.mutable_reveal_operation_data()->set_public_key(revealKey.data(), revealKey.size());
+    reveal.set_source("tz1XVJ8bZUXs7r5NV8dHvuiBhzECvLRLR3jW");
+    reveal.set_fee(1272);
+    reveal.set_counter(30738);
+    reveal.set_gas_limit(10100);
+    reveal.set_storage_limit(257);
+    reveal.set_kind(Tezos::Proto::Operation::REVEAL);
+
+    auto& transaction = *operations.add_operations();
+    transaction.mutable_transaction_operation_data()->set_amount(1);
+    transaction.mutable_transaction_operation_data()->set_destination("tz1XVJ8bZUXs7r5NV8dHvuiBhzECvLRLR3jW");
+    transaction.set_source("tz1XVJ8bZUXs7r5NV8dHvuiBhzECvLRLR3jW");
+    transaction.set_fee(1272);
+    transaction.set_counter(30739);
+    transaction.set_gas_limit(10100);
+    transaction.set_storage_limit(257);
+    transaction.set_kind(Tezos::Proto::Operation::TRANSACTION);
+    return serialize(input);
+}
+
+Data theta() {
+    auto key = parse_hex("93a90ea508331dfdf27fb79757d4250b4e84954927ba0073cd67454ac432c737");
+    auto amount = store(uint256_t(10));
+    auto tfuelAmount = store(uint256_t(20));
+    auto fee = store(uint256_t(1000000000000));
+    Theta::Proto::SigningInput input;
+    input.set_chain_id("privatenet");
+    input.set_to_address("0x9F1233798E905E173560071255140b4A8aBd3Ec6");
+    input.set_theta_amount(amount.data(), amount.size());
+    input.set_tfuel_amount(tfuelAmount.data(), tfuelAmount.size());
+    input.set_fee(fee.data(), fee.size());
+    input.set_sequence(1);
+    input.set_private_key(key.data(), key.size());
+    return serialize(input);
+}
+
+Data thorchain() {
+    auto key = parse_hex("7105512f0c020a1dd759e14b865ec0125f59ac31e34d7a2807a228ed50cb343e");
+    Cosmos::Proto::SigningInput input;
+    input.set_account_number(593);
+    input.set_chain_id("thorchain");
+    input.set_sequence(3);
+    input.set_private_key(key.data(), key.size());
+    auto& message = *input.add_messages()->mutable_send_coins_message();
+    message.set_from_address("thor1z53wwe7md6cewz9sqwqzn0aavpaun0gw0exn2r");
+    message.set_to_address("thor1e2ryt8asq4gu0h6z2sx9u7rfrykgxwkmr9upxn");
+    auto& amount = *message.add_amounts();
+    amount.set_denom("rune");
+    amount.set_amount(10000000);
+    auto& fee = *input.mutable_fee();
+    fee.set_gas(200000);
+    auto& feeAmount = *fee.add_amounts();
+    feeAmount.set_denom("rune");
+    feeAmount.set_amount(2000000);
+    return serialize(input);
+}
+
+Data tron() {
+    Tron::Proto::SigningInput input;
+    auto& transaction = *input.mutable_transaction();
+    auto& transfer = *transaction.mutable_transfer_asset();
+    transfer.set_owner_address("TJRyWwFs9wTFGZg3JbrVriFbNfCug5tDeC");
+    transfer.set_to_address("THTR75o8xXAgCTQqpiot2AFRAjvW1tSbVV");
+    transfer.set_amount(4);
+    transfer.set_asset_name("1000959");
+    transaction.set_timestamp(1539295479000);
+    transaction.set_expiration(1541890116000 + 10 * 60 * 60 * 1000);
+
+    auto& blockHeader = *transaction.mutable_block_header();
+    blockHeader.set_timestamp(1541890116000);
+    const auto txTrieRoot = parse_hex("845ab51bf63c2c21ee71a4dc0ac3781619f07a7cd05e1e0bd8ba828979332ffa");
+    blockHeader.set_tx_trie_root(txTrieRoot.data(), txTrieRoot.size());
+    const auto parentHash = parse_hex("00000000003cb800a7e69e9144e3d16f0cf33f33a95c7ce274097822c67243c1");
+    blockHeader.set_parent_hash(parentHash.data(), parentHash.size());
+    blockHeader.set_number(3979265);
+    const auto witnessAddress = parse_hex("41b487cdc02de90f15ac89a68c82f44cbfe3d915ea");
+    blockHeader.set_witness_address(witnessAddress.data(), witnessAddress.size());
+    blockHeader.set_version(3);
+
+    const auto key = parse_hex("2d8f68944bdbfbc0769542fba8fc2d2a3de67393334471624364c7006da2aa54");
+    input.set_private_key(key.data(), key.size());
+    return serialize(input);
+}
+
+Data vechain() {
+    auto key = parse_hex("4646464646464646464646464646464646464646464646464646464646464646");
+    auto amount = parse_hex("31303030");
+    VeChain::Proto::SigningInput input;
+    input.set_chain_tag(1);
+    input.set_block_ref(1);
+    input.set_expiration(1);
+    input.set_gas_price_coef(0);
+    input.set_gas(21000);
+    input.set_nonce(1);
+    input.set_private_key(key.data(), key.size());
+    auto& clause = *input.add_clauses();
+    clause.set_to("0x3535353535353535353535353535353535353535");
+    clause.set_value(amount.data(), amount.size());
+    return serialize(input);
+}
+
+Data waves() {
+    auto key = Base58::bitcoin.decode("83mqJpmgB5Mko1567sVAdqZxVKsT6jccXt3eFSi4G1zE");
+    Waves::Proto::SigningInput input;
+    input.set_timestamp(int64_t(1559146613));
+    input.set_private_key(key.data(), key.size());
+    auto& message = *input.mutable_transfer_message();
+    message.set_amount(int64_t(100000000));
+    message.set_asset("DacnEpaUVFRCYk8Fcd1F3cqUZuT4XG7qW9mRyoZD81zq");
+    message.set_fee(int64_t(100000));
+    message.set_fee_asset("DacnEpaUVFRCYk8Fcd1F3cqUZuT4XG7qW9mRyoZD81zq");
+    message.set_to("3PPCZQkvdMJpmx7Zrz1cnYsPe9Bt1XT2Ckx");
+    message.set_attachment("hello");
+    return serialize(input);
+}
+
+Data zilliqa() {
+    auto key = parse_hex("68ffa8ec149ce50da647166036555f73d57f662eb420e154621e5f24f6cf9748");
+    auto amount = store(uint256_t(1000000000000));
+    auto gasPrice = store(uint256_t(1000000000));
+    Zilliqa::Proto::SigningInput input;
+    input.set_version(65537);
+    input.set_nonce(2);
+    input.set_to("zil10lx2eurx5hexaca0lshdr75czr025cevqu83uz");
+    input.set_gas_price(gasPrice.data(), gasPrice.size());
+    input.set_gas_limit(1);
+    input.set_private_key(key.data(), key.size());
+    input.mutable_transaction()->mutable_transfer()->set_amount(amount.data(), amount.size());
+    return serialize(input);
+}
+
+} // namespace
+
+Bitcoin::Proto::SigningInput bitcoin(size_t count) {
+    const auto key = parse_hex("bbc27228ddcb9209d7fd6f36b02f7dfa6252af40bb2f1cbc7a557da8027ff866");
+    const auto keyHash = Hash::sha256ripemd(PrivateKey(key).getPublicKey(TWPublicKeyTypeSECP256k1).bytes.data(), 33);
+    auto script = parse_hex("0014");
+    append(script, keyHash);
+
+    Bitcoin::Proto::SigningInput input;
+    input.set_hash_type(Bitcoin::hashTypeForCoin(TWCoinTypeBitcoin));
+    input.set_amount(count * 10'000);
+    input.set_use_max_amount(true);
+    input.set_byte_fee(1);
+    input.set_to_address("1Bp9U1ogV3A14FMvKbRJms7ctyso4Z4Tcx");
+    input.set_change_address("1FQc5LdgGHMHEN9nwkjmz6tWkxhPpxBvBU");
+    input.set_coin_type(TWCoinTypeBitcoin);
+    input.add_private_key(key.data(), key.size());
+    for (size_t i = 0; i < count; ++i) {
+        const auto hash = Hash::sha256(store(uint256_t(i)));
+        auto utxo = input.add_utxo();
+        utxo->set_script(script.data(), script.size());
+        utxo->set_amount(10'000);
+        utxo->mutable_out_point()->set_hash(hash.data(), hash.size());
+        utxo->mutable_out_point()->set_index(0);
+        utxo->mutable_out_point()->set_sequence(UINT32_MAX);
+    }
+    return input;
+}
+
+Data forCoin(TWCoinType coin) {
+    switch (coin) {
+    case TWCoinTypeBitcoin: return serialize(bitcoin(2));
+    case TWCoinTypeDecred: return decred();
+    case TWCoinTypeGroestlcoin: return groestlcoin();
+    case TWCoinTypeKin: return stellar(TWStellarPassphrase_Kin);
+    case TWCoinTypeKusama: return kusama();
+    case TWCoinTypeTHORChain: return thorchain();
+    default: break;
+    }
+
+    switch (blockchain(coin)) {
+    case TWBlockchainAeternity: return aeternity();
+    case TWBlockchainAion: return aion();
+    case TWBlockchainAlgorand: return algorand();
+    case TWBlockchainBinance: return binance();
+    case TWBlockchainBitcoin: return bitcoinFamily(coin);
+    case TWBlockchainCosmos: return cosmos(coin);
+    case TWBlockchainElrondNetwork: return elrond();
+    case TWBlockchainEOS: return eos();
+    case TWBlockchainEthereum: return ethereum();
+    case TWBlockchainFilecoin: return filecoin();
+    case TWBlockchainFIO: return fio();
+    case TWBlockchainHarmony: return harmony();
+    case TWBlockchainIcon: return icon();
+    case TWBlockchainIoTeX: return iotex();
+    case TWBlockchainNano: return nano();
+    case TWBlockchainNEAR: return near();
+    case TWBlockchainNebulas: return nebulas();
+    case TWBlockchainNEO: return neo();
+    case TWBlockchainNimiq: return nimiq();
+    case TWBlockchainNULS: return nuls();
+    case TWBlockchainOasisNetwork: return oasis();
+    case TWBlockchainOntology: return ontology();
+    case TWBlockchainPolkadot: return polkadot();
+    case TWBlockchainRipple: return ripple();
+    case TWBlockchainSolana: return solana();
+    case TWBlockchainStellar: return stellar(TWStellarPassphrase_Stellar);
+    case TWBlockchainTezos: return tezos();
+    case TWBlockchainTheta: return theta();
+    case TWBlockchainTron: return tron();
+    case TWBlockchainVechain: return vechain();
+    case TWBlockchainWaves: return waves();
+    case TWBlockchainZilliqa: return zilliqa();
+    default: return {};
+    }
+}
+
+} // namespace TW::SigningInputs
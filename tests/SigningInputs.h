@@ -0,0 +1,34 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#pragma once
+
+#include "Data.h"
+#include "proto/Bitcoin.pb.h"
+
+#include <TrustWalletCore/TWCoinType.h>
+
+#include <cstddef>
+
+/// Signing inputs for every coin, taken from the signing tests of each coin.
+/// Shared by the tests, the benchmarks and the concurrency stress tests.
+namespace TW::SigningInputs {
+
+/// Serialized signing input of the coin, for anyCoinSign.
+/// Empty for the coins without a signer (Cardano, TON).
+Data forCoin(TWCoinType coin);
+
+/// Bitcoin transfer spending `count` P2WPKH outputs of the same key.
+Bitcoin::Proto::SigningInput bitcoin(size_t count);
+
+/// Serializes a protobuf message into a Data buffer.
+template <typename Message>
+Data serialize(const Message& message) {
+    const auto string = message.SerializeAsString();
+    return Data(string.begin(), string.end());
+}
+
+} // namespace TW::SigningInputs
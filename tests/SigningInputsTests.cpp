@@ -0,0 +1,29 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+#include "SigningInputs.h"
+
+#include "Coin.h"
+
+#include <gtest/gtest.h>
+
+using namespace TW;
+
+TEST(SigningInputs, SignsEveryCoin) {
+    for (const auto coin : getCoinTypes()) {
+        const auto input = SigningInputs::forCoin(coin);
+        if (coin == TWCoinTypeCardano || coin == TWCoinTypeTON) {
+            EXPECT_TRUE(input.empty()) << coin;
+            continue;
+        }
+        ASSERT_FALSE(input.empty()) << coin;
+
+        Data output;
+        anyCoinSign(coin, input, output);
+        // at least the signature of the transaction
+        EXPECT_GE(output.size(), 64ul) << coin;
+    }
+}
@@ -68,13 +68,13 @@ TEST(SolanaSigner, CompiledInstructionFindAccount) {
         address2,
         programId,
     };
-    CompiledInstruction compiledInstruction = CompiledInstruction(instruction, addresses);
-    ASSERT_EQ(compiledInstruction.findAccount(address1), 0);
-    ASSERT_EQ(compiledInstruction.findAccount(address2), 1);
-    ASSERT_EQ(compiledInstruction.findAccount(programId), 2);
+    const auto index = CompiledInstruction::indexAddresses(addresses);
+    ASSERT_EQ(CompiledInstruction::findAccount(index, address1), 0);
+    ASSERT_EQ(CompiledInstruction::findAccount(index, address2), 1);
+    ASSERT_EQ(CompiledInstruction::findAccount(index, programId), 2);
     // negative case
     try {
-        compiledInstruction.findAccount(address3);
+        CompiledInstruction::findAccount(index, address3);
         FAIL() << "Missing expected exception";
     } catch (...) {
         // ok
@@ -389,3 +389,70 @@ TEST(SolanaSigner, SignTransferToken) {
         "PGfKqEaH2zZXDMZLcU6LUKdBSzU1GJWJ1CJXtRYCxaCH7k8uok38WSadZfrZw3TGejiau7nSpan2GvbK26hQim24jRe2AupmcYJFrgsdaCt1Aqs5kpGjPqzgj9krgxTZwwob3xgC1NdHK5BcNwhxwRtrCphGEH7zUFpGFrFrHzgpf2KY8FvPiPELQyxzTBuyNtjLjMMreehSKShEjD9Xzp1QeC1pEF8JL6vUKzxMXuveoEYem8q8JiWszYzmTMfDk13JPgv7pXFGMqDV3yNGCLsWccBeSFKN4UKECre6x2QbUEiKGkHkMc4zQwwyD8tGmEMBAGm339qdANssEMNpDeJp2LxLDStSoWShHnotcrH7pUa94xCVvCPPaomF";
     EXPECT_EQ(transaction.serialize(), expectedString);
 }
+
+TEST(SolanaSigner, SignBatchTransfer) {
+    const auto privateKey = PrivateKey(Base58::bitcoin.decode("A7psj2GW7ZMdY4E5hJq14KMeYg7HFjULSsWSrTXZLvYr"));
+
+    auto input = Proto::SigningInput();
+    input.set_private_key(privateKey.bytes.data(), privateKey.bytes.size());
+    input.set_recent_blockhash("11111111111111111111111111111111");
+    auto& batch = *input.mutable_batch_transfer_transaction();
+    for (uint8_t i = 0; i < 30; ++i) {
+        auto& transfer = *batch.add_transfers();
+        transfer.set_recipient(Address(Data(32, i + 1)).string());
+        transfer.set_value(1000 + i);
+    }
+
+    const auto output = Signer::sign(input);
+    // 21 transfers to distinct recipients fit in a packet
+    ASSERT_EQ(output.encoded_batch_size(), 2);
+    EXPECT_EQ(output.encoded(), output.encoded_batch(0));
+
+    for (const auto& encoded: output.encoded_batch()) {
+        const auto data = Base58::bitcoin.decode(encoded);
+        EXPECT_LE(data.size(), PACKET_DATA_SIZE);
+        // 1 signature, followed by the message it signs
+        ASSERT_EQ(data[0], 1);
+        const auto signature = Data(data.begin() + 1, data.begin() + 65);
+        const auto message = Data(data.begin() + 65, data.end());
+        EXPECT_EQ(signature, privateKey.sign(message, TWCurveED25519));
+    }
+    EXPECT_EQ(Base58::bitcoin.decode(output.encoded_batch(0)).size(), 166 + 49 * 21);
+    EXPECT_EQ(Base58::bitcoin.decode(output.encoded_batch(1)).size(), 166 + 49 * 9);
+
+    // a single transfer is the same as a plain transfer
+    batch.mutable_transfers()->DeleteSubrange(1, 29);
+    auto transferInput = Proto::SigningInput();
+    transferInput.set_private_key(privateKey.bytes.data(), privateKey.bytes.size());
+    transferInput.set_recent_blockhash("11111111111111111111111111111111");
+    transferInput.mutable_transfer_transaction()->set_recipient(Address(Data(32, 1)).string());
+    transferInput.mutable_transfer_transaction()->set_value(1000);
+    EXPECT_EQ(Signer::sign(input).encoded(), Signer::sign(transferInput).encoded());
+}
+
+TEST(SolanaSigner, SignVersionedBatchTransfer) {
+    const auto privateKey = PrivateKey(Base58::bitcoin.decode("A7psj2GW7ZMdY4E5hJq14KMeYg7HFjULSsWSrTXZLvYr"));
+
+    auto input = Proto::SigningInput();
+    input.set_private_key(privateKey.bytes.data(), privateKey.bytes.size());
+    input.set_recent_blockhash("11111111111111111111111111111111");
+    auto& batch = *input.mutable_batch_transfer_transaction();
+    auto& table = *batch.add_address_lookup_tables();
+    table.set_account(Address(Data(32, 0xff)).string());
+    for (uint8_t i = 0; i < 30; ++i) {
+        const auto recipient = Address(Data(32, i + 1)).string();
+        table.add_addresses(recipient);
+        auto& transfer = *batch.add_transfers();
+        transfer.set_recipient(recipient);
+        transfer.set_value(1000 + i);
+    }
+
+    const auto output = Signer::sign(input);
+    // all the transfers fit in a single V0 transaction
+    ASSERT_EQ(output.encoded_batch_size(), 1);
+    const auto data = Base58::bitcoin.decode(output.encoded());
+    ASSERT_EQ(data[0], 1);
+    const auto message = Data(data.begin() + 65, data.end());
+    EXPECT_EQ(message[0], 0x80);
+    EXPECT_EQ(Data(data.begin() + 1, data.begin() + 65), privateKey.sign(message, TWCurveED25519));
+}
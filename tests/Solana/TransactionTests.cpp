@@ -159,3 +159,176 @@ TEST(SolanaTransaction, TransferTokenTransaction) {
         "PGfKqEaH2zZXDMZLcU6LUKdBSzU1GJWJ1CJXtRYCxaCH7k8uok38WSadZfrZw3TGejiau7nSpan2GvbK26hQim24jRe2AupmcYJFrgsdaCt1Aqs5kpGjPqzgj9krgxTZwwob3xgC1NdHK5BcNwhxwRtrCphGEH7zUFpGFrFrHzgpf2KY8FvPiPELQyxzTBuyNtjLjMMreehSKShEjD9Xzp1QeC1pEF8JL6vUKzxMXuveoEYem8q8JiWszYzmTMfDk13JPgv7pXFGMqDV3yNGCLsWccBeSFKN4UKECre6x2QbUEiKGkHkMc4zQwwyD8tGmEMBAGm339qdANssEMNpDeJp2LxLDStSoWShHnotcrH7pUa94xCVvCPPaomF";
     EXPECT_EQ(transaction.serialize(), expectedString);
 }
+
+TEST(SolanaTransaction, MergedAccountFlags) {
+    auto signer = Address("B1iGmDJdvmxyUiYM8UEo2Uw2D58EmUrw4KyLYMmrhf8V");
+    auto account1 = Address("EDNd1ycsydWYwVmrYZvqYazFqwk1QjBgAUKFjBoz1jKP");
+    auto account2 = Address("3WUX9wASxyScbA7brDipioKfXS1XEYkQ4vo3Kej9bKei");
+    auto programId = Address(TOKEN_PROGRAM_ID_ADDRESS);
+    Message message;
+    // account1 is read-only then writable, account2 is writable then signer
+    message.instructions.emplace_back(programId, std::vector<AccountMeta>{
+        AccountMeta(account1, false, true),
+        AccountMeta(account2, false, false),
+        AccountMeta(signer, true, false),
+    }, Data{1});
+    message.instructions.emplace_back(programId, std::vector<AccountMeta>{
+        AccountMeta(account1, false, false),
+        AccountMeta(account2, true, false),
+    }, Data{2});
+    message.compileAccounts();
+
+    EXPECT_EQ(message.header.numRequiredSignatures, 2);
+    EXPECT_EQ(message.header.numCreditOnlyUnsignedAccounts, 1);
+    ASSERT_EQ(message.accountKeys.size(), 4);
+    // signers by first signing use: the first signer (the fee payer) stays first
+    EXPECT_EQ(message.accountKeys[0], signer);
+    EXPECT_EQ(message.accountKeys[1], account2);
+    EXPECT_EQ(message.accountKeys[2], account1);
+    EXPECT_EQ(message.accountKeys[3], programId);
+    ASSERT_EQ(message.compiledInstructions.size(), 2);
+    EXPECT_EQ(message.compiledInstructions[0].programIdIndex, 3);
+    EXPECT_EQ(message.compiledInstructions[0].accounts, (std::vector<uint8_t>{2, 1, 0}));
+    EXPECT_EQ(message.compiledInstructions[1].accounts, (std::vector<uint8_t>{2, 1}));
+}
+
+TEST(SolanaTransaction, BatchTransfers) {
+    auto from = Address("6eoo7i1khGhVm8tLBMAdq4ax2FxkKP4G7mCcfHyr3STN");
+    auto to = Address("56B334QvCDMSirsmtEJGfanZm8GqeQarrSjdAb2MbeNM");
+    Solana::Hash recentBlockhash("11111111111111111111111111111111");
+
+    // a single transfer makes the same message as a plain transfer
+    auto single = Transaction::batchTransfers(from, {{to, 42}}, recentBlockhash);
+    ASSERT_EQ(single.size(), 1);
+    EXPECT_EQ(hex(single[0].messageData()), hex(Transaction(from, to, 42, recentBlockhash).messageData()));
+
+    // the recipient key is shared by all the transfers: 60 fit in a packet
+    std::vector<std::pair<Address, uint64_t>> transfers(100, {to, 1});
+    auto transactions = Transaction::batchTransfers(from, transfers, recentBlockhash);
+    ASSERT_EQ(transactions.size(), 2);
+    EXPECT_EQ(transactions[0].message.instructions.size(), 60);
+    EXPECT_EQ(transactions[0].message.accountKeys.size(), 3);
+    EXPECT_EQ(transactions[1].message.instructions.size(), 40);
+    for (const auto& transaction: transactions) {
+        EXPECT_LE(Base58::bitcoin.decode(transaction.serialize()).size(), PACKET_DATA_SIZE);
+    }
+    // the 61st transfer would not fit
+    EXPECT_GT(Base58::bitcoin.decode(Transaction(Message(from,
+        std::vector<std::pair<Address, uint64_t>>(61, {to, 1}), recentBlockhash)).serialize()).size(), PACKET_DATA_SIZE);
+
+    EXPECT_TRUE(Transaction::batchTransfers(from, {}, recentBlockhash).empty());
+}
+
+TEST(SolanaTransaction, VersionedTransferMessageData) {
+    auto from = Address("6eoo7i1khGhVm8tLBMAdq4ax2FxkKP4G7mCcfHyr3STN");
+    auto to = Address("56B334QvCDMSirsmtEJGfanZm8GqeQarrSjdAb2MbeNM");
+    auto other = Address(Data(32, 1));
+    auto table = AddressLookupTable(Address(Data(32, 7)), {other, to});
+    Solana::Hash recentBlockhash("11111111111111111111111111111111");
+    auto message = Message(from, {{to, 42}}, recentBlockhash, {table});
+
+    EXPECT_EQ(message.version, MessageVersion::V0);
+    ASSERT_EQ(message.accountKeys.size(), 2);
+    ASSERT_EQ(message.loadedAddresses.size(), 1);
+    EXPECT_EQ(message.loadedAddresses[0], to);
+    ASSERT_EQ(message.addressTableLookups.size(), 1);
+    EXPECT_EQ(message.addressTableLookups[0].writableIndexes, (std::vector<uint8_t>{1}));
+    EXPECT_TRUE(message.addressTableLookups[0].readonlyIndexes.empty());
+
+    auto expectedHex =
+        // version 0, header
+        "80" "010001"
+        // static keys: sender, system program
+        "02" "53f9d600fe925083bb399907ea648d23a6a081fc7e9059202fd725f7edd281dd"
+        "0000000000000000000000000000000000000000000000000000000000000000"
+        // recent blockhash
+        "0000000000000000000000000000000000000000000000000000000000000000"
+        // transfer, the recipient is the first loaded account
+        "01" "01" "02" "0002" "0c" "020000002a00000000000000"
+        // lookup: table key, writable indices, read-only indices
+        "01" "0707070707070707070707070707070707070707070707070707070707070707" "0101" "00";
+    EXPECT_EQ(hex(Transaction(message).messageData()), expectedHex);
+}
+
+TEST(SolanaTransaction, LegacyMessageCompiledWithLookupTables) {
+    auto from = Address("6eoo7i1khGhVm8tLBMAdq4ax2FxkKP4G7mCcfHyr3STN");
+    auto to = Address("56B334QvCDMSirsmtEJGfanZm8GqeQarrSjdAb2MbeNM");
+    auto table = AddressLookupTable(Address(Data(32, 7)), {Address(Data(32, 1)), to});
+    Solana::Hash recentBlockhash("11111111111111111111111111111111");
+    auto message = Message(from, {{to, 42}}, recentBlockhash);
+    ASSERT_EQ(message.version, MessageVersion::Legacy);
+
+    // loading the recipient from the table makes it a versioned message
+    message.compileAccounts({table});
+    EXPECT_EQ(message.version, MessageVersion::V0);
+    const auto messageData = hex(Transaction(message).messageData());
+    EXPECT_EQ(messageData.substr(0, 2), "80");
+    // lookup: table key, writable indices, read-only indices
+    const auto lookups = "01" "0707070707070707070707070707070707070707070707070707070707070707" "0101" "00";
+    EXPECT_EQ(messageData.substr(messageData.size() - 72), lookups);
+    EXPECT_EQ(messageData, hex(Transaction(Message(from, {{to, 42}}, recentBlockhash, {table})).messageData()));
+}
+
+TEST(SolanaTransaction, VersionedProgramAndSignerStayStatic) {
+    auto signer = Address("B1iGmDJdvmxyUiYM8UEo2Uw2D58EmUrw4KyLYMmrhf8V");
+    auto token = Address("SRMuApVNdxXokk5GT7XD5cUUgXMBCoAz2LHeuAoKWRt");
+    auto senderTokenAddress = Address("EDNd1ycsydWYwVmrYZvqYazFqwk1QjBgAUKFjBoz1jKP");
+    auto recipientTokenAddress = Address("3WUX9wASxyScbA7brDipioKfXS1XEYkQ4vo3Kej9bKei");
+    auto programId = Address(TOKEN_PROGRAM_ID_ADDRESS);
+    auto table = AddressLookupTable(Address(Data(32, 7)), {signer, programId, token, recipientTokenAddress});
+    Solana::Hash recentBlockhash("CNaHfvqePgGYMvtYi9RuUdVxDYttr1zs4TWrTXYabxZi");
+    auto message = Message(signer, TokenInstruction::TokenTransfer, token, senderTokenAddress, recipientTokenAddress, 4000, 6, recentBlockhash);
+    message.version = MessageVersion::V0;
+    message.compileAccounts({table});
+
+    // signer, sender token account, program
+    ASSERT_EQ(message.accountKeys.size(), 3);
+    EXPECT_EQ(message.accountKeys[0], signer);
+    EXPECT_EQ(message.accountKeys[1], senderTokenAddress);
+    EXPECT_EQ(message.accountKeys[2], programId);
+    EXPECT_EQ(message.header.numCreditOnlyUnsignedAccounts, 1);
+    // writable recipient token account, then read-only mint
+    ASSERT_EQ(message.addressTableLookups.size(), 1);
+    EXPECT_EQ(message.addressTableLookups[0].writableIndexes, (std::vector<uint8_t>{3}));
+    EXPECT_EQ(message.addressTableLookups[0].readonlyIndexes, (std::vector<uint8_t>{2}));
+    ASSERT_EQ(message.loadedAddresses.size(), 2);
+    EXPECT_EQ(message.loadedAddresses[0], recipientTokenAddress);
+    EXPECT_EQ(message.loadedAddresses[1], token);
+    ASSERT_EQ(message.compiledInstructions.size(), 1);
+    EXPECT_EQ(message.compiledInstructions[0].programIdIndex, 2);
+    EXPECT_EQ(message.compiledInstructions[0].accounts, (std::vector<uint8_t>{1, 4, 3, 0}));
+}
+
+TEST(SolanaTransaction, VersionedBatchTransfers) {
+    auto from = Address("6eoo7i1khGhVm8tLBMAdq4ax2FxkKP4G7mCcfHyr3STN");
+    Solana::Hash recentBlockhash("11111111111111111111111111111111");
+    std::vector<Address> recipients;
+    std::vector<std::pair<Address, uint64_t>> transfers;
+    for (uint8_t i = 0; i < 100; ++i) {
+        recipients.emplace_back(Data(32, i + 1));
+        transfers.emplace_back(recipients.back(), 1000 + i);
+    }
+
+    // without a table, 21 transfers to distinct recipients fit in a packet
+    EXPECT_EQ(Transaction::batchTransfers(from, transfers, recentBlockhash).size(), 5);
+
+    // loaded from a table, each recipient takes a byte instead of a key: 57 fit
+    auto table = AddressLookupTable(Address(Data(32, 0xff)), recipients);
+    auto transactions = Transaction::batchTransfers(from, transfers, recentBlockhash, {table});
+    ASSERT_EQ(transactions.size(), 2);
+    EXPECT_EQ(transactions[0].message.instructions.size(), 57);
+    EXPECT_EQ(transactions[1].message.instructions.size(), 43);
+    EXPECT_EQ(Base58::bitcoin.decode(transactions[0].serialize()).size(), 202 + 18 * 57);
+    EXPECT_GT(202 + 18 * 58, PACKET_DATA_SIZE);
+    for (const auto& transaction: transactions) {
+        EXPECT_EQ(transaction.message.version, MessageVersion::V0);
+        EXPECT_EQ(transaction.message.accountKeys.size(), 2);
+    }
+
+    // a recipient missing from the table is a key of the message
+    auto partialTable = AddressLookupTable(Address(Data(32, 0xff)), {recipients.begin() + 1, recipients.end()});
+    transactions = Transaction::batchTransfers(from, {transfers.begin(), transfers.begin() + 3}, recentBlockhash, {partialTable});
+    ASSERT_EQ(transactions.size(), 1);
+    EXPECT_EQ(transactions[0].message.accountKeys.size(), 3);
+    EXPECT_EQ(transactions[0].message.loadedAddresses.size(), 2);
+}
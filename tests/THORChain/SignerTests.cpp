@@ -5,6 +5,7 @@
 // file LICENSE at the root of the source code distribution tree.
 
 #include "proto/Cosmos.pb.h"
+#include "Cosmos/ProtobufSerialization.h"
 #include "THORChain/Signer.h"
 #include "HexCoding.h"
 
@@ -53,3 +54,53 @@ TEST(THORChainSigner, SignJson) {
 
     EXPECT_EQ(R"({"mode":"block","tx":{"fee":{"amount":[{"amount":"200","denom":"rune"}],"gas":"2000000"},"memo":"memo1234","msg":[{"type":"thorchain/MsgSend","value":{"amount":[{"amount":"50000000","denom":"rune"}],"from_address":"thor1z53wwe7md6cewz9sqwqzn0aavpaun0gw0exn2r","to_address":"thor1e2ryt8asq4gu0h6z2sx9u7rfrykgxwkmr9upxn"}}],"signatures":[{"pub_key":{"type":"tendermint/PubKeySecp256k1","value":"A+2Zfjls9CkvX85aQrukFZnM1dluMTFUp8nqcEneMXx3"},"signature":"12AaNC0v51Rhz8rBf7V7rpI6oksREWrjzba3RK1v1NNlqZq62sG0aXWvStp9zZXe07Pp2FviFBAx+uqWsO30NQ=="}]}})", outputJson);
 }
+
+TEST(THORChainSigner, SignTxProtobuf) {
+    auto input = Cosmos::Proto::SigningInput();
+    input.set_signing_mode(Cosmos::Proto::Protobuf);
+    input.set_chain_id("thorchain");
+    input.set_account_number(593);
+    input.set_sequence(21);
+    input.set_memo("memo1234");
+
+    auto msg = input.add_messages();
+    auto& message = *msg->mutable_send_coins_message();
+    message.set_from_address("thor1z53wwe7md6cewz9sqwqzn0aavpaun0gw0exn2r");
+    message.set_to_address("thor1e2ryt8asq4gu0h6z2sx9u7rfrykgxwkmr9upxn");
+    auto amountOfTx = message.add_amounts();
+    amountOfTx->set_denom("rune");
+    amountOfTx->set_amount(50000000);
+
+    auto& fee = *input.mutable_fee();
+    fee.set_gas(2000000);
+    auto amountOfFee = fee.add_amounts();
+    amountOfFee->set_denom("rune");
+    amountOfFee->set_amount(200);
+
+    auto privateKey = parse_hex("7105512f0c020a1dd759e14b865ec0125f59ac31e34d7a2807a228ed50cb343e");
+    input.set_private_key(privateKey.data(), privateKey.size());
+
+    auto output = THORChain::Signer::sign(input);
+
+    // THORChain's MsgSend, with the account bytes of the addresses
+    EXPECT_EQ(output.error(), "");
+    const auto body = hex(Cosmos::buildProtoTxBody(input));
+    EXPECT_EQ(body,
+        "0a50" "0a0e" "2f74797065732e4d736753656e64" "123e"
+        "0a14" "1522e767db6eb19708b0038029bfbd607bc9bd0e"
+        "1214" "ca86459fb00551c7df42540c5e7869192c833adb"
+        "1a10" "0a0472756e65" "12083530303030303030"
+        "1208" "6d656d6f31323334");
+    EXPECT_NE(hex(output.serialized()).find(body), std::string::npos);
+}
+
+TEST(THORChainSigner, SignTxProtobufUnknownPrefix) {
+    auto input = Cosmos::Proto::SigningInput();
+    input.set_signing_mode(Cosmos::Proto::Protobuf);
+    auto& message = *input.add_messages()->mutable_send_coins_message();
+    message.set_from_address("thor1z53wwe7md6cewz9sqwqzn0aavpaun0gw0exn2r");
+    message.set_to_address("thor1e2ryt8asq4gu0h6z2sx9u7rfrykgxwkmr9upxn");
+    message.set_type_prefix("other/MsgSend");
+
+    EXPECT_THROW(Cosmos::buildProtoTxBody(input), std::invalid_argument);
+}
@@ -256,4 +256,81 @@ TEST(TONCell, CellStateInit2)
         EXPECT_EQ("b5ee9c7241010301007e00020134010200a2ff0020dd2082014c97ba9730ed44d0d70b1fe0a4f260810200d71820d70b1fed44d0d31fd3ffd15112baf2a122f901541044f910f2a2f80001d31f3120d74a96d307d402fb00ded1a4c8cb1fcbffc9ed5400480000000037f14c50f6435b11b9326e1218524f7f072d0a5ea8221cca71682e7d6ed6421381c553bd",
             hex(ser));
     }
-}
\ No newline at end of file
+}
+
+TEST(TONCell, CellDeduplication)
+{
+    // two identical children, in distinct objects, are stored once
+    auto c1 = std::make_shared<Cell>();
+    c1->setSliceBytesStr("123456");
+    auto c2 = std::make_shared<Cell>();
+    c2->setSliceBytesStr("123456");
+    Cell c;
+    c.addCell(c1);
+    c.addCell(c2);
+    EXPECT_EQ("bdc230713cf997da2a05689058b3b87cb2e8b475187e1bf93a92575bbd10e132", hex(c.hash()));
+    EXPECT_EQ(1, c.depth());
+    EXPECT_EQ(20, c.serializedSize());
+    Data ser;
+    c.serialize(ser);
+    EXPECT_EQ("b5ee9c7201010201000900" "02000101" "0006123456", hex(ser));
+}
+
+TEST(TONCell, CellDag)
+{
+    // leaf referenced from two levels, and a middle cell referenced from two parents
+    auto leaf = std::make_shared<Cell>();
+    leaf->setSliceBytesStr("123456");
+    auto a = std::make_shared<Cell>();
+    a->addCell(leaf);
+    auto b = std::make_shared<Cell>();
+    b->addCell(a);
+    b->addCell(leaf);
+    Cell c;
+    c.addCell(b);
+    c.addCell(a);
+    EXPECT_EQ("0e931beb9cd10a6ba47bcd07b696a41ed4bae169d160d2eaeeb9d6c875df7fa9", hex(c.hash()));
+    EXPECT_EQ(3, c.depth());
+    EXPECT_EQ(2, b->depth());
+    EXPECT_EQ(0, leaf->depth());
+
+    const auto mode = static_cast<Cell::SerializationMode>(
+        Cell::SerializationMode::WithIndex | Cell::SerializationMode::WithCRC32C | Cell::SerializationMode::WithCacheBits);
+    EXPECT_EQ(35, c.serializedSize(mode));
+    Data ser;
+    c.serialize(ser, mode);
+    // cells in order c, b, a, leaf; index with cache bits set for a and leaf
+    EXPECT_EQ("b5ee9c72e101040100100008101721" "02000102" "02000203" "010003" "0006123456" "2d9365eb", hex(ser));
+
+    // the hash is cached, and recomputed after a change
+    c.setSliceBytesStr("FEDCBA");
+    EXPECT_NE("0e931beb9cd10a6ba47bcd07b696a41ed4bae169d160d2eaeeb9d6c875df7fa9", hex(c.hash()));
+}
+
+TEST(TONCell, CellDeepDag)
+{
+    // each level references the level below twice: 2^64 paths, but 65 distinct cells
+    auto cell = std::make_shared<Cell>();
+    cell->setSliceBytesStr("123456");
+    for (int i = 0; i < 64; ++i) {
+        auto parent = std::make_shared<Cell>();
+        parent->addCell(cell);
+        parent->addCell(cell);
+        cell = parent;
+    }
+    EXPECT_EQ("8c05406ff546aca3fc42de4228714b898e53a874cb187671dee9cb5d4f6fcd92", hex(cell->hash()));
+    EXPECT_EQ(64, cell->depth());
+    Data ser;
+    cell->serialize(ser);
+    EXPECT_EQ(cell->serializedSize(), ser.size());
+    EXPECT_EQ(65, ser[6]); // cell count
+}
+
+TEST(TONCell, CellSerializationModeError)
+{
+    Cell c;
+    c.setSliceBytesStr("123456");
+    Data ser;
+    EXPECT_THROW(c.serialize(ser, Cell::SerializationMode::WithTopHash), std::invalid_argument);
+    EXPECT_THROW(c.serialize(ser, Cell::SerializationMode::WithCacheBits), std::invalid_argument);
+}
@@ -6,6 +6,7 @@
 
 #include "TWTestUtilities.h"
 
+#include "BinaryCoding.h"
 #include "HexCoding.h"
 #include <TrustWalletCore/TWAnyAddress.h>
 #include <TrustWalletCore/TWCoinType.h>
@@ -24,6 +25,36 @@ TEST(AnyAddress, InvalidString) {
     ASSERT_EQ(TWAnyAddressCoin(ethAaddress.get()), TWCoinTypeEthereum);
 }
 
+TEST(AnyAddress, ValidateBatch) {
+    const std::vector<std::string> addresses = {
+        "bitcoincash:qzxf0wl63ahx6jsxu8uuldcw7n5aatwppvnteraqaw",
+        "0x4E5B2e1dc63F6b91cb6Cd759936495434C7e972F",
+        "",
+        "qzxf0wl63ahx6jsxu8uuldcw7n5aatwppvnteraqaw",
+    };
+    Data input;
+    for (const auto& address : addresses) {
+        encodeLengthPrefixed(address, input);
+    }
+    auto inputData = WRAPD(TWDataCreateWithBytes(input.data(), input.size()));
+
+    auto bits = WRAPD(TWAnyAddressValidateBatch(inputData.get(), TWCoinTypeBitcoinCash, false, 2));
+    assertHexEqual(bits, "09");
+
+    auto normalized = WRAPD(TWAnyAddressValidateBatch(inputData.get(), TWCoinTypeBitcoinCash, true, 2));
+    const auto expected = "09"
+        "36000000" + hex(std::string("bitcoincash:qzxf0wl63ahx6jsxu8uuldcw7n5aatwppvnteraqaw")) +
+        "00000000"
+        "00000000"
+        "36000000" + hex(std::string("bitcoincash:qzxf0wl63ahx6jsxu8uuldcw7n5aatwppvnteraqaw"));
+    assertHexEqual(normalized, expected.c_str());
+
+    // truncated input
+    input.pop_back();
+    auto truncated = WRAPD(TWDataCreateWithBytes(input.data(), input.size()));
+    EXPECT_EQ(TWAnyAddressValidateBatch(truncated.get(), TWCoinTypeBitcoinCash, false, 1), nullptr);
+}
+
 TEST(AnyAddress, Data) {
     // ethereum
     {
@@ -35,7 +35,7 @@ TEST(TWPublicKeyTests, CreateFromPrivateSecp256k1) {
     auto publicKeyData = WRAPD(TWPublicKeyData(publicKey.get()));
     EXPECT_EQ(hex(*((Data*)(publicKeyData.get()))), "0399c6f51ad6f98c9c583f8e92bb7758ab2ca9a04110c0a1126ec43e5453d196c1");
     EXPECT_EQ(*((std::string*)(WRAPS(TWPublicKeyDescription(publicKey.get())).get())), "0399c6f51ad6f98c9c583f8e92bb7758ab2ca9a04110c0a1126ec43e5453d196c1");
-    EXPECT_TRUE(TWPublicKeyIsValid(publicKey.get(), TWPublicKeyTypeSECP256k1));
+    EXPECT_TRUE(TWPublicKeyIsValid(WRAPD(TWPublicKeyData(publicKey.get())).get(), TWPublicKeyTypeSECP256k1));
     EXPECT_TRUE(TWPublicKeyIsCompressed(publicKey.get()));
 }
 
@@ -51,20 +51,20 @@ TEST(TWPublicKeyTests, CompressedExtended) {
     EXPECT_EQ(TWPublicKeyKeyType(publicKey.get()), TWPublicKeyTypeSECP256k1);
     EXPECT_EQ(publicKey.get()->impl.bytes.size(), 33);
     EXPECT_EQ(TWPublicKeyIsCompressed(publicKey.get()), true);
-    EXPECT_TRUE(TWPublicKeyIsValid(publicKey.get(), TWPublicKeyTypeSECP256k1));
+    EXPECT_TRUE(TWPublicKeyIsValid(WRAPD(TWPublicKeyData(publicKey.get())).get(), TWPublicKeyTypeSECP256k1));
 
     auto extended = WRAP(TWPublicKey, TWPublicKeyUncompressed(publicKey.get()));
     EXPECT_EQ(TWPublicKeyKeyType(extended.get()), TWPublicKeyTypeSECP256k1Extended);
     EXPECT_EQ(extended.get()->impl.bytes.size(), 65);
     EXPECT_EQ(TWPublicKeyIsCompressed(extended.get()), false);
-    EXPECT_TRUE(TWPublicKeyIsValid(extended.get(), TWPublicKeyTypeSECP256k1Extended));
+    EXPECT_TRUE(TWPublicKeyIsValid(WRAPD(TWPublicKeyData(extended.get())).get(), TWPublicKeyTypeSECP256k1Extended));
 
     auto compressed = WRAP(TWPublicKey, TWPublicKeyCompressed(extended.get()));
     //EXPECT_TRUE(compressed == publicKey.get());
     EXPECT_EQ(TWPublicKeyKeyType(compressed.get()), TWPublicKeyTypeSECP256k1);
     EXPECT_EQ(compressed.get()->impl.bytes.size(), 33);
     EXPECT_EQ(TWPublicKeyIsCompressed(compressed.get()), true);
-    EXPECT_TRUE(TWPublicKeyIsValid(compressed.get(), TWPublicKeyTypeSECP256k1));
+    EXPECT_TRUE(TWPublicKeyIsValid(WRAPD(TWPublicKeyData(compressed.get())).get(), TWPublicKeyTypeSECP256k1));
 }
 
 TEST(TWPublicKeyTests, Verify) {
@@ -0,0 +1,146 @@
+// Copyright © 2017-2021 Trust Wallet.
+//
+// This file is part of Trust. The full Trust copyright notice, including
+// terms governing use, modification, and redistribution, is contained in the
+// file LICENSE at the root of the source code distribution tree.
+
+// Runs signing, planning, derivation and key generation from many threads at once.
+// Meant to be run under the thread sanitizer, see tools/stress-tests.
+
+#include "Coin.h"
+#include "HDWallet.h"
+#include "HexCoding.h"
+#include "Mnemonic.h"
+#include "PrivateKey.h"
+#include "SigningInputs.h"
+
+#include <TrustWalletCore/TWPrivateKey.h>
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <set>
+#include <thread>
+
+using namespace TW;
+
+namespace {
+
+const size_t threadCount = 16;
+const size_t roundCount = 10;
+
+const auto mnemonic = "shoot island position soft burden budget tooth cruel issue economy destroy above";
+
+/// Runs `body(thread, round)` from threadCount threads at once.
+void runConcurrently(const std::function<void(size_t, size_t)>& body) {
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&body, t] {
+            for (size_t round = 0; round < roundCount; ++round) {
+                body(t, round);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace
+
+TEST(Concurrency, Sign) {
+    // every coin with a signer, against its single-threaded output
+    std::vector<std::pair<TWCoinType, Data>> inputs;
+    std::vector<Data> expected;
+    for (const auto coin : getCoinTypes()) {
+        auto input = SigningInputs::forCoin(coin);
+        if (input.empty()) {
+            continue;
+        }
+        Data output;
+        anyCoinSign(coin, input, output);
+        ASSERT_FALSE(output.empty()) << coin;
+        inputs.emplace_back(coin, std::move(input));
+        expected.push_back(std::move(output));
+    }
+
+    runConcurrently([&](size_t thread, size_t round) {
+        const auto i = (thread * roundCount + round) % inputs.size();
+        Data output;
+        anyCoinSign(inputs[i].first, inputs[i].second, output);
+        EXPECT_EQ(hex(output), hex(expected[i])) << inputs[i].first;
+    });
+}
+
+TEST(Concurrency, SignBatch) {
+    const auto inputs = std::vector<Data>(32, SigningInputs::forCoin(TWCoinTypeEthereum));
+    Data expected;
+    anyCoinSign(TWCoinTypeEthereum, inputs[0], expected);
+
+    std::vector<Data> outputs;
+    anyCoinSignBatch(TWCoinTypeEthereum, inputs, outputs, threadCount);
+    ASSERT_EQ(outputs.size(), inputs.size());
+    for (const auto& output : outputs) {
+        EXPECT_EQ(hex(output), hex(expected));
+    }
+}
+
+TEST(Concurrency, Plan) {
+    const auto input = SigningInputs::serialize(SigningInputs::bitcoin(4));
+    Data expected;
+    anyCoinPlan(TWCoinTypeBitcoin, input, expected);
+
+    runConcurrently([&](size_t, size_t) {
+        Data output;
+        anyCoinPlan(TWCoinTypeBitcoin, input, output);
+        EXPECT_EQ(hex(output), hex(expected));
+    });
+}
+
+TEST(Concurrency, AddressesOfAllCoins) {
+    const auto wallet = HDWallet(mnemonic, "");
+    const auto coins = getCoinTypes();
+    std::vector<std::string> expected;
+    for (const auto coin : coins) {
+        expected.push_back(wallet.deriveAddress(coin));
+    }
+
+    runConcurrently([&](size_t thread, size_t round) {
+        const auto i = (thread * roundCount + round) % coins.size();
+        const auto address = wallet.deriveAddress(coins[i]);
+        EXPECT_EQ(address, expected[i]);
+        EXPECT_TRUE(validateAddress(coins[i], address));
+        EXPECT_EQ(normalizeAddress(coins[i], address), normalizeAddress(coins[i], expected[i]));
+    });
+}
+
+TEST(Concurrency, Mnemonic) {
+    const auto seed = hex(HDWallet(mnemonic, "").seed);
+
+    runConcurrently([&](size_t thread, size_t) {
+        // alternates cached and uncached seed computations
+        const auto passphrase = thread % 2 == 0 ? std::string() : std::to_string(thread);
+        const auto wallet = HDWallet(mnemonic, passphrase);
+        if (passphrase.empty()) {
+            EXPECT_EQ(hex(wallet.seed), seed);
+        }
+        const auto generated = HDWallet(128, "");
+        EXPECT_TRUE(Mnemonic::isValid(generated.mnemonic));
+    });
+}
+
+TEST(Concurrency, RandomKeys) {
+    std::vector<std::vector<std::string>> keys(threadCount);
+
+    runConcurrently([&](size_t thread, size_t) {
+        auto key = TWPrivateKeyCreate();
+        keys[thread].push_back(hex(key->impl.bytes));
+        TWPrivateKeyDelete(key);
+    });
+
+    std::set<std::string> unique;
+    for (const auto& threadKeys : keys) {
+        unique.insert(threadKeys.begin(), threadKeys.end());
+    }
+    EXPECT_EQ(unique.size(), threadCount * roundCount);
+}
@@ -35,9 +35,9 @@
 
 #if USE_BIP39_CACHE
 
-int bip39_cache_index = 0;
+THREAD_LOCAL int bip39_cache_index = 0;
 
-CONFIDENTIAL struct {
+THREAD_LOCAL CONFIDENTIAL struct {
   bool set;
   char mnemonic[256];
   char passphrase[64];
@@ -57,7 +57,7 @@ const char *mnemonic_generate(int strength) {
   return r;
 }
 
-CONFIDENTIAL char mnemo[24 * 10];
+THREAD_LOCAL CONFIDENTIAL char mnemo[24 * 10];
 
 const char *mnemonic_from_data(const uint8_t *data, int len) {
   if (len % 4 || len < 16 || len > 32) {
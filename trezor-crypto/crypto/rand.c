@@ -23,35 +23,72 @@
 
 #include <TrezorCrypto/rand.h>
 
+#include <errno.h>
 #include <fcntl.h>
+#include <stdlib.h>
 #include <sys/types.h>
 #include <sys/uio.h>
 #include <unistd.h>
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
 // [wallet-core]
-uint32_t __attribute__((weak)) random32() {
-    int randomData = open("/dev/urandom", O_RDONLY);
-    if (randomData < 0) {
-        return 0;
-    }
+// Stateless, so safe to call from several threads at once: each call asks the
+// kernel directly, through getrandom(2) when available, /dev/urandom otherwise.
+// Aborts if no random source can fill the buffer.
 
-    uint32_t result;
-    if (read(randomData, &result, sizeof(result)) < 0) {
-        return 0;
+#if defined(__linux__) && defined(SYS_getrandom)
+static int random_getrandom(uint8_t *buf, size_t len) {
+  while (len > 0) {
+    // no libc wrapper on older glibc and bionic, call the syscall directly
+    long n = syscall(SYS_getrandom, buf, len, 0);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return -1;
     }
+    buf += n;
+    len -= (size_t)n;
+  }
+  return 0;
+}
+#endif
 
-    close(randomData);
+static int random_urandom(uint8_t *buf, size_t len) {
+  int fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return -1;
+  }
+  while (len > 0) {
+    ssize_t n = read(fd, buf, len);
+    if (n <= 0) {
+      if (n < 0 && errno == EINTR) continue;
+      close(fd);
+      return -1;
+    }
+    buf += n;
+    len -= (size_t)n;
+  }
+  close(fd);
+  return 0;
+}
 
-    return result;
+uint32_t __attribute__((weak)) random32() {
+  uint32_t result = 0;
+  random_buffer((uint8_t *)&result, sizeof(result));
+  return result;
 }
 
 void __attribute__((weak)) random_buffer(uint8_t *buf, size_t len) {
-    int randomData = open("/dev/urandom", O_RDONLY);
-    if (randomData < 0) {
-        return;
-    }
-    if (read(randomData, buf, len) < 0) {
-        return;
-    }
-    close(randomData);
+#if defined(__linux__) && defined(SYS_getrandom)
+  if (random_getrandom(buf, len) == 0) {
+    return;
+  }
+  // kernel without getrandom, fall back to the device
+#endif
+  if (random_urandom(buf, len) != 0) {
+    // never hand out predictable key material
+    abort();
+  }
 }
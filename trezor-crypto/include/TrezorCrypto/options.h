@@ -104,4 +104,10 @@
 #define CONFIDENTIAL
 #endif
 
+// [wallet-core] storage class for caches and static buffers, one copy per thread
+// so they can be used from several threads at once
+#ifndef THREAD_LOCAL
+#define THREAD_LOCAL _Thread_local
+#endif
+
 #endif